@@ -0,0 +1,1089 @@
+/*
+ * gl-matrix-bench: times every function declared through gl-matrix.h,
+ * except the ones that only set up storage or print: mat4_dump,
+ * vec3soa/mat4soa_init, _paddedCount and _bufferSize, scene_init,
+ * anim_initTrack and anim_initClip. Add an entry with every new function.
+ *
+ * Each benchmark is run in two modes:
+ *   latency    - a single dependent chain, every call consumes the result
+ *                of the previous one
+ *   throughput - STREAMS independent chains interleaved so the CPU can
+ *                overlap consecutive calls
+ *
+ * Functions that do not read their output (builders, getters, functions
+ * returning a value) are chained by folding the result back into one of
+ * their inputs with FEED(), which adds a multiply and an add to the chain.
+ * The "feed" benchmark measures that overhead on its own.
+ *
+ * Cycles are read with rdtsc where available and are therefore TSC
+ * reference cycles, not core clock cycles.
+ *
+ * With --perf the Linux hardware counters (core cycles, instructions, L1D
+ * read misses, branch misses) are read around every measurement as well,
+ * see bench_perf_open.
+ */
+#define _POSIX_C_SOURCE 200112L
+#if defined(__linux__)
+// syscall() for perf_event_open
+#define _DEFAULT_SOURCE
+#endif
+
+#include "gl-matrix.h"
+#include "dispatch.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+#if defined(__linux__)
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define BENCH_HAVE_PERF 1
+#endif
+
+#ifndef GLM_BENCH_SIMD
+#define GLM_BENCH_SIMD "unknown"
+#endif
+
+#define STREAMS 8
+#define ARRAY_SIZE 256
+#define QUAT_ARRAY_SIZE 64
+
+#define FEED(x, r) ((x) += (float)(r) * 0.0f)
+
+// Moves an animation time forward, wrapping around before the last key
+#define ANIM_KEYS 16
+#define ANIM_ADVANCE(t, r) (FEED(t, r), (t) = (t) < ANIM_KEYS - 2 ? (t) + 0.01f : 0.0f)
+
+typedef struct {
+    vec2 v2[STREAMS];
+    vec3 v3[STREAMS];
+    vec4 v4[STREAMS];
+    mat2 m2[STREAMS];
+    mat3 m3[STREAMS];
+    mat4 m4[STREAMS];
+    quat q[STREAMS];
+    dquat dq[STREAMS];
+    // Receive the results of the out-of-place variants
+    vec2 o2[STREAMS];
+    vec3 o3[STREAMS];
+    vec4 o4[STREAMS];
+    mat2 om2[STREAMS];
+    mat3 om3[STREAMS];
+    mat4 om4[STREAMS];
+    quat oq[STREAMS];
+    vec3 arr[STREAMS][ARRAY_SIZE];
+    quat_v1 qarr1[STREAMS][QUAT_ARRAY_SIZE];
+    quat_v2 qarr2[STREAMS][QUAT_ARRAY_SIZE];
+    quat_v2 qpose[QUAT_ARRAY_SIZE];
+    vec3soa soa[STREAMS], soab;
+    float *soadot[STREAMS];
+    mat4 marr[STREAMS][ARRAY_SIZE];
+    mat4soa msoa[STREAMS], msoab;
+    float *msoadet[STREAMS];
+    scene scenes[STREAMS];
+    int32_t sparent[STREAMS][ARRAY_SIZE];
+    quat_v2 srotation[STREAMS][ARRAY_SIZE];
+    vec3 stranslation[STREAMS][ARRAY_SIZE];
+    vec3 sscale[STREAMS][ARRAY_SIZE];
+    mat4 sworld[STREAMS][ARRAY_SIZE];
+    uint8_t sdirty[STREAMS][ARRAY_SIZE];
+    // Every joint track shares the same keys, sampled at a per stream time
+    float akeytimes[ANIM_KEYS];
+    vec3 akeytranslation[ANIM_KEYS];
+    quat_v2 akeyrotation[ANIM_KEYS];
+    anim_track atranslation[STREAMS][ARRAY_SIZE];
+    anim_track arotation[STREAMS][ARRAY_SIZE];
+    anim_clip aclip[STREAMS];
+    float atime[STREAMS];
+    // Skinned in place against the marr palette of the stream
+    vec3 knormal[STREAMS][ARRAY_SIZE];
+    uint16_t kjoints[ARRAY_SIZE][SKIN_INFLUENCES];
+    vec4 kweights[ARRAY_SIZE];
+    dquat kdquat[ARRAY_SIZE];
+    // Bounds of the soa[s] stream culled against bfr, soab holds the box maxima
+    float *cradii;
+    uint8_t cmask[STREAMS][ARRAY_SIZE / 8];
+    frustum fr[STREAMS], bfr;
+    // Quarter turns, boxes transformed with them over and over do not grow
+    mat4 qturn[ARRAY_SIZE];
+    // Rigid transforms, and a mirror with a translation for the scale kernels
+    tmat4 tm[STREAMS], btm, bts;
+    // Backing storage of the vec3soa and mat4soa batches, carved out at a 32 byte boundary
+    float soamem[(4 * STREAMS + 4) * ARRAY_SIZE + (17 * STREAMS + 16) * ARRAY_SIZE + VEC3SOA_ALIGNMENT / sizeof(float)];
+
+    // Aligned variants, bench_data itself is allocated at GLM_MAT4A_ALIGNMENT
+    vec4a a4[STREAMS], ab4;
+    quata aq[STREAMS], abq;
+    mat4a am4[STREAMS], abm4;
+    mat4a upload[STREAMS][ARRAY_SIZE];
+
+    // Constant operands, chosen so that repeated in-place calls stay finite
+    vec2 b2, one2;
+    vec3 b3, c3, d3, one3, axis;
+    vec4 b4, one4;
+    mat2 bm2;
+    mat3 bm3;
+    mat4 bm4;
+    quat bq;
+    dquat bdq;
+    float m2d[6];
+} bench_data;
+
+typedef void (*bench_fn)(bench_data *d, size_t iters);
+
+typedef struct {
+    const char *name;
+    size_t items;
+    bench_fn latency;
+    bench_fn throughput;
+} bench_entry;
+
+/*
+ * X(name, items per call, statement using d and stream index s)
+ */
+#define BENCHMARKS(X) \
+    X(feed, 1, FEED(d->v3[s][0], d->v3[s][1])) \
+    \
+    X(vec2_copy, 1, vec2_copy(d->v2[s], d->v2[s])) \
+    X(vec2_set, 1, vec2_set(d->v2[s], d->v2[s][1], d->v2[s][0])) \
+    X(vec2_add, 1, vec2_add(d->v2[s], d->b2)) \
+    X(vec2_addTo, 1, vec2_addTo(d->o2[s], d->v2[s], d->b2); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_subtract, 1, vec2_subtract(d->v2[s], d->b2)) \
+    X(vec2_subtractTo, 1, vec2_subtractTo(d->o2[s], d->v2[s], d->b2); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_multiply, 1, vec2_multiply(d->v2[s], d->one2)) \
+    X(vec2_multiplyTo, 1, vec2_multiplyTo(d->o2[s], d->v2[s], d->one2); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_divide, 1, vec2_divide(d->v2[s], d->one2)) \
+    X(vec2_divideTo, 1, vec2_divideTo(d->o2[s], d->v2[s], d->one2); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_ceil, 1, vec2_ceil(d->v2[s])) \
+    X(vec2_ceilTo, 1, vec2_ceilTo(d->o2[s], d->v2[s]); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_floor, 1, vec2_floor(d->v2[s])) \
+    X(vec2_floorTo, 1, vec2_floorTo(d->o2[s], d->v2[s]); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_min, 1, vec2_min(d->v2[s], d->b2)) \
+    X(vec2_minTo, 1, vec2_minTo(d->o2[s], d->v2[s], d->b2); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_max, 1, vec2_max(d->v2[s], d->b2)) \
+    X(vec2_maxTo, 1, vec2_maxTo(d->o2[s], d->v2[s], d->b2); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_round, 1, vec2_round(d->v2[s])) \
+    X(vec2_roundTo, 1, vec2_roundTo(d->o2[s], d->v2[s]); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_scale, 1, vec2_scale(d->v2[s], 1.0f)) \
+    X(vec2_scaleTo, 1, vec2_scaleTo(d->o2[s], d->v2[s], 1.0f); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_scaleAndAdd, 1, vec2_scaleAndAdd(d->v2[s], d->b2, 0.5f)) \
+    X(vec2_scaleAndAddTo, 1, vec2_scaleAndAddTo(d->o2[s], d->v2[s], d->b2, 0.5f); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_distance, 1, FEED(d->v2[s][0], vec2_distance(d->v2[s], d->b2))) \
+    X(vec2_squaredDistance, 1, FEED(d->v2[s][0], vec2_squaredDistance(d->v2[s], d->b2))) \
+    X(vec2_length, 1, FEED(d->v2[s][0], vec2_length(d->v2[s]))) \
+    X(vec2_squaredLength, 1, FEED(d->v2[s][0], vec2_squaredLength(d->v2[s]))) \
+    X(vec2_negate, 1, vec2_negate(d->v2[s])) \
+    X(vec2_negateTo, 1, vec2_negateTo(d->o2[s], d->v2[s]); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_inverse, 1, vec2_inverse(d->v2[s])) \
+    X(vec2_inverseTo, 1, vec2_inverseTo(d->o2[s], d->v2[s]); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_normalize, 1, vec2_normalize(d->v2[s])) \
+    X(vec2_normalizeFast, 1, vec2_normalizeFast(d->v2[s])) \
+    X(vec2_normalizeTo, 1, vec2_normalizeTo(d->o2[s], d->v2[s]); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_dot, 1, FEED(d->v2[s][0], vec2_dot(d->v2[s], d->b2))) \
+    X(vec2_cross, 1, vec2_cross(d->v3[s], d->b2)) \
+    X(vec2_lerp, 1, vec2_lerp(d->v2[s], d->b2, 0.5f)) \
+    X(vec2_lerpTo, 1, vec2_lerpTo(d->o2[s], d->v2[s], d->b2, 0.5f); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_transformMat2, 1, vec2_transformMat2(d->v2[s], d->bm2)) \
+    X(vec2_transformMat2To, 1, vec2_transformMat2To(d->o2[s], d->v2[s], d->bm2); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_transformMat2d, 1, vec2_transformMat2d(d->v2[s], d->m2d)) \
+    X(vec2_transformMat2dTo, 1, vec2_transformMat2dTo(d->o2[s], d->v2[s], d->m2d); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_transformMat3, 1, vec2_transformMat3(d->v2[s], d->bm3)) \
+    X(vec2_transformMat3To, 1, vec2_transformMat3To(d->o2[s], d->v2[s], d->bm3); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_transformMat4, 1, vec2_transformMat4(d->v2[s], d->bm4)) \
+    X(vec2_transformMat4To, 1, vec2_transformMat4To(d->o2[s], d->v2[s], d->bm4); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_rotate, 1, vec2_rotate(d->v2[s], d->b2, 0.5f)) \
+    X(vec2_rotateTo, 1, vec2_rotateTo(d->o2[s], d->v2[s], d->b2, 0.5f); FEED(d->v2[s][0], d->o2[s][0])) \
+    X(vec2_angle, 1, FEED(d->v2[s][0], vec2_angle(d->v2[s], d->b2))) \
+    X(vec2_exactEquals, 1, FEED(d->v2[s][0], vec2_exactEquals(d->v2[s], d->b2))) \
+    \
+    X(vec3_length, 1, FEED(d->v3[s][0], vec3_length(d->v3[s]))) \
+    X(vec3_copy, 1, vec3_copy(d->v3[s], d->v3[s])) \
+    X(vec3_set, 1, vec3_set(d->v3[s], d->v3[s][2], d->v3[s][0], d->v3[s][1])) \
+    X(vec3_add, 1, vec3_add(d->v3[s], d->b3)) \
+    X(vec3_addTo, 1, vec3_addTo(d->o3[s], d->v3[s], d->b3); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_subtract, 1, vec3_subtract(d->v3[s], d->b3)) \
+    X(vec3_subtractTo, 1, vec3_subtractTo(d->o3[s], d->v3[s], d->b3); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_multiply, 1, vec3_multiply(d->v3[s], d->one3)) \
+    X(vec3_multiplyTo, 1, vec3_multiplyTo(d->o3[s], d->v3[s], d->one3); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_divide, 1, vec3_divide(d->v3[s], d->one3)) \
+    X(vec3_divideTo, 1, vec3_divideTo(d->o3[s], d->v3[s], d->one3); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_ceil, 1, vec3_ceil(d->v3[s])) \
+    X(vec3_ceilTo, 1, vec3_ceilTo(d->o3[s], d->v3[s]); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_floor, 1, vec3_floor(d->v3[s])) \
+    X(vec3_floorTo, 1, vec3_floorTo(d->o3[s], d->v3[s]); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_min, 1, vec3_min(d->v3[s], d->b3)) \
+    X(vec3_minTo, 1, vec3_minTo(d->o3[s], d->v3[s], d->b3); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_max, 1, vec3_max(d->v3[s], d->b3)) \
+    X(vec3_maxTo, 1, vec3_maxTo(d->o3[s], d->v3[s], d->b3); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_round, 1, vec3_round(d->v3[s])) \
+    X(vec3_roundTo, 1, vec3_roundTo(d->o3[s], d->v3[s]); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_scale, 1, vec3_scale(d->v3[s], 1.0f)) \
+    X(vec3_scaleTo, 1, vec3_scaleTo(d->o3[s], d->v3[s], 1.0f); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_scaleAndAdd, 1, vec3_scaleAndAdd(d->v3[s], d->b3, 0.5f)) \
+    X(vec3_scaleAndAddTo, 1, vec3_scaleAndAddTo(d->o3[s], d->v3[s], d->b3, 0.5f); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_distance, 1, FEED(d->v3[s][0], vec3_distance(d->v3[s], d->b3))) \
+    X(vec3_squaredDistance, 1, FEED(d->v3[s][0], vec3_squaredDistance(d->v3[s], d->b3))) \
+    X(vec3_squaredLength, 1, FEED(d->v3[s][0], vec3_squaredLength(d->v3[s]))) \
+    X(vec3_negate, 1, vec3_negate(d->v3[s])) \
+    X(vec3_negateTo, 1, vec3_negateTo(d->o3[s], d->v3[s]); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_inverse, 1, vec3_inverse(d->v3[s])) \
+    X(vec3_inverseTo, 1, vec3_inverseTo(d->o3[s], d->v3[s]); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_normalize, 1, vec3_normalize(d->v3[s])) \
+    X(vec3_normalizeFast, 1, vec3_normalizeFast(d->v3[s])) \
+    X(vec3_normalizeTo, 1, vec3_normalizeTo(d->o3[s], d->v3[s]); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_dot, 1, FEED(d->v3[s][0], vec3_dot(d->v3[s], d->b3))) \
+    X(vec3_cross, 1, vec3_cross(d->v3[s], d->axis)) \
+    X(vec3_crossTo, 1, vec3_crossTo(d->o3[s], d->v3[s], d->axis); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_lerp, 1, vec3_lerp(d->v3[s], d->b3, 0.5f)) \
+    X(vec3_lerpTo, 1, vec3_lerpTo(d->o3[s], d->v3[s], d->b3, 0.5f); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_hermite, 1, vec3_hermite(d->v3[s], d->b3, d->c3, d->d3, 0.5f)) \
+    X(vec3_hermiteTo, 1, vec3_hermiteTo(d->o3[s], d->v3[s], d->b3, d->c3, d->d3, 0.5f); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_bezier, 1, vec3_bezier(d->v3[s], d->b3, d->c3, d->d3, 0.5f)) \
+    X(vec3_bezierTo, 1, vec3_bezierTo(d->o3[s], d->v3[s], d->b3, d->c3, d->d3, 0.5f); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_transformMat4, 1, vec3_transformMat4(d->v3[s], d->bm4)) \
+    X(vec3_transformMat4To, 1, vec3_transformMat4To(d->o3[s], d->v3[s], d->bm4); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_transformMat3, 1, vec3_transformMat3(d->v3[s], d->bm3)) \
+    X(vec3_transformMat3To, 1, vec3_transformMat3To(d->o3[s], d->v3[s], d->bm3); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_transformQuat, 1, vec3_transformQuat(d->v3[s], d->bq)) \
+    X(vec3_transformQuatTo, 1, vec3_transformQuatTo(d->o3[s], d->v3[s], d->bq); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_rotateX, 1, vec3_rotateX(d->v3[s], d->b3, 0.5f)) \
+    X(vec3_rotateXTo, 1, vec3_rotateXTo(d->o3[s], d->v3[s], d->b3, 0.5f); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_rotateY, 1, vec3_rotateY(d->v3[s], d->b3, 0.5f)) \
+    X(vec3_rotateYTo, 1, vec3_rotateYTo(d->o3[s], d->v3[s], d->b3, 0.5f); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_rotateZ, 1, vec3_rotateZ(d->v3[s], d->b3, 0.5f)) \
+    X(vec3_rotateZTo, 1, vec3_rotateZTo(d->o3[s], d->v3[s], d->b3, 0.5f); FEED(d->v3[s][0], d->o3[s][0])) \
+    X(vec3_angle, 1, FEED(d->v3[s][0], vec3_angle(d->v3[s], d->b3))) \
+    X(vec3_equals, 1, FEED(d->v3[s][0], vec3_equals(d->v3[s], d->b3))) \
+    X(vec3_transformMat4_array, ARRAY_SIZE, vec3_transformMat4_array(d->arr[s], d->arr[s], ARRAY_SIZE, d->bm4)) \
+    X(vec3_transformMat3_array, ARRAY_SIZE, vec3_transformMat3_array(d->arr[s], d->arr[s], ARRAY_SIZE, d->bm3)) \
+    X(vec3_transformQuat_array, ARRAY_SIZE, vec3_transformQuat_array(d->arr[s], d->arr[s], ARRAY_SIZE, d->bq)) \
+    X(vec3_normalizeFast_array, ARRAY_SIZE, vec3_normalizeFast_array(d->arr[s], d->arr[s], ARRAY_SIZE)) \
+    X(vec3soa_fromVec3Array, ARRAY_SIZE, vec3soa_fromVec3Array(&d->soa[s], d->arr[s]); FEED(d->arr[s][0][0], d->soa[s].x[0])) \
+    X(vec3soa_toVec3Array, ARRAY_SIZE, vec3soa_toVec3Array(d->arr[s], &d->soa[s]); FEED(d->soa[s].x[0], d->arr[s][0][0])) \
+    X(vec3soa_add, ARRAY_SIZE, vec3soa_add(&d->soa[s], &d->soab)) \
+    X(vec3soa_scaleAndAdd, ARRAY_SIZE, vec3soa_scaleAndAdd(&d->soa[s], &d->soab, 0.5f)) \
+    X(vec3soa_normalize, ARRAY_SIZE, vec3soa_normalize(&d->soa[s])) \
+    X(vec3soa_normalizeFast, ARRAY_SIZE, vec3soa_normalizeFast(&d->soa[s])) \
+    X(vec3soa_dot, ARRAY_SIZE, vec3soa_dot(d->soadot[s], &d->soa[s], &d->soab); FEED(d->soa[s].x[0], d->soadot[s][0])) \
+    X(vec3soa_cross, ARRAY_SIZE, vec3soa_cross(&d->soa[s], &d->soab)) \
+    X(vec3soa_lerp, ARRAY_SIZE, vec3soa_lerp(&d->soa[s], &d->soab, 0.5f)) \
+    X(vec3soa_transformMat4, ARRAY_SIZE, vec3soa_transformMat4(&d->soa[s], d->bm4)) \
+    X(mat4soa_fromMat4Array, ARRAY_SIZE, mat4soa_fromMat4Array(&d->msoa[s], d->marr[s]); FEED(d->marr[s][0][0], d->msoa[s].m[0][0])) \
+    X(mat4soa_toMat4Array, ARRAY_SIZE, mat4soa_toMat4Array(d->marr[s], &d->msoa[s]); FEED(d->msoa[s].m[0][0], d->marr[s][0][0])) \
+    X(mat4soa_multiply, ARRAY_SIZE, mat4soa_multiply(&d->msoa[s], &d->msoab)) \
+    X(mat4soa_invert, ARRAY_SIZE, mat4soa_invert(&d->msoa[s])) \
+    X(mat4soa_determinant, ARRAY_SIZE, mat4soa_determinant(d->msoadet[s], &d->msoa[s]); FEED(d->msoa[s].m[0][0], d->msoadet[s][0])) \
+    X(anim_findKey, 1, ANIM_ADVANCE(d->atime[s], anim_findKey(&d->atranslation[s][0], d->atime[s]))) \
+    X(anim_sampleVec3, 1, anim_sampleVec3(d->v3[s], &d->atranslation[s][0], d->atime[s]); ANIM_ADVANCE(d->atime[s], d->v3[s][0])) \
+    X(anim_sampleQuat, 1, anim_sampleQuat(d->q[s], &d->arotation[s][0], d->atime[s]); ANIM_ADVANCE(d->atime[s], d->q[s][0])) \
+    X(anim_sampleTRS, ARRAY_SIZE, anim_sampleTRS(d->stranslation[s], d->srotation[s], NULL, &d->aclip[s], d->atime[s]); ANIM_ADVANCE(d->atime[s], d->srotation[s][ARRAY_SIZE - 1][0])) \
+    X(anim_sampleMat4, ARRAY_SIZE, anim_sampleMat4(d->marr[s], &d->aclip[s], d->atime[s]); ANIM_ADVANCE(d->atime[s], d->marr[s][ARRAY_SIZE - 1][0])) \
+    X(skin_linearBlend, ARRAY_SIZE, skin_linearBlend(d->arr[s], d->knormal[s], d->arr[s], d->knormal[s], d->kjoints[0], d->kweights, ARRAY_SIZE, d->marr[s])) \
+    X(skin_dualQuat, ARRAY_SIZE, skin_dualQuat(d->arr[s], d->knormal[s], d->arr[s], d->knormal[s], d->kjoints[0], d->kweights, ARRAY_SIZE, d->kdquat)) \
+    X(frustum_cullSpheres, ARRAY_SIZE, frustum_cullSpheres(d->cmask[s], d->bfr, &d->soa[s], d->cradii); FEED(d->soa[s].x[0], d->cmask[s][0])) \
+    X(frustum_cullAABBs, ARRAY_SIZE, frustum_cullAABBs(d->cmask[s], d->bfr, &d->soa[s], &d->soab); FEED(d->soa[s].x[0], d->cmask[s][0])) \
+    X(aabb_transformMat4_array, ARRAY_SIZE, aabb_transformMat4_array(d->arr[s], d->knormal[s], d->arr[s], d->knormal[s], ARRAY_SIZE, d->qturn)) \
+    X(scene_setParent, 1, scene_setParent(&d->scenes[s], 1, 0)) \
+    X(scene_setRotation, 1, scene_setRotation(&d->scenes[s], 0, d->q[s])) \
+    X(scene_setTranslation, 1, scene_setTranslation(&d->scenes[s], 0, d->v3[s])) \
+    X(scene_setScale, 1, scene_setScale(&d->scenes[s], 0, d->one3)) \
+    X(scene_markDirty, 1, scene_markDirty(&d->scenes[s], 0)) \
+    X(scene_update, ARRAY_SIZE, scene_setTranslation(&d->scenes[s], 0, d->b3); scene_update(&d->scenes[s]); FEED(d->scenes[s].translation[0][0], d->scenes[s].world[ARRAY_SIZE - 1][12])) \
+    X(mat4_fromRotationTranslationScale_array, ARRAY_SIZE, mat4_fromRotationTranslationScale_array(d->upload[s][0], 0, d->srotation[s], d->stranslation[s], d->sscale[s], ARRAY_SIZE, d->bm4); \
+        FEED(d->stranslation[s][0][0], d->upload[s][ARRAY_SIZE - 1][12])) \
+    X(mat4_fromRotationTranslationScale_array3x4, ARRAY_SIZE, mat4_fromRotationTranslationScale_array3x4(d->upload[s][0], 0, d->srotation[s], d->stranslation[s], d->sscale[s], ARRAY_SIZE, d->bm4); \
+        FEED(d->stranslation[s][0][0], d->upload[s][0][3])) \
+    X(mat4_fromRotationTranslationScale_loop, ARRAY_SIZE, size_t i; mat4 l; for (i = 0; i < ARRAY_SIZE; i++) { \
+        mat4_fromRotationTranslationScale(l, d->srotation[s][i], d->stranslation[s][i], d->sscale[s][i]); mat4_multiplyTo(d->upload[s][i], d->bm4, l); } \
+        FEED(d->stranslation[s][0][0], d->upload[s][ARRAY_SIZE - 1][12])) \
+    \
+    X(vec4_copy, 1, vec4_copy(d->v4[s], d->v4[s])) \
+    X(vec4_set, 1, vec4_set(d->v4[s], d->v4[s][3], d->v4[s][0], d->v4[s][1], d->v4[s][2])) \
+    X(vec4_add, 1, vec4_add(d->v4[s], d->b4)) \
+    X(vec4_addTo, 1, vec4_addTo(d->o4[s], d->v4[s], d->b4); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_subtract, 1, vec4_subtract(d->v4[s], d->b4)) \
+    X(vec4_subtractTo, 1, vec4_subtractTo(d->o4[s], d->v4[s], d->b4); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_multiply, 1, vec4_multiply(d->v4[s], d->one4)) \
+    X(vec4_multiplyTo, 1, vec4_multiplyTo(d->o4[s], d->v4[s], d->one4); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_divide, 1, vec4_divide(d->v4[s], d->one4)) \
+    X(vec4_divideTo, 1, vec4_divideTo(d->o4[s], d->v4[s], d->one4); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_ceil, 1, vec4_ceil(d->v4[s])) \
+    X(vec4_ceilTo, 1, vec4_ceilTo(d->o4[s], d->v4[s]); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_floor, 1, vec4_floor(d->v4[s])) \
+    X(vec4_floorTo, 1, vec4_floorTo(d->o4[s], d->v4[s]); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_min, 1, vec4_min(d->v4[s], d->b4)) \
+    X(vec4_minTo, 1, vec4_minTo(d->o4[s], d->v4[s], d->b4); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_max, 1, vec4_max(d->v4[s], d->b4)) \
+    X(vec4_maxTo, 1, vec4_maxTo(d->o4[s], d->v4[s], d->b4); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_round, 1, vec4_round(d->v4[s])) \
+    X(vec4_roundTo, 1, vec4_roundTo(d->o4[s], d->v4[s]); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_scale, 1, vec4_scale(d->v4[s], 1.0f)) \
+    X(vec4_scaleTo, 1, vec4_scaleTo(d->o4[s], d->v4[s], 1.0f); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_scaleAndAdd, 1, vec4_scaleAndAdd(d->v4[s], d->b4, 0.5f)) \
+    X(vec4_scaleAndAddTo, 1, vec4_scaleAndAddTo(d->o4[s], d->v4[s], d->b4, 0.5f); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_distance, 1, FEED(d->v4[s][0], vec4_distance(d->v4[s], d->b4))) \
+    X(vec4_squaredDistance, 1, FEED(d->v4[s][0], vec4_squaredDistance(d->v4[s], d->b4))) \
+    X(vec4_length, 1, FEED(d->v4[s][0], vec4_length(d->v4[s]))) \
+    X(vec4_squaredLength, 1, FEED(d->v4[s][0], vec4_squaredLength(d->v4[s]))) \
+    X(vec4_negate, 1, vec4_negate(d->v4[s])) \
+    X(vec4_negateTo, 1, vec4_negateTo(d->o4[s], d->v4[s]); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_inverse, 1, vec4_inverse(d->v4[s])) \
+    X(vec4_inverseTo, 1, vec4_inverseTo(d->o4[s], d->v4[s]); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_normalize, 1, vec4_normalize(d->v4[s])) \
+    X(vec4_normalizeFast, 1, vec4_normalizeFast(d->v4[s])) \
+    X(vec4_normalizeTo, 1, vec4_normalizeTo(d->o4[s], d->v4[s]); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_dot, 1, FEED(d->v4[s][0], vec4_dot(d->v4[s], d->b4))) \
+    X(vec4_lerp, 1, vec4_lerp(d->v4[s], d->b4, 0.5f)) \
+    X(vec4_lerpTo, 1, vec4_lerpTo(d->o4[s], d->v4[s], d->b4, 0.5f); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_transformMat4, 1, vec4_transformMat4(d->v4[s], d->bm4)) \
+    X(vec4_transformMat4To, 1, vec4_transformMat4To(d->o4[s], d->v4[s], d->bm4); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_transformQuat, 1, vec4_transformQuat(d->v4[s], d->bq)) \
+    X(vec4_transformQuatTo, 1, vec4_transformQuatTo(d->o4[s], d->v4[s], d->bq); FEED(d->v4[s][0], d->o4[s][0])) \
+    X(vec4_equals, 1, FEED(d->v4[s][0], vec4_equals(d->v4[s], d->b4))) \
+    \
+    X(mat2_identity, 1, mat2_identity(d->m2[s])) \
+    X(mat2_copy, 1, mat2_copy(d->m2[s], d->m2[s])) \
+    X(mat2_transpose, 1, mat2_transpose(d->m2[s])) \
+    X(mat2_transposeTo, 1, mat2_transposeTo(d->om2[s], d->m2[s]); FEED(d->m2[s][0], d->om2[s][0])) \
+    X(mat2_invert, 1, mat2_invert(d->m2[s])) \
+    X(mat2_invertTo, 1, mat2_invertTo(d->om2[s], d->m2[s]); FEED(d->m2[s][0], d->om2[s][0])) \
+    X(mat2_adjoint, 1, mat2_adjoint(d->m2[s])) \
+    X(mat2_adjointTo, 1, mat2_adjointTo(d->om2[s], d->m2[s]); FEED(d->m2[s][0], d->om2[s][0])) \
+    X(mat2_determinant, 1, FEED(d->m2[s][0], mat2_determinant(d->m2[s]))) \
+    X(mat2_multiply, 1, mat2_multiply(d->m2[s], d->bm2)) \
+    X(mat2_multiplyTo, 1, mat2_multiplyTo(d->om2[s], d->m2[s], d->bm2); FEED(d->m2[s][0], d->om2[s][0])) \
+    X(mat2_rotate, 1, mat2_rotate(d->m2[s], 0.5f)) \
+    X(mat2_rotateTo, 1, mat2_rotateTo(d->om2[s], d->m2[s], 0.5f); FEED(d->m2[s][0], d->om2[s][0])) \
+    X(mat2_scale, 1, mat2_scale(d->m2[s], d->one2)) \
+    X(mat2_scaleTo, 1, mat2_scaleTo(d->om2[s], d->m2[s], d->one2); FEED(d->m2[s][0], d->om2[s][0])) \
+    X(mat2_fromRotation, 1, mat2_fromRotation(d->m2[s], 0.5f + d->m2[s][0] * 0.0f)) \
+    X(mat2_fromScaling, 1, mat2_fromScaling(d->m2[s], d->m2[s])) \
+    X(mat2_add, 1, mat2_add(d->m2[s], d->bm2)) \
+    X(mat2_addTo, 1, mat2_addTo(d->om2[s], d->m2[s], d->bm2); FEED(d->m2[s][0], d->om2[s][0])) \
+    X(mat2_subtract, 1, mat2_subtract(d->m2[s], d->bm2)) \
+    X(mat2_subtractTo, 1, mat2_subtractTo(d->om2[s], d->m2[s], d->bm2); FEED(d->m2[s][0], d->om2[s][0])) \
+    X(mat2_equals, 1, FEED(d->m2[s][0], mat2_equals(d->m2[s], d->bm2))) \
+    X(mat2_multiplyScalar, 1, mat2_multiplyScalar(d->m2[s], 1.0f)) \
+    X(mat2_multiplyScalarTo, 1, mat2_multiplyScalarTo(d->om2[s], d->m2[s], 1.0f); FEED(d->m2[s][0], d->om2[s][0])) \
+    X(mat2_multiplyScalarAndAdd, 1, mat2_multiplyScalarAndAdd(d->m2[s], d->bm2, 0.5f)) \
+    X(mat2_multiplyScalarAndAddTo, 1, mat2_multiplyScalarAndAddTo(d->om2[s], d->m2[s], d->bm2, 0.5f); FEED(d->m2[s][0], d->om2[s][0])) \
+    \
+    X(mat3_fromMat4, 1, mat3_fromMat4(d->m3[s], d->m4[s]); FEED(d->m4[s][0], d->m3[s][0])) \
+    X(mat3_copy, 1, mat3_copy(d->m3[s], d->m3[s])) \
+    X(mat3_set, 1, mat3_set(d->m3[s], d->m3[s][8], d->m3[s][7], d->m3[s][6], d->m3[s][5], d->m3[s][4], d->m3[s][3], d->m3[s][2], d->m3[s][1], d->m3[s][0])) \
+    X(mat3_identity, 1, mat3_identity(d->m3[s])) \
+    X(mat3_transpose, 1, mat3_transpose(d->m3[s])) \
+    X(mat3_transposeTo, 1, mat3_transposeTo(d->om3[s], d->m3[s]); FEED(d->m3[s][0], d->om3[s][0])) \
+    X(mat3_invert, 1, mat3_invert(d->m3[s])) \
+    X(mat3_invertTo, 1, mat3_invertTo(d->om3[s], d->m3[s]); FEED(d->m3[s][0], d->om3[s][0])) \
+    X(mat3_adjoint, 1, mat3_adjoint(d->m3[s])) \
+    X(mat3_adjointTo, 1, mat3_adjointTo(d->om3[s], d->m3[s]); FEED(d->m3[s][0], d->om3[s][0])) \
+    X(mat3_determinant, 1, FEED(d->m3[s][0], mat3_determinant(d->m3[s]))) \
+    X(mat3_multiply, 1, mat3_multiply(d->m3[s], d->bm3)) \
+    X(mat3_multiplyTo, 1, mat3_multiplyTo(d->om3[s], d->m3[s], d->bm3); FEED(d->m3[s][0], d->om3[s][0])) \
+    X(mat3_translate, 1, mat3_translate(d->m3[s], d->b2)) \
+    X(mat3_translateTo, 1, mat3_translateTo(d->om3[s], d->m3[s], d->b2); FEED(d->m3[s][0], d->om3[s][0])) \
+    X(mat3_rotate, 1, mat3_rotate(d->m3[s], 0.5f)) \
+    X(mat3_rotateTo, 1, mat3_rotateTo(d->om3[s], d->m3[s], 0.5f); FEED(d->m3[s][0], d->om3[s][0])) \
+    X(mat3_scale, 1, mat3_scale(d->m3[s], d->one2)) \
+    X(mat3_scaleTo, 1, mat3_scaleTo(d->om3[s], d->m3[s], d->one2); FEED(d->m3[s][0], d->om3[s][0])) \
+    X(mat3_fromTranslation, 1, mat3_fromTranslation(d->m3[s], d->m3[s] + 6)) \
+    X(mat3_fromRotation, 1, mat3_fromRotation(d->m3[s], 0.5f + d->m3[s][0] * 0.0f)) \
+    X(mat3_fromScaling, 1, mat3_fromScaling(d->m3[s], d->m3[s])) \
+    X(mat3_fromMat2d, 1, mat3_fromMat2d(d->m3[s], d->m2d); FEED(d->m2d[0], d->m3[s][0])) \
+    X(mat3_fromQuat, 1, mat3_fromQuat(d->m3[s], d->q[s]); FEED(d->q[s][0], d->m3[s][0])) \
+    X(mat3_normalFromMat4, 1, mat3_normalFromMat4(d->m3[s], d->m4[s]); FEED(d->m4[s][0], d->m3[s][0])) \
+    X(mat3_projection, 1, mat3_projection(d->m3[s], 640.0f + d->m3[s][0] * 0.0f, 480.0f)) \
+    X(mat3_frob, 1, FEED(d->m3[s][0], mat3_frob(d->m3[s]))) \
+    X(mat3_add, 1, mat3_add(d->m3[s], d->bm3)) \
+    X(mat3_addTo, 1, mat3_addTo(d->om3[s], d->m3[s], d->bm3); FEED(d->m3[s][0], d->om3[s][0])) \
+    X(mat3_subtract, 1, mat3_subtract(d->m3[s], d->bm3)) \
+    X(mat3_subtractTo, 1, mat3_subtractTo(d->om3[s], d->m3[s], d->bm3); FEED(d->m3[s][0], d->om3[s][0])) \
+    X(mat3_multiplyScalar, 1, mat3_multiplyScalar(d->m3[s], 1.0f)) \
+    X(mat3_multiplyScalarTo, 1, mat3_multiplyScalarTo(d->om3[s], d->m3[s], 1.0f); FEED(d->m3[s][0], d->om3[s][0])) \
+    X(mat3_multiplyScalarAndAdd, 1, mat3_multiplyScalarAndAdd(d->m3[s], d->bm3, 0.5f)) \
+    X(mat3_multiplyScalarAndAddTo, 1, mat3_multiplyScalarAndAddTo(d->om3[s], d->m3[s], d->bm3, 0.5f); FEED(d->m3[s][0], d->om3[s][0])) \
+    X(mat3_equals, 1, FEED(d->m3[s][0], mat3_equals(d->m3[s], d->bm3))) \
+    \
+    X(mat4_identity, 1, mat4_identity(d->m4[s])) \
+    X(mat4_copy, 1, mat4_copy(d->m4[s], d->m4[s])) \
+    X(mat4_set, 1, mat4_set(d->m4[s], d->m4[s][15], d->m4[s][14], d->m4[s][13], d->m4[s][12], d->m4[s][11], d->m4[s][10], d->m4[s][9], d->m4[s][8], d->m4[s][7], d->m4[s][6], d->m4[s][5], d->m4[s][4], d->m4[s][3], d->m4[s][2], d->m4[s][1], d->m4[s][0])) \
+    X(mat4_transpose, 1, mat4_transpose(d->m4[s])) \
+    X(mat4_transposeTo, 1, mat4_transposeTo(d->om4[s], d->m4[s]); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_invert, 1, mat4_invert(d->m4[s])) \
+    X(mat4_invertTo, 1, mat4_invertTo(d->om4[s], d->m4[s]); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_invertAffine, 1, mat4_invertAffine(d->m4[s])) \
+    X(mat4_invertAffineTo, 1, mat4_invertAffineTo(d->om4[s], d->m4[s]); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_invertRigid, 1, mat4_invertRigid(d->m4[s])) \
+    X(mat4_invertRigidTo, 1, mat4_invertRigidTo(d->om4[s], d->m4[s]); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_adjoint, 1, mat4_adjoint(d->m4[s])) \
+    X(mat4_adjointTo, 1, mat4_adjointTo(d->om4[s], d->m4[s]); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_determinant, 1, FEED(d->m4[s][0], mat4_determinant(d->m4[s]))) \
+    X(mat4_multiply, 1, mat4_multiply(d->m4[s], d->bm4)) \
+    X(mat4_multiplyTo, 1, mat4_multiplyTo(d->om4[s], d->m4[s], d->bm4); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_multiplyAffine, 1, mat4_multiplyAffine(d->m4[s], d->bm4)) \
+    X(mat4_multiplyAffineTo, 1, mat4_multiplyAffineTo(d->om4[s], d->m4[s], d->bm4); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_classify, 1, FEED(d->m4[s][0], mat4_classify(d->m4[s]))) \
+    X(mat4_translate, 1, mat4_translate(d->m4[s], d->b3)) \
+    X(mat4_translateTo, 1, mat4_translateTo(d->om4[s], d->m4[s], d->b3); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_translatef, 1, mat4_translatef(d->m4[s], 0.25f, 0.5f, 0.75f)) \
+    X(mat4_translatefTo, 1, mat4_translatefTo(d->om4[s], d->m4[s], 0.25f, 0.5f, 0.75f); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_scale, 1, mat4_scale(d->m4[s], d->one3)) \
+    X(mat4_scaleTo, 1, mat4_scaleTo(d->om4[s], d->m4[s], d->one3); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_rotate, 1, mat4_rotate(d->m4[s], 0.5f, d->axis)) \
+    X(mat4_rotateTo, 1, mat4_rotateTo(d->om4[s], d->m4[s], 0.5f, d->axis); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_rotateX, 1, mat4_rotateX(d->m4[s], 0.5f)) \
+    X(mat4_rotateXTo, 1, mat4_rotateXTo(d->om4[s], d->m4[s], 0.5f); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_rotateY, 1, mat4_rotateY(d->m4[s], 0.5f)) \
+    X(mat4_rotateYTo, 1, mat4_rotateYTo(d->om4[s], d->m4[s], 0.5f); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_rotateZ, 1, mat4_rotateZ(d->m4[s], 0.5f)) \
+    X(mat4_rotateZTo, 1, mat4_rotateZTo(d->om4[s], d->m4[s], 0.5f); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_fromTranslation, 1, mat4_fromTranslation(d->m4[s], d->m4[s] + 12)) \
+    X(mat4_fromScaling, 1, mat4_fromScaling(d->m4[s], d->m4[s] + 12)) \
+    X(mat4_fromRotation, 1, mat4_fromRotation(d->m4[s], 0.5f + d->m4[s][0] * 0.0f, d->axis)) \
+    X(mat4_fromXRotation, 1, mat4_fromXRotation(d->m4[s], 0.5f + d->m4[s][0] * 0.0f)) \
+    X(mat4_fromYRotation, 1, mat4_fromYRotation(d->m4[s], 0.5f + d->m4[s][0] * 0.0f)) \
+    X(mat4_fromZRotation, 1, mat4_fromZRotation(d->m4[s], 0.5f + d->m4[s][0] * 0.0f)) \
+    X(mat4_fromRotationTranslation, 1, mat4_fromRotationTranslation(d->m4[s], d->q[s], d->m4[s] + 12); FEED(d->q[s][0], d->m4[s][0])) \
+    X(mat4_getTranslation, 1, mat4_getTranslation(d->v3[s], d->m4[s]); FEED(d->m4[s][12], d->v3[s][0])) \
+    X(mat4_getScaling, 1, mat4_getScaling(d->v3[s], d->m4[s]); FEED(d->m4[s][0], d->v3[s][0])) \
+    X(mat4_getRotation, 1, mat4_getRotation(d->q[s], d->m4[s]); FEED(d->m4[s][0], d->q[s][0])) \
+    X(mat4_fromRotationTranslationScale, 1, mat4_fromRotationTranslationScale(d->m4[s], d->q[s], d->m4[s] + 12, d->one3); FEED(d->q[s][0], d->m4[s][0])) \
+    X(mat4_fromRotationTranslationScaleOrigin, 1, mat4_fromRotationTranslationScaleOrigin(d->m4[s], d->q[s], d->m4[s] + 12, d->one3, d->b3); FEED(d->q[s][0], d->m4[s][0])) \
+    X(mat4_fromEulerTranslationScale, 1, mat4_fromEulerTranslationScale(d->m4[s], d->v3[s], d->b3, d->c3); FEED(d->v3[s][0], d->m4[s][0])) \
+    X(mat4_eulerTranslationScaleChain, 1, mat4_identity(d->m4[s]); mat4_translate(d->m4[s], d->b3); mat4_rotateZ(d->m4[s], d->v3[s][2]); \
+        mat4_rotateY(d->m4[s], d->v3[s][1]); mat4_rotateX(d->m4[s], d->v3[s][0]); mat4_scale(d->m4[s], d->c3); FEED(d->v3[s][0], d->m4[s][0])) \
+    X(mat4_fromQuat, 1, mat4_fromQuat(d->m4[s], d->q[s]); FEED(d->q[s][0], d->m4[s][0])) \
+    X(mat4_frustum, 1, mat4_frustum(d->m4[s], -1.0f + d->m4[s][0] * 0.0f, 1.0f, -1.0f, 1.0f, 0.1f, 100.0f)) \
+    X(mat4_perspective, 1, mat4_perspective(d->m4[s], 1.0f + d->m4[s][0] * 0.0f, 1.5f, 0.1f, 100.0f)) \
+    X(mat4_ortho, 1, mat4_ortho(d->m4[s], -1.0f + d->m4[s][0] * 0.0f, 1.0f, -1.0f, 1.0f, 0.1f, 100.0f)) \
+    X(mat4_lookAt, 1, mat4_lookAt(d->m4[s], d->v3[s], d->b3, d->axis); FEED(d->v3[s][0], d->m4[s][0])) \
+    X(mat4_targetTo, 1, mat4_targetTo(d->m4[s], d->v3[s], d->b3, d->axis); FEED(d->v3[s][0], d->m4[s][0])) \
+    X(mat4_frob, 1, FEED(d->m4[s][0], mat4_frob(d->m4[s]))) \
+    X(mat4_add, 1, mat4_add(d->m4[s], d->bm4)) \
+    X(mat4_addTo, 1, mat4_addTo(d->om4[s], d->m4[s], d->bm4); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_subtract, 1, mat4_subtract(d->m4[s], d->bm4)) \
+    X(mat4_subtractTo, 1, mat4_subtractTo(d->om4[s], d->m4[s], d->bm4); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_multiplyScalar, 1, mat4_multiplyScalar(d->m4[s], 1.0f)) \
+    X(mat4_multiplyScalarTo, 1, mat4_multiplyScalarTo(d->om4[s], d->m4[s], 1.0f); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_multiplyScalarAndAdd, 1, mat4_multiplyScalarAndAdd(d->m4[s], d->bm4, 0.5f)) \
+    X(mat4_multiplyScalarAndAddTo, 1, mat4_multiplyScalarAndAddTo(d->om4[s], d->m4[s], d->bm4, 0.5f); FEED(d->m4[s][0], d->om4[s][0])) \
+    X(mat4_equals, 1, FEED(d->m4[s][0], mat4_equals(d->m4[s], d->bm4))) \
+    \
+    X(quat_identity, 1, quat_identity(d->q[s])) \
+    X(quat_setAxisAngle, 1, quat_setAxisAngle(d->q[s], d->axis, 0.5f + d->q[s][0] * 0.0f)) \
+    X(quat_getAxisAngle, 1, FEED(d->q[s][0], quat_getAxisAngle(d->v3[s], d->q[s]))) \
+    X(quat_multiply, 1, quat_multiply(d->q[s], d->bq)) \
+    X(quat_multiplyTo, 1, quat_multiplyTo(d->oq[s], d->q[s], d->bq); FEED(d->q[s][0], d->oq[s][0])) \
+    X(quat_rotateX, 1, quat_rotateX(d->q[s], 0.5f)) \
+    X(quat_rotateXTo, 1, quat_rotateXTo(d->oq[s], d->q[s], 0.5f); FEED(d->q[s][0], d->oq[s][0])) \
+    X(quat_rotateY, 1, quat_rotateY(d->q[s], 0.5f)) \
+    X(quat_rotateYTo, 1, quat_rotateYTo(d->oq[s], d->q[s], 0.5f); FEED(d->q[s][0], d->oq[s][0])) \
+    X(quat_rotateZ, 1, quat_rotateZ(d->q[s], 0.5f)) \
+    X(quat_rotateZTo, 1, quat_rotateZTo(d->oq[s], d->q[s], 0.5f); FEED(d->q[s][0], d->oq[s][0])) \
+    X(quat_calculateW, 1, quat_calculateW(d->q[s])) \
+    X(quat_calculateWTo, 1, quat_calculateWTo(d->oq[s], d->q[s]); FEED(d->q[s][0], d->oq[s][0])) \
+    X(quat_slerp, 1, quat_slerp(d->q[s], d->bq, 2.0f)) \
+    X(quat_slerpTo, 1, quat_slerpTo(d->oq[s], d->q[s], d->bq, 2.0f); FEED(d->q[s][0], d->oq[s][0])) \
+    X(quat_nlerp, 1, quat_nlerp(d->q[s], d->bq, 0.5f)) \
+    X(quat_nlerpTo, 1, quat_nlerpTo(d->oq[s], d->q[s], d->bq, 0.5f); FEED(d->q[s][0], d->oq[s][0])) \
+    X(quat_slerpFast, 1, quat_slerpFast(d->q[s], d->bq, 0.5f)) \
+    X(quat_slerpFastTo, 1, quat_slerpFastTo(d->oq[s], d->q[s], d->bq, 0.5f); FEED(d->q[s][0], d->oq[s][0])) \
+    X(quat_invert, 1, quat_invert(d->q[s])) \
+    X(quat_invertTo, 1, quat_invertTo(d->oq[s], d->q[s]); FEED(d->q[s][0], d->oq[s][0])) \
+    X(quat_conjugate, 1, quat_conjugate(d->q[s])) \
+    X(quat_conjugateTo, 1, quat_conjugateTo(d->oq[s], d->q[s]); FEED(d->q[s][0], d->oq[s][0])) \
+    X(quat_fromMat3, 1, quat_fromMat3(d->q[s], d->m3[s]); FEED(d->m3[s][0], d->q[s][0])) \
+    X(quat_fromEuler, 1, quat_fromEuler(d->q[s], 30.0f + d->q[s][0] * 0.0f, 45.0f, 60.0f)) \
+    X(quat_packArray, QUAT_ARRAY_SIZE, quat_packArray(d->qarr2[s], d->qarr1[s], QUAT_ARRAY_SIZE); FEED(d->qarr1[s][0][0], d->qarr2[s][0][0])) \
+    X(quat_unpackArray, QUAT_ARRAY_SIZE, quat_unpackArray(d->qarr1[s], d->qarr2[s], QUAT_ARRAY_SIZE); FEED(d->qarr2[s][0][0], d->qarr1[s][0][0])) \
+    X(quat_nlerp_array, QUAT_ARRAY_SIZE, quat_nlerp_array(d->qarr2[s], d->qpose, QUAT_ARRAY_SIZE, 0.5f)) \
+    X(quat_slerpFast_array, QUAT_ARRAY_SIZE, quat_slerpFast_array(d->qarr2[s], d->qpose, QUAT_ARRAY_SIZE, 0.5f)) \
+    X(vec4_normalizeFast_array, QUAT_ARRAY_SIZE, vec4_normalizeFast_array(d->qarr2[s], d->qarr2[s], QUAT_ARRAY_SIZE)) \
+    X(quat_fromEuler_array, QUAT_ARRAY_SIZE, quat_fromEuler_array(d->qarr2[s], d->arr[s], QUAT_ARRAY_SIZE); FEED(d->arr[s][0][0], d->qarr2[s][0][0])) \
+    \
+    X(dquat_identity, 1, dquat_identity(d->dq[s])) \
+    X(dquat_copy, 1, dquat_copy(d->dq[s], d->dq[s])) \
+    X(dquat_fromRotationTranslation, 1, dquat_fromRotationTranslation(d->dq[s], d->q[s], d->v3[s]); FEED(d->q[s][0], d->dq[s][0])) \
+    X(dquat_getTranslation, 1, dquat_getTranslation(d->v3[s], d->dq[s]); FEED(d->dq[s][0], d->v3[s][0])) \
+    X(dquat_multiply, 1, dquat_multiply(d->dq[s], d->bdq)) \
+    X(dquat_normalize, 1, dquat_normalize(d->dq[s])) \
+    X(dquat_blend, 1, dquat_blend(d->dq[s], d->kdquat + 4 * s, d->kweights[s], SKIN_INFLUENCES); FEED(d->kweights[s][0], d->dq[s][0])) \
+    X(vec3_transformDquat, 1, vec3_transformDquat(d->v3[s], d->bdq)) \
+    X(mat4_fromDquat, 1, mat4_fromDquat(d->m4[s], d->dq[s]); FEED(d->dq[s][0], d->m4[s][0])) \
+    \
+    X(frustum_fromMat4, 1, frustum_fromMat4(d->fr[s], d->m4[s]); FEED(d->m4[s][0], d->fr[s][0][0])) \
+    X(frustum_testSphere, 1, FEED(d->v3[s][0], frustum_testSphere(d->bfr, d->v3[s], 0.5f))) \
+    X(frustum_testAABB, 1, FEED(d->v3[s][0], frustum_testAABB(d->bfr, d->v3[s], d->one3))) \
+    X(aabb_transformMat4, 1, aabb_transformMat4(d->v3[s], d->o3[s], d->qturn[0])) \
+    X(tmat4_identity, 1, tmat4_identity(&d->tm[s])) \
+    X(tmat4_fromMat4, 1, tmat4_fromMat4(&d->tm[s], d->m4[s]); FEED(d->m4[s][0], d->tm[s].m[0])) \
+    X(tmat4_fromTranslation, 1, tmat4_fromTranslation(&d->tm[s], d->tm[s].m + 12)) \
+    X(tmat4_fromScaling, 1, tmat4_fromScaling(&d->tm[s], d->tm[s].m + 12)) \
+    X(tmat4_fromQuat, 1, tmat4_fromQuat(&d->tm[s], d->q[s]); FEED(d->q[s][0], d->tm[s].m[0])) \
+    X(tmat4_fromRotationTranslation, 1, tmat4_fromRotationTranslation(&d->tm[s], d->q[s], d->tm[s].m + 12); FEED(d->q[s][0], d->tm[s].m[0])) \
+    X(tmat4_fromRotationTranslationScale, 1, tmat4_fromRotationTranslationScale(&d->tm[s], d->q[s], d->tm[s].m + 12, d->one3); FEED(d->q[s][0], d->tm[s].m[0])) \
+    X(tmat4_perspective, 1, tmat4_perspective(&d->tm[s], 1.0f + d->tm[s].m[0] * 0.0f, 1.5f, 0.1f, 100.0f)) \
+    X(tmat4_ortho, 1, tmat4_ortho(&d->tm[s], -1.0f + d->tm[s].m[0] * 0.0f, 1.0f, -1.0f, 1.0f, 0.1f, 100.0f)) \
+    X(tmat4_lookAt, 1, tmat4_lookAt(&d->tm[s], d->v3[s], d->b3, d->axis); FEED(d->v3[s][0], d->tm[s].m[0])) \
+    X(tmat4_multiply, 1, tmat4_multiply(&d->tm[s], &d->btm)) \
+    X(tmat4_multiply_scale, 1, tmat4_multiply(&d->tm[s], &d->bts)) \
+    X(tmat4_invert, 1, tmat4_invert(&d->tm[s])) \
+    X(tmat4_translate, 1, tmat4_translate(&d->tm[s], d->b3)) \
+    X(tmat4_scale, 1, tmat4_scale(&d->tm[s], d->one3)) \
+    X(tmat4_rotate, 1, tmat4_rotate(&d->tm[s], 0.5f, d->axis)) \
+    X(vec3_transformTmat4, 1, vec3_transformTmat4(d->v3[s], &d->btm)) \
+    X(vec3_transformTmat4_scale, 1, vec3_transformTmat4(d->v3[s], &d->bts)) \
+    X(vec3_transformTmat4_array, ARRAY_SIZE, vec3_transformTmat4_array(d->arr[s], d->arr[s], ARRAY_SIZE, &d->btm)) \
+    \
+    X(vec4a_copy, 1, vec4a_copy(d->a4[s], d->a4[s])) \
+    X(vec4a_add, 1, vec4a_add(d->a4[s], d->ab4)) \
+    X(vec4a_scale, 1, vec4a_scale(d->a4[s], 1.0f)) \
+    X(vec4a_dot, 1, FEED(d->a4[s][0], vec4a_dot(d->a4[s], d->ab4))) \
+    X(vec4a_transformMat4a, 1, vec4a_transformMat4a(d->a4[s], d->abm4)) \
+    X(quata_multiply, 1, quata_multiply(d->aq[s], d->abq)) \
+    X(mat4a_copy, 1, mat4a_copy(d->am4[s], d->am4[s])) \
+    X(mat4a_transpose, 1, mat4a_transpose(d->am4[s])) \
+    X(mat4a_multiply, 1, mat4a_multiply(d->am4[s], d->abm4))
+
+#define BENCH_DEFINE(name, items, ...) \
+    static inline void bench_##name##_body(bench_data *d, size_t s) { __VA_ARGS__; } \
+    static void bench_##name##_latency(bench_data *d, size_t iters) { \
+        size_t i; \
+        for (i = 0; i < iters; i++) { \
+            bench_##name##_body(d, 0); \
+        } \
+    } \
+    static void bench_##name##_throughput(bench_data *d, size_t iters) { \
+        size_t i, s; \
+        for (i = 0; i < iters; i += STREAMS) { \
+            for (s = 0; s < STREAMS; s++) { \
+                bench_##name##_body(d, s); \
+            } \
+        } \
+    }
+
+#define BENCH_REGISTER(name, items, ...) { #name, items, bench_##name##_latency, bench_##name##_throughput },
+
+BENCHMARKS(BENCH_DEFINE)
+
+static const bench_entry benchmarks[] = {
+    BENCHMARKS(BENCH_REGISTER)
+};
+
+static void bench_reset(bench_data *d) {
+    size_t s, i;
+    mat4 proj, view;
+    vec3 eye;
+    float *soamem = (float *)(((uintptr_t)d->soamem + VEC3SOA_ALIGNMENT - 1) & ~(uintptr_t)(VEC3SOA_ALIGNMENT - 1));
+
+    vec2_set(d->b2, 0.25f, 0.5f);
+    vec2_set(d->one2, 1, 1);
+    vec3_set(d->b3, 0.25f, 0.5f, 0.75f);
+    vec3_set(d->c3, -0.5f, 0.25f, 0.5f);
+    vec3_set(d->d3, 0.75f, -0.25f, 0.125f);
+    vec3_set(d->one3, 1, 1, 1);
+    vec3_set(d->axis, 0, 1, 0);
+    vec4_set(d->b4, 0.25f, 0.5f, 0.75f, 1.0f);
+    vec4_set(d->one4, 1, 1, 1, 1);
+    mat2_fromRotation(d->bm2, 0.3f);
+    mat3_fromRotation(d->bm3, 0.3f);
+    mat3_translate(d->bm3, d->b2);
+    mat4_fromRotation(d->bm4, 0.3f, d->one3);
+    mat4_translate(d->bm4, d->b3);
+    quat_setAxisAngle(d->bq, d->axis, 0.3f);
+    dquat_fromRotationTranslation(d->bdq, d->bq, d->b3);
+    vec4_copy(d->ab4, d->b4);
+    vec4_copy(d->abq, d->bq);
+    mat4_copy(d->abm4, d->bm4);
+    for (i = 0; i < 6; i++) {
+        d->m2d[i] = d->bm3[i];
+    }
+    vec3soa_init(&d->soab, soamem, ARRAY_SIZE);
+    soamem += vec3soa_bufferSize(ARRAY_SIZE);
+    for (i = 0; i < ARRAY_SIZE; i++) {
+        d->soab.x[i] = 0.48f;
+        d->soab.y[i] = 0.6f;
+        d->soab.z[i] = 0.64f;
+    }
+    mat4soa_init(&d->msoab, soamem, ARRAY_SIZE);
+    soamem += mat4soa_bufferSize(ARRAY_SIZE);
+    for (i = 0; i < ARRAY_SIZE; i++) {
+        mat4_copy(d->marr[0][i], d->bm4);
+    }
+    mat4soa_fromMat4Array(&d->msoab, d->marr[0]);
+    d->cradii = soamem;
+    soamem += vec3soa_paddedCount(ARRAY_SIZE);
+    for (i = 0; i < ARRAY_SIZE; i++) {
+        d->cradii[i] = 0.01f * (i % 16);
+    }
+    vec3_set(eye, 0, 0, 3);
+    mat4_perspective(proj, 1.0f, 1.5f, 0.1f, 100.0f);
+    mat4_lookAt(view, eye, d->c3, d->axis);
+    mat4_multiply(proj, view);
+    frustum_fromMat4(d->bfr, proj);
+    for (i = 0; i < ARRAY_SIZE; i++) {
+        mat4_fromRotation(d->qturn[i], 1.5707964f, d->axis);
+        mat4_translate(d->qturn[i], d->b3);
+    }
+    tmat4_fromRotationTranslation(&d->btm, d->bq, d->b3);
+    vec3_set(eye, 1, -1, 1);
+    tmat4_fromScaling(&d->bts, eye);
+    tmat4_translate(&d->bts, d->c3);
+    for (i = 0; i < QUAT_ARRAY_SIZE; i++) {
+        quat_fromEuler(d->qpose[i], 5.0f * i, 20.0f, 30.0f);
+    }
+    for (i = 0; i < ARRAY_SIZE; i++) {
+        d->kjoints[i][0] = (uint16_t)i;
+        d->kjoints[i][1] = (uint16_t)((i * 7 + 1) % ARRAY_SIZE);
+        d->kjoints[i][2] = (uint16_t)((i * 13 + 2) % ARRAY_SIZE);
+        d->kjoints[i][3] = (uint16_t)((i * 31 + 3) % ARRAY_SIZE);
+        vec4_set(d->kweights[i], 0.4f, 0.3f, 0.2f, 0.1f);
+        dquat_fromRotationTranslation(d->kdquat[i], d->qpose[i % QUAT_ARRAY_SIZE], d->b3);
+    }
+    for (i = 0; i < ANIM_KEYS; i++) {
+        d->akeytimes[i] = (float)i;
+        vec3_set(d->akeytranslation[i], 0.1f * i, 0.5f, -0.1f * i);
+        quat_fromEuler(d->akeyrotation[i], 10.0f * i, 20.0f, 30.0f);
+    }
+
+    for (s = 0; s < STREAMS; s++) {
+        vec2_set(d->v2[s], 0.6f, 0.8f);
+        vec3_set(d->v3[s], 0.48f, 0.6f, 0.64f);
+        vec4_set(d->v4[s], 0.5f, 0.5f, 0.5f, 0.5f);
+        mat2_fromRotation(d->m2[s], 0.1f * s);
+        mat3_fromRotation(d->m3[s], 0.1f * s);
+        mat4_fromRotation(d->m4[s], 0.1f * s + 0.1f, d->b3);
+        quat_fromEuler(d->q[s], 10.0f * s, 20.0f, 30.0f);
+        vec4_copy(d->a4[s], d->v4[s]);
+        vec4_copy(d->aq[s], d->q[s]);
+        dquat_fromRotationTranslation(d->dq[s], d->q[s], d->b3);
+        mat4_copy(d->am4[s], d->m4[s]);
+        tmat4_fromMat4(&d->tm[s], d->m4[s]);
+        for (i = 0; i < ARRAY_SIZE; i++) {
+            vec3_set(d->arr[s][i], 0.01f * i, 1.0f - 0.01f * i, 0.5f);
+            vec3_set(d->knormal[s][i], 0.48f, 0.6f, 0.64f);
+        }
+        for (i = 0; i < QUAT_ARRAY_SIZE; i++) {
+            quat_identity(d->qarr1[s][i]);
+            quat_identity(d->qarr2[s][i]);
+        }
+        vec3soa_init(&d->soa[s], soamem, ARRAY_SIZE);
+        soamem += vec3soa_bufferSize(ARRAY_SIZE);
+        vec3soa_fromVec3Array(&d->soa[s], d->arr[s]);
+        d->soadot[s] = soamem;
+        soamem += vec3soa_paddedCount(ARRAY_SIZE);
+        for (i = 0; i < ARRAY_SIZE; i++) {
+            mat4_fromRotation(d->marr[s][i], 0.001f * i + 0.1f, d->b3);
+        }
+        mat4soa_init(&d->msoa[s], soamem, ARRAY_SIZE);
+        soamem += mat4soa_bufferSize(ARRAY_SIZE);
+        mat4soa_fromMat4Array(&d->msoa[s], d->marr[s]);
+        d->msoadet[s] = soamem;
+        soamem += mat4soa_paddedCount(ARRAY_SIZE);
+        for (i = 0; i < ARRAY_SIZE; i++) {
+            anim_initTrack(&d->atranslation[s][i], d->akeytimes, d->akeytranslation[0], ANIM_KEYS);
+            anim_initTrack(&d->arotation[s][i], d->akeytimes, d->akeyrotation[0], ANIM_KEYS);
+        }
+        anim_initClip(&d->aclip[s], d->atranslation[s], d->arotation[s], NULL, ARRAY_SIZE);
+        d->atime[s] = 0.5f * s;
+        // Binary tree, dirtying the root recomputes every node
+        scene_init(&d->scenes[s], d->sparent[s], d->srotation[s], d->stranslation[s], d->sscale[s], d->sworld[s], d->sdirty[s], ARRAY_SIZE);
+        for (i = 1; i < ARRAY_SIZE; i++) {
+            scene_setParent(&d->scenes[s], i, (int32_t)(i - 1) / 2);
+            scene_setRotation(&d->scenes[s], i, d->bq);
+            scene_setTranslation(&d->scenes[s], i, d->b3);
+        }
+    }
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static unsigned long long now_cycles(void) {
+#ifdef BENCH_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/*
+ * Hardware counters of --perf, in the order of the group. The cycles
+ * counter leads the group, so all of them count over the same interval.
+ */
+enum { PERF_CYCLES, PERF_INSTRUCTIONS, PERF_L1D_MISSES, PERF_BRANCH_MISSES, PERF_COUNTERS };
+
+static const char *perf_names[PERF_COUNTERS] = { "core_cycles", "instructions", "l1d_misses", "branch_misses" };
+
+typedef struct {
+    int fd[PERF_COUNTERS];
+    uint64_t id[PERF_COUNTERS];
+} bench_perf;
+
+#ifdef BENCH_HAVE_PERF
+static int perf_event_open(struct perf_event_attr *attr, int group) {
+    return (int)syscall(SYS_perf_event_open, attr, 0, -1, group, 0);
+}
+#endif
+
+/*
+ * Opens the counter group for the calling thread, user space only so it
+ * works with perf_event_paranoid up to 2. Counters the CPU or the
+ * container does not provide keep an fd of -1 and are reported as n/a.
+ * Returns 0 and explains why on stderr if not even cycles can be counted.
+ */
+static int bench_perf_open(bench_perf *p) {
+    int k;
+
+    for (k = 0; k < PERF_COUNTERS; k++) {
+        p->fd[k] = -1;
+    }
+#ifdef BENCH_HAVE_PERF
+    for (k = 0; k < PERF_COUNTERS; k++) {
+        struct perf_event_attr attr;
+
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.disabled = k == PERF_CYCLES;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        switch (k) {
+        case PERF_CYCLES:
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case PERF_INSTRUCTIONS:
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case PERF_L1D_MISSES:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        default:
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        }
+        p->fd[k] = perf_event_open(&attr, k == PERF_CYCLES ? -1 : p->fd[PERF_CYCLES]);
+        if (p->fd[k] < 0) {
+            if (k == PERF_CYCLES) {
+                fprintf(stderr, "--perf: hardware counters unavailable (%s), timing only\n", strerror(errno));
+                return 0;
+            }
+            fprintf(stderr, "--perf: no %s counter (%s)\n", perf_names[k], strerror(errno));
+            continue;
+        }
+        if (ioctl(p->fd[k], PERF_EVENT_IOC_ID, &p->id[k]) < 0) {
+            close(p->fd[k]);
+            p->fd[k] = -1;
+        }
+    }
+    return 1;
+#else
+    fprintf(stderr, "--perf: hardware counters need Linux, timing only\n");
+    return 0;
+#endif
+}
+
+static void bench_perf_close(bench_perf *p) {
+#ifdef BENCH_HAVE_PERF
+    int k;
+    for (k = PERF_COUNTERS - 1; k >= 0; k--) {
+        if (p->fd[k] >= 0) {
+            close(p->fd[k]);
+        }
+    }
+#else
+    (void)p;
+#endif
+}
+
+static void bench_perf_start(bench_perf *p) {
+#ifdef BENCH_HAVE_PERF
+    if (p && p->fd[PERF_CYCLES] >= 0) {
+        ioctl(p->fd[PERF_CYCLES], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(p->fd[PERF_CYCLES], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#else
+    (void)p;
+#endif
+}
+
+/*
+ * Stops the group and stores the counts in out, -1 for counters that are
+ * not available. Counts are scaled up if the kernel had to multiplex the
+ * group with other events.
+ */
+static void bench_perf_stop(bench_perf *p, double *out) {
+    int k;
+
+    for (k = 0; k < PERF_COUNTERS; k++) {
+        out[k] = -1;
+    }
+#ifdef BENCH_HAVE_PERF
+    if (p && p->fd[PERF_CYCLES] >= 0) {
+        // nr, time enabled, time running, then a value and id pair per counter
+        uint64_t buf[3 + 2 * PERF_COUNTERS];
+        uint64_t i;
+        double scale;
+
+        ioctl(p->fd[PERF_CYCLES], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        if (read(p->fd[PERF_CYCLES], buf, sizeof(buf)) < (ssize_t)(3 * sizeof(uint64_t)) || buf[2] == 0) {
+            return;
+        }
+        scale = (double)buf[1] / (double)buf[2];
+        for (i = 0; i < buf[0] && i < PERF_COUNTERS; i++) {
+            for (k = 0; k < PERF_COUNTERS; k++) {
+                if (p->fd[k] >= 0 && p->id[k] == buf[4 + 2 * i]) {
+                    out[k] = (double)buf[3 + 2 * i] * scale;
+                }
+            }
+        }
+    }
+#else
+    (void)p;
+#endif
+}
+
+typedef struct {
+    double ns_per_op;
+    double cycles_per_op;
+    size_t iterations;
+    // Per op counts of the fastest run, -1 if not measured
+    double perf_per_op[PERF_COUNTERS];
+} bench_result;
+
+static bench_result bench_measure(bench_fn fn, size_t items, bench_data *d, double min_ns, int repeat, bench_perf *perf) {
+    bench_result res = { 0, 0, 0, { -1, -1, -1, -1 } };
+    size_t iters = STREAMS * 16;
+    double t0, t1;
+    unsigned long long c0, c1;
+    int r;
+
+    // Grow the iteration count until a single run takes at least min_ns
+    for (;;) {
+        bench_reset(d);
+        t0 = now_ns();
+        fn(d, iters);
+        t1 = now_ns();
+        if (t1 - t0 >= min_ns) {
+            break;
+        }
+        iters *= 2;
+    }
+
+    res.ns_per_op = -1;
+    for (r = 0; r < repeat; r++) {
+        double ns, counts[PERF_COUNTERS];
+        int k;
+        bench_reset(d);
+        bench_perf_start(perf);
+        t0 = now_ns();
+        c0 = now_cycles();
+        fn(d, iters);
+        c1 = now_cycles();
+        t1 = now_ns();
+        bench_perf_stop(perf, counts);
+        ns = (t1 - t0) / ((double)iters * items);
+        if (res.ns_per_op < 0 || ns < res.ns_per_op) {
+            res.ns_per_op = ns;
+            res.cycles_per_op = (double)(c1 - c0) / ((double)iters * items);
+            for (k = 0; k < PERF_COUNTERS; k++) {
+                res.perf_per_op[k] = counts[k] < 0 ? -1 : counts[k] / ((double)iters * items);
+            }
+        }
+    }
+    res.iterations = iters;
+    return res;
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  --filter SUBSTR  only run benchmarks whose name contains SUBSTR\n"
+        "  --mode MODE      latency, throughput or both (default both)\n"
+        "  --min-time MS    minimum duration of one measurement (default 20)\n"
+        "  --repeat N       measurements per benchmark, best is kept (default 5)\n"
+        "  --json FILE      also write results as JSON to FILE, - for stdout\n"
+        "  --perf           also read hardware counters and report IPC and misses per op (Linux)\n"
+        "  --list           list benchmark names and exit\n",
+        argv0);
+}
+
+int main(int argc, char **argv) {
+    const char *filter = NULL;
+    const char *json_path = NULL;
+    int run_latency = 1, run_throughput = 1;
+    double min_ns = 20e6;
+    int repeat = 5;
+    size_t count = sizeof(benchmarks) / sizeof(benchmarks[0]);
+    bench_data *d;
+    FILE *json = NULL;
+    FILE *table = stdout;
+    bench_perf perf;
+    int use_perf = 0;
+    int first = 1;
+    size_t i;
+    int m;
+
+    for (m = 1; m < argc; m++) {
+        if (!strcmp(argv[m], "--filter") && m + 1 < argc) {
+            filter = argv[++m];
+        }
+        else if (!strcmp(argv[m], "--mode") && m + 1 < argc) {
+            m++;
+            run_latency = !strcmp(argv[m], "latency") || !strcmp(argv[m], "both");
+            run_throughput = !strcmp(argv[m], "throughput") || !strcmp(argv[m], "both");
+            if (!run_latency && !run_throughput) {
+                usage(argv[0]);
+                return 1;
+            }
+        }
+        else if (!strcmp(argv[m], "--min-time") && m + 1 < argc) {
+            min_ns = atof(argv[++m]) * 1e6;
+        }
+        else if (!strcmp(argv[m], "--repeat") && m + 1 < argc) {
+            repeat = atoi(argv[++m]);
+            if (repeat < 1) {
+                repeat = 1;
+            }
+        }
+        else if (!strcmp(argv[m], "--json") && m + 1 < argc) {
+            json_path = argv[++m];
+        }
+        else if (!strcmp(argv[m], "--perf")) {
+            use_perf = 1;
+        }
+        else if (!strcmp(argv[m], "--list")) {
+            for (i = 0; i < count; i++) {
+                printf("%s\n", benchmarks[i].name);
+            }
+            return 0;
+        }
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (json_path) {
+        if (!strcmp(json_path, "-")) {
+            json = stdout;
+            table = stderr;
+        }
+        else if (!(json = fopen(json_path, "w"))) {
+            perror(json_path);
+            return 1;
+        }
+    }
+
+    if (posix_memalign((void **)&d, GLM_MAT4A_ALIGNMENT, sizeof(*d))) {
+        return 1;
+    }
+    if (use_perf) {
+        use_perf = bench_perf_open(&perf);
+    }
+
+    if (json) {
+        fprintf(json, "{\n  \"simd\": \"%s\",\n  \"level\": \"%s\",\n  \"streams\": %d,\n  \"cycles\": \"%s\",\n  \"benchmarks\": [",
+                GLM_BENCH_SIMD, dispatch_levelName(dispatch_getLevel()), STREAMS,
+#ifdef BENCH_HAVE_TSC
+                "tsc"
+#else
+                "none"
+#endif
+                );
+    }
+    fprintf(table, "%-44s %-10s %12s %12s", "benchmark", "mode", "ns/op", "cycles/op");
+    if (use_perf) {
+        fprintf(table, " %8s %12s %12s", "IPC", "L1D miss/op", "br miss/op");
+    }
+    fprintf(table, "\n");
+
+    for (i = 0; i < count; i++) {
+        const bench_entry *e = &benchmarks[i];
+        int mode;
+
+        if (filter && !strstr(e->name, filter)) {
+            continue;
+        }
+        for (mode = 0; mode < 2; mode++) {
+            const char *mode_name = mode ? "throughput" : "latency";
+            bench_result r;
+
+            if ((mode == 0 && !run_latency) || (mode == 1 && !run_throughput)) {
+                continue;
+            }
+            r = bench_measure(mode ? e->throughput : e->latency, e->items, d, min_ns, repeat, use_perf ? &perf : NULL);
+            fprintf(table, "%-44s %-10s %12.3f %12.2f", e->name, mode_name, r.ns_per_op, r.cycles_per_op);
+            if (use_perf) {
+                double *c = r.perf_per_op;
+                if (c[PERF_CYCLES] > 0 && c[PERF_INSTRUCTIONS] >= 0) {
+                    fprintf(table, " %8.2f", c[PERF_INSTRUCTIONS] / c[PERF_CYCLES]);
+                } else {
+                    fprintf(table, " %8s", "n/a");
+                }
+                if (c[PERF_L1D_MISSES] >= 0) {
+                    fprintf(table, " %12.4f", c[PERF_L1D_MISSES]);
+                } else {
+                    fprintf(table, " %12s", "n/a");
+                }
+                if (c[PERF_BRANCH_MISSES] >= 0) {
+                    fprintf(table, " %12.4f", c[PERF_BRANCH_MISSES]);
+                } else {
+                    fprintf(table, " %12s", "n/a");
+                }
+            }
+            fprintf(table, "\n");
+            fflush(table);
+            if (json) {
+                fprintf(json, "%s\n    {\"name\": \"%s\", \"mode\": \"%s\", \"items\": %zu, \"iterations\": %zu, "
+                        "\"ns_per_op\": %.4f, \"cycles_per_op\": ",
+                        first ? "" : ",", e->name, mode_name, e->items, r.iterations, r.ns_per_op);
+#ifdef BENCH_HAVE_TSC
+                fprintf(json, "%.4f", r.cycles_per_op);
+#else
+                fprintf(json, "null");
+#endif
+                if (use_perf) {
+                    int k;
+                    for (k = 0; k < PERF_COUNTERS; k++) {
+                        if (r.perf_per_op[k] >= 0) {
+                            fprintf(json, ", \"%s_per_op\": %.4f", perf_names[k], r.perf_per_op[k]);
+                        } else {
+                            fprintf(json, ", \"%s_per_op\": null", perf_names[k]);
+                        }
+                    }
+                }
+                fprintf(json, "}");
+                first = 0;
+            }
+        }
+    }
+
+    if (json) {
+        fprintf(json, "\n  ]\n}\n");
+        if (json != stdout) {
+            fclose(json);
+        }
+    }
+    if (use_perf) {
+        bench_perf_close(&perf);
+    }
+    free(d);
+    return 0;
+}
@@ -0,0 +1,36 @@
+#ifndef AABB_H
+#define AABB_H
+
+#include <stddef.h>
+#include "api.h"
+#include "typedefs.h"
+
+/**
+ * Transforms an axis aligned box with a mat4 and replaces it with the
+ * axis aligned box around the result (J. Arvo, "Transforming Axis-Aligned
+ * Bounding Boxes"). Gives the same box as transforming all 8 corners with
+ * vec3_transformMat4, but without the corners: 18 multiplies and no
+ * divides. Only the upper 3 rows of the matrix are used, so it must be
+ * affine.
+ *
+ * @param {vec3} min the minimum corner of the box, receives the new minimum
+ * @param {vec3} max the maximum corner of the box, receives the new maximum
+ * @param {mat4} m matrix to transform with
+ */
+GLM_API void aabb_transformMat4(vec3 min, vec3 max, mat4 m);
+
+/**
+ * Transforms an array of boxes, each with its own matrix, eg. the local
+ * bounds of every instance with its world matrix.
+ * Gives the same result as calling aabb_transformMat4 on every element.
+ *
+ * @param {vec3[]} dstMin receives the minimum corners, may be the same array as min
+ * @param {vec3[]} dstMax receives the maximum corners, may be the same array as max
+ * @param {vec3[]} min the minimum corners of the boxes
+ * @param {vec3[]} max the maximum corners of the boxes
+ * @param {Number} count number of boxes
+ * @param {mat4[]} m the affine matrices to transform with, one per box
+ */
+GLM_API void aabb_transformMat4_array(vec3 *dstMin, vec3 *dstMax, vec3 *min, vec3 *max, size_t count, mat4 *m);
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef ALIGNED_H
+#define ALIGNED_H
+
+#include "api.h"
+#include "typedefs.h"
+
+/**
+ * Functions on the aligned types of typedefs.h. They behave like their
+ * vec4_/quat_/mat4_ counterparts but load and store with aligned SIMD
+ * instructions, so every argument must really be aligned to
+ * GLM_VEC4A_ALIGNMENT, GLM_QUATA_ALIGNMENT or GLM_MAT4A_ALIGNMENT bytes.
+ * Declaring the variables as vec4a, quata or mat4a takes care of that,
+ * debug builds assert it.
+ */
+
+/**
+ * Copy the values from one vec4a to another
+ *
+ * @param {vec4a} dst the receiving vector
+ * @param {vec4a} a the source vector
+ */
+GLM_API void vec4a_copy(vec4a dst, vec4a a);
+
+/**
+ * Adds two vec4a's
+ *
+ * @param {vec4a} dst the receiving vector
+ * @param {vec4a} b the second operand
+ */
+GLM_API void vec4a_add(vec4a dst, vec4a b);
+
+/**
+ * Scales a vec4a by a scalar number
+ *
+ * @param {vec4a} dst the receiving vector
+ * @param {Number} b amount to scale the vector by
+ */
+GLM_API void vec4a_scale(vec4a dst, float b);
+
+/**
+ * Calculates the dot product of two vec4a's
+ *
+ * @param {vec4a} a the first operand
+ * @param {vec4a} b the second operand
+ * @returns {Number} dot product of a and b
+ */
+GLM_API float vec4a_dot(vec4a a, vec4a b);
+
+/**
+ * Transforms the vec4a with a mat4a
+ *
+ * @param {vec4a} dst the receiving vector
+ * @param {mat4a} m matrix to transform with
+ */
+GLM_API void vec4a_transformMat4a(vec4a dst, mat4a m);
+
+/**
+ * Multiplies two quata's
+ *
+ * @param {quata} dst the receiving quaternion
+ * @param {quata} b the second operand
+ */
+GLM_API void quata_multiply(quata dst, quata b);
+
+/**
+ * Copy the values from one mat4a to another
+ *
+ * @param {mat4a} dst the receiving matrix
+ * @param {mat4a} src the source matrix
+ */
+GLM_API void mat4a_copy(mat4a dst, mat4a src);
+
+/**
+ * Transpose the values of a mat4a
+ *
+ * @param {mat4a} dst the receiving matrix
+ */
+GLM_API void mat4a_transpose(mat4a dst);
+
+/**
+ * Multiplies two mat4a's
+ *
+ * @param {mat4a} dst the receiving matrix
+ * @param {mat4a} b the second operand
+ */
+GLM_API void mat4a_multiply(mat4a dst, mat4a b);
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef ANIM_H
+#define ANIM_H
+
+#include <stddef.h>
+#include "api.h"
+#include "typedefs.h"
+
+/**
+ * A keyframe track: count keys with ascending times, the values packed
+ * one after the other, 3 floats per key for translation and scale tracks
+ * and 4 floats (x, y, z, w) per key for rotation tracks. Key data is
+ * owned by the caller and only read, tracks of a clip may share one
+ * times array.
+ *
+ * cursor caches the key found by the last sample, so playback moving
+ * forward finds its key without searching.
+ */
+typedef struct {
+    float *times;
+    float *values;
+    size_t count;
+    size_t cursor;
+} anim_track;
+
+/**
+ * The tracks animating a skeleton, one per joint and channel. Any of the
+ * three arrays may be NULL when the clip does not animate that channel,
+ * a track with no keys leaves its joint untouched.
+ */
+typedef struct {
+    anim_track *translation;
+    anim_track *rotation;
+    anim_track *scale;
+    size_t count;
+} anim_clip;
+
+/**
+ * Sets up a track on top of caller provided key arrays
+ *
+ * @param {anim_track} dst the track to set up
+ * @param {float[]} times key times, ascending
+ * @param {float[]} values packed key values, 3 or 4 floats per key
+ * @param {Number} count number of keys
+ */
+GLM_API void anim_initTrack(anim_track *dst, float *times, float *values, size_t count);
+
+/**
+ * Sets up a clip on top of caller provided track arrays
+ *
+ * @param {anim_clip} dst the clip to set up
+ * @param {anim_track[]} translation translation tracks or NULL
+ * @param {anim_track[]} rotation rotation tracks or NULL
+ * @param {anim_track[]} scale scale tracks or NULL
+ * @param {Number} count number of joints
+ */
+GLM_API void anim_initClip(anim_clip *dst, anim_track *translation, anim_track *rotation, anim_track *scale, size_t count);
+
+/**
+ * Finds the key to interpolate from at time t, ie. the last key whose
+ * time is not after t, and stores it in the cursor of the track.
+ * Times before the first key give 0, times after the last key give
+ * count - 1.
+ *
+ * @param {anim_track} track the track to search, must have keys
+ * @param {Number} t time to sample at
+ * @returns {Number} index of the key
+ */
+GLM_API size_t anim_findKey(anim_track *track, float t);
+
+/**
+ * Samples a translation or scale track, interpolating linearly between keys
+ *
+ * @param {vec3} dst receives the sampled value, untouched if the track has no keys
+ * @param {anim_track} track the track to sample
+ * @param {Number} t time to sample at, clamped to the key range
+ */
+GLM_API void anim_sampleVec3(vec3 dst, anim_track *track, float t);
+
+/**
+ * Samples a rotation track, interpolating spherically between keys
+ *
+ * @param {quat} dst receives the sampled value, untouched if the track has no keys
+ * @param {anim_track} track the track to sample
+ * @param {Number} t time to sample at, clamped to the key range
+ */
+GLM_API void anim_sampleQuat(quat dst, anim_track *track, float t);
+
+/**
+ * Samples every track of a clip at time t. The arrays can be the ones
+ * of a scene, followed by scene_markDirty on the animated nodes.
+ *
+ * @param {vec3[]} translation receives the translations, NULL if clip has no translation tracks
+ * @param {quat_v2[]} rotation receives the rotations, NULL if clip has no rotation tracks
+ * @param {vec3[]} scale receives the scales, NULL if clip has no scale tracks
+ * @param {anim_clip} clip the clip to sample
+ * @param {Number} t time to sample at
+ */
+GLM_API void anim_sampleTRS(vec3 *translation, quat_v2 *rotation, vec3 *scale, anim_clip *clip, float t);
+
+/**
+ * Samples every track of a clip at time t and composes the local matrix
+ * of each joint like mat4_fromRotationTranslationScale. Missing channels
+ * and tracks without keys default to no translation, no rotation and
+ * unit scale.
+ *
+ * @param {mat4[]} dst receives the local matrices, clip->count entries
+ * @param {anim_clip} clip the clip to sample
+ * @param {Number} t time to sample at
+ */
+GLM_API void anim_sampleMat4(mat4 *dst, anim_clip *clip, float t);
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef API_H
+#define API_H
+
+/*
+ * Every function of the math modules included by gl-matrix.h is declared
+ * with GLM_API. By default they are regular functions compiled into the
+ * static library. Defining GLM_C_INLINE before including gl-matrix.h
+ * turns them into static inline functions whose definitions are pulled
+ * in from src/, so calls can be inlined without LTO and the library
+ * archive is not needed.
+ */
+#ifdef GLM_C_INLINE
+#define GLM_API static inline
+#else
+#define GLM_API
+#endif
+
+/*
+ * Qualifier of the out parameter of the out-of-place functions (the ones
+ * ending in To). It promises the compiler that out does not overlap any
+ * operand, so the operands can stay in registers while out is written.
+ * Array typedefs such as mat4 can not carry the qualifier, so those
+ * parameters are plain float pointers.
+ */
+#if defined(__cplusplus) || defined(_MSC_VER)
+#define GLM_RESTRICT __restrict
+#else
+#define GLM_RESTRICT restrict
+#endif
+
+#endif
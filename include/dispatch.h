@@ -0,0 +1,58 @@
+#ifndef DISPATCH_H
+#define DISPATCH_H
+
+/**
+ * Runtime SIMD selection. A library built with GL_MATRIX_SIMD=DISPATCH
+ * runs on any x86 CPU and routes its hot kernels (mat4_multiply,
+ * mat4_invert, vec3_transformMat4_array, ...) to the best instruction set
+ * the CPU supports. The level is chosen when the library is loaded and
+ * can be forced with the GLM_SIMD environment variable, set to none, sse4
+ * or avx2; levels above what the CPU supports are lowered.
+ *
+ * This module keeps global state, so it is part of the gl-matrix library
+ * only and is not pulled in by gl-matrix.h or available in GLM_C_INLINE
+ * mode. In builds with a fixed GL_MATRIX_SIMD backend the level cannot
+ * be changed.
+ */
+
+/**
+ * Instruction sets the kernels can run with
+ */
+typedef enum {
+    DISPATCH_NONE,
+    DISPATCH_SSE4,
+    DISPATCH_AVX2
+} dispatch_level;
+
+/**
+ * Returns the best level supported by the CPU and the OS
+ *
+ * @returns {dispatch_level} detected level
+ */
+dispatch_level dispatch_detect(void);
+
+/**
+ * Returns the level the kernels currently run with
+ *
+ * @returns {dispatch_level} active level
+ */
+dispatch_level dispatch_getLevel(void);
+
+/**
+ * Switches the kernels to another level. Not thread safe, call it before
+ * other threads use the library.
+ *
+ * @param {dispatch_level} level requested level, lowered to dispatch_detect()
+ * @returns {dispatch_level} level actually applied
+ */
+dispatch_level dispatch_setLevel(dispatch_level level);
+
+/**
+ * Returns the name of a level, as accepted by GLM_SIMD
+ *
+ * @param {dispatch_level} level the level
+ * @returns {String} "none", "sse4" or "avx2"
+ */
+const char *dispatch_levelName(dispatch_level level);
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef DQUAT_H
+#define DQUAT_H
+
+#include <stddef.h>
+#include "api.h"
+#include "typedefs.h"
+
+/**
+ * Set a dquat to the identity dual quaternion
+ *
+ * @param {dquat} out the receiving dual quaternion
+ */
+GLM_API void dquat_identity(dquat dst);
+
+/**
+ * Copy the values from one dquat to another
+ *
+ * @param {dquat} out the receiving dual quaternion
+ * @param {dquat} a the source dual quaternion
+ */
+GLM_API void dquat_copy(dquat dst, dquat a);
+
+/**
+ * Creates a dual quat from a quaternion and a translation, rotating first
+ *
+ * @param {dquat} out the receiving dual quaternion
+ * @param {quat} q the rotation, normalized
+ * @param {vec3} t the translation
+ */
+GLM_API void dquat_fromRotationTranslation(dquat dst, quat q, vec3 t);
+
+/**
+ * Gets the translation of a normalized dual quat
+ *
+ * @param {vec3} out the receiving vector
+ * @param {dquat} a dual quaternion to be decomposed
+ */
+GLM_API void dquat_getTranslation(vec3 dst, dquat a);
+
+/**
+ * Multiplies two dquat's, the result applies b first and then out,
+ * like quat_multiply
+ *
+ * @param {dquat} out the receiving dual quaternion
+ * @param {dquat} b the second operand
+ */
+GLM_API void dquat_multiply(dquat dst, dquat b);
+
+/**
+ * Normalizes a dquat: scales it to a unit real part and makes the dual
+ * part orthogonal to the real part
+ *
+ * @param {dquat} out the dual quaternion to normalize
+ */
+GLM_API void dquat_normalize(dquat dst);
+
+/**
+ * Dual quaternion linear blending: sums the weighted dquats and
+ * normalizes the result. Dquats whose real part lies in the other
+ * hemisphere than the first one are negated, so the blend takes the
+ * shortest path.
+ *
+ * @param {dquat} out the receiving dual quaternion
+ * @param {dquat[]} dq the dual quaternions to blend
+ * @param {float[]} weights the weight of every dual quaternion
+ * @param {Number} count number of dual quaternions, at least 1
+ */
+GLM_API void dquat_blend(dquat dst, dquat *dq, float *weights, size_t count);
+
+/**
+ * Transforms the vec3 with a normalized dquat: rotates it with the real
+ * part, then translates it
+ *
+ * @param {vec3} out the receiving vector
+ * @param {dquat} a dual quaternion to transform with
+ */
+GLM_API void vec3_transformDquat(vec3 dst, dquat a);
+
+/**
+ * Creates a matrix from a normalized dquat
+ *
+ * @param {mat4} out mat4 receiving operation result
+ * @param {dquat} a the dual quaternion
+ */
+GLM_API void mat4_fromDquat(mat4 dst, dquat a);
+
+#endif
@@ -1,3 +1,6 @@
 #ifndef EPSILON
 #define EPSILON 0.000001
 #endif
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
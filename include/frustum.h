@@ -0,0 +1,69 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "api.h"
+#include "typedefs.h"
+#include "vec3soa.h"
+
+/**
+ * Extracts the frustum planes of a view-projection matrix, eg. the
+ * product of mat4_perspective and mat4_lookAt. Planes are in the space
+ * the matrix transforms from, so a projection matrix alone gives view
+ * space planes.
+ *
+ * @param {frustum} out the receiving frustum
+ * @param {mat4} m the view-projection matrix, clip z in [-1, 1]
+ */
+GLM_API void frustum_fromMat4(frustum dst, mat4 m);
+
+/**
+ * Tests if a sphere is at least partly inside the frustum. Spheres near a
+ * corner of the frustum may be reported visible while outside.
+ *
+ * @param {frustum} f the frustum
+ * @param {vec3} center the center of the sphere
+ * @param {Number} radius the radius of the sphere
+ * @returns {Number} 1 if the sphere may be visible, 0 if it is outside
+ */
+GLM_API int frustum_testSphere(frustum f, vec3 center, float radius);
+
+/**
+ * Tests if an axis aligned box is at least partly inside the frustum.
+ * Boxes near an edge of the frustum may be reported visible while outside.
+ *
+ * @param {frustum} f the frustum
+ * @param {vec3} min the minimum corner of the box
+ * @param {vec3} max the maximum corner of the box
+ * @returns {Number} 1 if the box may be visible, 0 if it is outside
+ */
+GLM_API int frustum_testAABB(frustum f, vec3 min, vec3 max);
+
+/**
+ * Runs frustum_testSphere on a stream of spheres and writes the results
+ * as a bitmask: object i is visible when bit (i & 7) of dst[i >> 3] is set.
+ * The bits past centers->count in the last byte are cleared.
+ *
+ * @param {uint8_t[]} dst receives the bitmask, must hold
+ *                    vec3soa_paddedCount(centers->count) / 8 bytes
+ * @param {frustum} f the frustum
+ * @param {vec3soa} centers the centers of the spheres
+ * @param {float[]} radii the radii, must be aligned to VEC3SOA_ALIGNMENT
+ *                  bytes and hold vec3soa_paddedCount(centers->count) floats
+ */
+GLM_API void frustum_cullSpheres(uint8_t *dst, frustum f, vec3soa *centers, float *radii);
+
+/**
+ * Runs frustum_testAABB on a stream of boxes and writes the results as a
+ * bitmask laid out as for frustum_cullSpheres.
+ *
+ * @param {uint8_t[]} dst receives the bitmask, must hold
+ *                    vec3soa_paddedCount(mins->count) / 8 bytes
+ * @param {frustum} f the frustum
+ * @param {vec3soa} mins the minimum corners of the boxes
+ * @param {vec3soa} maxs the maximum corners of the boxes
+ */
+GLM_API void frustum_cullAABBs(uint8_t *dst, frustum f, vec3soa *mins, vec3soa *maxs);
+
+#endif
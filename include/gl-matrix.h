@@ -1,3 +1,6 @@
+#ifndef GL_MATRIX_H
+#define GL_MATRIX_H
+
 #include "vec2.h"
 #include "vec3.h"
 #include "vec4.h"
@@ -5,3 +8,35 @@
 #include "mat3.h"
 #include "mat4.h"
 #include "quat.h"
+#include "dquat.h"
+#include "vec3soa.h"
+#include "mat4soa.h"
+#include "scene.h"
+#include "aligned.h"
+#include "anim.h"
+#include "skin.h"
+#include "frustum.h"
+#include "aabb.h"
+#include "tmat4.h"
+
+#ifdef GLM_C_INLINE
+#include "../src/vec2.c"
+#include "../src/vec3.c"
+#include "../src/vec4.c"
+#include "../src/mat2.c"
+#include "../src/mat3.c"
+#include "../src/mat4.c"
+#include "../src/quat.c"
+#include "../src/dquat.c"
+#include "../src/vec3soa.c"
+#include "../src/mat4soa.c"
+#include "../src/scene.c"
+#include "../src/aligned.c"
+#include "../src/anim.c"
+#include "../src/skin.c"
+#include "../src/frustum.c"
+#include "../src/aabb.c"
+#include "../src/tmat4.c"
+#endif
+
+#endif
@@ -2,6 +2,7 @@
 #define MAT2_H
 
 #include <stdint.h>
+#include "api.h"
 #include "typedefs.h"
 
 /**
@@ -9,7 +10,7 @@
  *
  * @param {mat2} out the receiving matrix
  */
-void mat2_identity(mat2 dst);
+GLM_API void mat2_identity(mat2 dst);
 
 /**
  * Copy a mat2 to another mat2
@@ -17,28 +18,28 @@ void mat2_identity(mat2 dst);
  * @param {mat2} out the receiving matrix
  * @param {mat2} out the source matrix
  */
-void mat2_copy(mat2 dst, mat2 src);
+GLM_API void mat2_copy(mat2 dst, mat2 src);
 
 /**
  * Transpose the values of a mat2
  *
  * @param {mat2} the matrix
  */
-void mat2_transpose(mat2 dst);
+GLM_API void mat2_transpose(mat2 dst);
 
 /**
  * Inverts a mat2
  *
  * @param {mat2} the matrix
  */
-void mat2_invert(mat2 dst);
+GLM_API void mat2_invert(mat2 dst);
 
 /**
  * Calculates the adjugate of a mat2
  *
  * @param {mat2} the matrix
  */
-void mat2_adjoint(mat2 dst);
+GLM_API void mat2_adjoint(mat2 dst);
 
 /**
  * Calculates the determinant of a mat2
@@ -46,7 +47,7 @@ void mat2_adjoint(mat2 dst);
  * @param {mat2} a the source matrix
  * @returns {float} determinant of a
  */
-float mat2_determinant(mat2 dst);
+GLM_API float mat2_determinant(mat2 dst);
 
 /**
  * Multiplies two mat2's
@@ -54,7 +55,7 @@ float mat2_determinant(mat2 dst);
  * @param {mat2} out the receiving matrix
  * @param {mat2} the operand
  */
-void mat2_multiply(mat2 dst, mat2 op);
+GLM_API void mat2_multiply(mat2 dst, mat2 op);
 
 /**
  * Rotates a mat2 by the given angle
@@ -62,7 +63,7 @@ void mat2_multiply(mat2 dst, mat2 op);
  * @param {mat2} out the receiving matrix
  * @param {Number} rad the angle to rotate the matrix by
  */
-void mat2_rotate(mat2 dst, float rad);
+GLM_API void mat2_rotate(mat2 dst, float rad);
 
 /**
  * Scales the mat2 by the dimensions in the given vec2
@@ -70,7 +71,7 @@ void mat2_rotate(mat2 dst, float rad);
  * @param {mat2} out the receiving matrix
  * @param {vec2} v the vec2 to scale the matrix by
  **/
-void mat2_scale(mat2 dst, vec2 v);
+GLM_API void mat2_scale(mat2 dst, vec2 v);
 
 /**
  * Creates a matrix from a given angle
@@ -82,7 +83,7 @@ void mat2_scale(mat2 dst, vec2 v);
  * @param {mat2} out mat2 receiving operation result
  * @param {Number} rad the angle to rotate the matrix by
  */
-void mat2_fromRotation(mat2 dst, float rad);
+GLM_API void mat2_fromRotation(mat2 dst, float rad);
 
 /**
  * Creates a matrix from a vector scaling
@@ -94,7 +95,7 @@ void mat2_fromRotation(mat2 dst, float rad);
  * @param {mat2} out mat2 receiving operation result
  * @param {vec2} v Scaling vector
  */
-void mat2_fromScaling(mat2 dst, vec2 v);
+GLM_API void mat2_fromScaling(mat2 dst, vec2 v);
 
 /**
  * Adds two mat2's
@@ -102,7 +103,7 @@ void mat2_fromScaling(mat2 dst, vec2 v);
  * @param {mat2} the receiving matrix
  * @param {mat2} the operand
  */
-void mat2_add(mat2 dst, mat2 a);
+GLM_API void mat2_add(mat2 dst, mat2 a);
 
 /**
  * Subtracts matrix b from matrix a
@@ -110,7 +111,7 @@ void mat2_add(mat2 dst, mat2 a);
  * @param {mat2} the receiving matrix
  * @param {mat2} the operand
  */
-void mat2_subtract(mat2 dst, mat2 b);
+GLM_API void mat2_subtract(mat2 dst, mat2 b);
 
 /**
  * Returns whether or not the matrices have exactly the same elements.
@@ -119,7 +120,7 @@ void mat2_subtract(mat2 dst, mat2 b);
  * @param {mat2} b The second matrix.
  * @returns {uint8_t} 1 if the matrices are equal, 0 otherwise.
  */
-uint8_t mat2_equals(mat2 a, mat2 b);
+GLM_API uint8_t mat2_equals(mat2 a, mat2 b);
 
 /**
  * Multiply each element of the matrix by a scalar.
@@ -127,7 +128,7 @@ uint8_t mat2_equals(mat2 a, mat2 b);
  * @param {mat2} out the receiving matrix
  * @param {Number} b amount to scale the matrix's elements by
  */
-void mat2_multiplyScalar(mat2 dst, float b);
+GLM_API void mat2_multiplyScalar(mat2 dst, float b);
 
 /**
  * Adds two mat2's after multiplying each element of the second operand by a scalar value.
@@ -136,6 +137,91 @@ void mat2_multiplyScalar(mat2 dst, float b);
  * @param {mat2} b the second operand
  * @param {Number} scale the amount to scale b's elements by before adding
  */
-void mat2_multiplyScalarAndAdd(mat2 dst, mat2 b, float scale);
+GLM_API void mat2_multiplyScalarAndAdd(mat2 dst, mat2 b, float scale);
+
+// Out-of-place variants, see GLM_RESTRICT in api.h
+
+/**
+ * Transpose the values of a mat2
+ *
+ * @param {mat2} the matrix
+ */
+GLM_API void mat2_transposeTo(float *GLM_RESTRICT out, mat2 a);
+
+/**
+ * Inverts a mat2
+ *
+ * @param {mat2} the matrix
+ */
+GLM_API void mat2_invertTo(float *GLM_RESTRICT out, mat2 a);
+
+/**
+ * Calculates the adjugate of a mat2
+ *
+ * @param {mat2} the matrix
+ */
+GLM_API void mat2_adjointTo(float *GLM_RESTRICT out, mat2 a);
+
+/**
+ * Multiplies two mat2's
+ *
+ * @param {mat2} out the receiving matrix, must not overlap the other arguments
+ * @param {mat2} a the source matrix
+ * @param {mat2} the operand
+ */
+GLM_API void mat2_multiplyTo(float *GLM_RESTRICT out, mat2 a, mat2 op);
+
+/**
+ * Rotates a mat2 by the given angle
+ *
+ * @param {mat2} out the receiving matrix, must not overlap the other arguments
+ * @param {mat2} a the source matrix
+ * @param {Number} rad the angle to rotate the matrix by
+ */
+GLM_API void mat2_rotateTo(float *GLM_RESTRICT out, mat2 a, float rad);
+
+/**
+ * Scales the mat2 by the dimensions in the given vec2
+ *
+ * @param {mat2} out the receiving matrix, must not overlap the other arguments
+ * @param {mat2} a the source matrix
+ * @param {vec2} v the vec2 to scale the matrix by
+ **/
+GLM_API void mat2_scaleTo(float *GLM_RESTRICT out, mat2 a, vec2 v);
+
+/**
+ * Adds two mat2's
+ *
+ * @param {mat2} the receiving matrix
+ * @param {mat2} the operand
+ */
+GLM_API void mat2_addTo(float *GLM_RESTRICT out, mat2 a, mat2 b);
+
+/**
+ * Subtracts matrix b from matrix a
+ *
+ * @param {mat2} the receiving matrix
+ * @param {mat2} the operand
+ */
+GLM_API void mat2_subtractTo(float *GLM_RESTRICT out, mat2 a, mat2 b);
+
+/**
+ * Multiply each element of the matrix by a scalar.
+ *
+ * @param {mat2} out the receiving matrix, must not overlap the other arguments
+ * @param {mat2} a the source matrix
+ * @param {Number} b amount to scale the matrix's elements by
+ */
+GLM_API void mat2_multiplyScalarTo(float *GLM_RESTRICT out, mat2 a, float b);
+
+/**
+ * Adds two mat2's after multiplying each element of the second operand by a scalar value.
+ *
+ * @param {mat2} out the receiving vector, must not overlap the other arguments
+ * @param {mat2} a the source matrix
+ * @param {mat2} b the second operand
+ * @param {Number} scale the amount to scale b's elements by before adding
+ */
+GLM_API void mat2_multiplyScalarAndAddTo(float *GLM_RESTRICT out, mat2 a, mat2 b, float scale);
 
 #endif
@@ -2,6 +2,7 @@
 #define MAT3_H
 
 #include <stdint.h>
+#include "api.h"
 #include "typedefs.h"
 
 /**
@@ -10,7 +11,7 @@
  * @param {mat3} out the receiving 3x3 matrix
  * @param {mat4} a   the source 4x4 matrix
  */
-void mat3_fromMat4(mat3 dst, mat4 a);
+GLM_API void mat3_fromMat4(mat3 dst, mat4 a);
 
 /**
  * Copy the values from one mat3 to another
@@ -18,7 +19,7 @@ void mat3_fromMat4(mat3 dst, mat4 a);
  * @param {mat3} out the receiving matrix
  * @param {mat3} a the source matrix
  */
-void mat3_copy(mat3 dst, mat3 a);
+GLM_API void mat3_copy(mat3 dst, mat3 a);
 
 /**
  * Set the components of a mat3 to the given values
@@ -34,21 +35,21 @@ void mat3_copy(mat3 dst, mat3 a);
  * @param {Number} m21 Component in column 2, row 1 position (index 7)
  * @param {Number} m22 Component in column 2, row 2 position (index 8)
  */
-void mat3_set(mat3 dst, float m00, float m01, float m02, float m10, float m11, float m12, float m20, float m21, float m22);
+GLM_API void mat3_set(mat3 dst, float m00, float m01, float m02, float m10, float m11, float m12, float m20, float m21, float m22);
 
 /**
  * Set a mat3 to the identity matrix
  *
  * @param {mat3} out the receiving matrix
  */
-void mat3_identity(mat3 dst);
+GLM_API void mat3_identity(mat3 dst);
 
 /**
  * Transpose the values of a mat3
  *
  * @param {mat3} out the receiving matrix
  */
-void mat3_transpose(mat3 dst);
+GLM_API void mat3_transpose(mat3 dst);
 
 /**
  * Inverts a mat3
@@ -56,14 +57,14 @@ void mat3_transpose(mat3 dst);
  * @param {mat3} out the receiving matrix
  * @returns {mat3} out
  */
-void mat3_invert(mat3 dst);
+GLM_API void mat3_invert(mat3 dst);
 
 /**
  * Calculates the adjugate of a mat3
  *
  * @param {mat3} out the receiving matrix
  */
-void mat3_adjoint(mat3 dst);
+GLM_API void mat3_adjoint(mat3 dst);
 
 /**
  * Calculates the determinant of a mat3
@@ -71,7 +72,7 @@ void mat3_adjoint(mat3 dst);
  * @param {mat3} a the source matrix
  * @returns {Number} determinant of a
  */
-float mat3_determinant(mat3 dst);
+GLM_API float mat3_determinant(mat3 dst);
 
 /**
  * Multiplies two mat3's
@@ -79,7 +80,7 @@ float mat3_determinant(mat3 dst);
  * @param {mat3} out the receiving matrix
  * @param {mat3} b the second operand
  */
-void mat3_multiply(mat3 dst, mat3 b);
+GLM_API void mat3_multiply(mat3 dst, mat3 b);
 
 /**
  * Translate a mat3 by the given vector
@@ -87,7 +88,7 @@ void mat3_multiply(mat3 dst, mat3 b);
  * @param {mat3} out the receiving matrix
  * @param {vec2} v vector to translate by
  */
-void mat3_translate(mat3 dst, vec2 v);
+GLM_API void mat3_translate(mat3 dst, vec2 v);
 
 /**
  * Rotates a mat3 by the given angle
@@ -95,7 +96,7 @@ void mat3_translate(mat3 dst, vec2 v);
  * @param {mat3} out the receiving matrix
  * @param {Number} rad the angle to rotate the matrix by
  */
-void mat3_rotate(mat3 dst, float rad);
+GLM_API void mat3_rotate(mat3 dst, float rad);
 
 /**
  * Scales the mat3 by the dimensions in the given vec2
@@ -103,7 +104,7 @@ void mat3_rotate(mat3 dst, float rad);
  * @param {mat3} out the receiving matrix
  * @param {vec2} v the vec2 to scale the matrix by
  **/
-void mat3_scale(mat3 dst, vec2 v);
+GLM_API void mat3_scale(mat3 dst, vec2 v);
 
 /**
  * Creates a matrix from a vector translation
@@ -115,7 +116,7 @@ void mat3_scale(mat3 dst, vec2 v);
  * @param {mat3} out mat3 receiving operation result
  * @param {vec2} v Translation vector
  */
-void mat3_fromTranslation(mat3 dst, vec2 v);
+GLM_API void mat3_fromTranslation(mat3 dst, vec2 v);
 
 /**
  * Creates a matrix from a given angle
@@ -128,7 +129,7 @@ void mat3_fromTranslation(mat3 dst, vec2 v);
  * @param {Number} rad the angle to rotate the matrix by
  * @returns {mat3} out
  */
-void mat3_fromRotation(mat3 dst, float rad);
+GLM_API void mat3_fromRotation(mat3 dst, float rad);
 
 /**
  * Creates a matrix from a vector scaling
@@ -140,7 +141,7 @@ void mat3_fromRotation(mat3 dst, float rad);
  * @param {mat3} out mat3 receiving operation result
  * @param {vec2} v Scaling vector
  */
-void mat3_fromScaling(mat3 dst, vec2 v);
+GLM_API void mat3_fromScaling(mat3 dst, vec2 v);
 
 /**
  * Copies the values from a mat2d into a mat3
@@ -148,7 +149,7 @@ void mat3_fromScaling(mat3 dst, vec2 v);
  * @param {mat3} out the receiving matrix
  * @param {mat2d} a the matrix to copy
  **/
-void mat3_fromMat2d(mat3 dst, mat2 a);
+GLM_API void mat3_fromMat2d(mat3 dst, mat2 a);
 
 /**
 * Calculates a 3x3 matrix from the given quaternion
@@ -156,7 +157,7 @@ void mat3_fromMat2d(mat3 dst, mat2 a);
 * @param {mat3} out mat3 receiving operation result
 * @param {quat} q Quaternion to create matrix from
 */
-void mat3_fromQuat(mat3 dst, quat q);
+GLM_API void mat3_fromQuat(mat3 dst, quat q);
 
 /**
 * Calculates a 3x3 normal matrix (transpose inverse) from the 4x4 matrix
@@ -164,7 +165,7 @@ void mat3_fromQuat(mat3 dst, quat q);
 * @param {mat3} out mat3 receiving operation result
 * @param {mat4} a Mat4 to derive the normal matrix from
 */
-void mat3_normalFromMat4(mat3 dst, mat4 a);
+GLM_API void mat3_normalFromMat4(mat3 dst, mat4 a);
 
 /**
  * Generates a 2D projection matrix with the given bounds
@@ -173,7 +174,7 @@ void mat3_normalFromMat4(mat3 dst, mat4 a);
  * @param {number} width Width of your gl context
  * @param {number} height Height of gl context
  */
-void mat3_projection(mat3 dst, float width, float height);
+GLM_API void mat3_projection(mat3 dst, float width, float height);
 
 /**
  * Returns Frobenius norm of a mat3
@@ -181,7 +182,7 @@ void mat3_projection(mat3 dst, float width, float height);
  * @param {mat3} a the matrix to calculate Frobenius norm of
  * @returns {Number} Frobenius norm
  */
-float mat3_frob(mat3 a);
+GLM_API float mat3_frob(mat3 a);
 
 /**
  * Adds two mat3's
@@ -189,7 +190,7 @@ float mat3_frob(mat3 a);
  * @param {mat3} out the receiving matrix
  * @param {mat3} b the second operand
  */
-void mat3_add(mat3 dst, mat3 b);
+GLM_API void mat3_add(mat3 dst, mat3 b);
 
 /**
  * Subtracts matrix b from matrix a
@@ -197,7 +198,7 @@ void mat3_add(mat3 dst, mat3 b);
  * @param {mat3} out the receiving matrix
  * @param {mat3} b the second operand
  */
-void mat3_subtract(mat3 dst, mat3 b);
+GLM_API void mat3_subtract(mat3 dst, mat3 b);
 
 /**
  * Multiply each element of the matrix by a scalar.
@@ -205,7 +206,7 @@ void mat3_subtract(mat3 dst, mat3 b);
  * @param {mat3} out the receiving matrix
  * @param {Number} b amount to scale the matrix's elements by
  */
-void mat3_multiplyScalar(mat3 dst, float b);
+GLM_API void mat3_multiplyScalar(mat3 dst, float b);
 
 /**
  * Adds two mat3's after multiplying each element of the second operand by a scalar value.
@@ -214,7 +215,7 @@ void mat3_multiplyScalar(mat3 dst, float b);
  * @param {mat3} b the second operand
  * @param {Number} scale the amount to scale b's elements by before adding
  */
-void mat3_multiplyScalarAndAdd(mat3 dst, mat3 b, float scale);
+GLM_API void mat3_multiplyScalarAndAdd(mat3 dst, mat3 b, float scale);
 
 /**
  * Returns whether or not the matrices have exactly the same elements.
@@ -223,6 +224,106 @@ void mat3_multiplyScalarAndAdd(mat3 dst, mat3 b, float scale);
  * @param {mat3} b The second matrix.
  * @returns {uint8_t} 1 if the matrices are equal, 0 otherwise.
  */
-uint8_t mat3_equals(mat3 a, mat3 b);
+GLM_API uint8_t mat3_equals(mat3 a, mat3 b);
+
+// Out-of-place variants, see GLM_RESTRICT in api.h
+
+/**
+ * Transpose the values of a mat3
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ */
+GLM_API void mat3_transposeTo(float *GLM_RESTRICT out, mat3 a);
+
+/**
+ * Inverts a mat3
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @returns {mat3} out
+ */
+GLM_API void mat3_invertTo(float *GLM_RESTRICT out, mat3 a);
+
+/**
+ * Calculates the adjugate of a mat3
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ */
+GLM_API void mat3_adjointTo(float *GLM_RESTRICT out, mat3 a);
+
+/**
+ * Multiplies two mat3's
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {mat3} b the second operand
+ */
+GLM_API void mat3_multiplyTo(float *GLM_RESTRICT out, mat3 a, mat3 b);
+
+/**
+ * Translate a mat3 by the given vector
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {vec2} v vector to translate by
+ */
+GLM_API void mat3_translateTo(float *GLM_RESTRICT out, mat3 a, vec2 v);
+
+/**
+ * Rotates a mat3 by the given angle
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {Number} rad the angle to rotate the matrix by
+ */
+GLM_API void mat3_rotateTo(float *GLM_RESTRICT out, mat3 a, float rad);
+
+/**
+ * Scales the mat3 by the dimensions in the given vec2
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {vec2} v the vec2 to scale the matrix by
+ **/
+GLM_API void mat3_scaleTo(float *GLM_RESTRICT out, mat3 a, vec2 v);
+
+/**
+ * Adds two mat3's
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {mat3} b the second operand
+ */
+GLM_API void mat3_addTo(float *GLM_RESTRICT out, mat3 a, mat3 b);
+
+/**
+ * Subtracts matrix b from matrix a
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {mat3} b the second operand
+ */
+GLM_API void mat3_subtractTo(float *GLM_RESTRICT out, mat3 a, mat3 b);
+
+/**
+ * Multiply each element of the matrix by a scalar.
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {Number} b amount to scale the matrix's elements by
+ */
+GLM_API void mat3_multiplyScalarTo(float *GLM_RESTRICT out, mat3 a, float b);
+
+/**
+ * Adds two mat3's after multiplying each element of the second operand by a scalar value.
+ *
+ * @param {mat3} out the receiving vector, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {mat3} b the second operand
+ * @param {Number} scale the amount to scale b's elements by before adding
+ */
+GLM_API void mat3_multiplyScalarAndAddTo(float *GLM_RESTRICT out, mat3 a, mat3 b, float scale);
 
 #endif
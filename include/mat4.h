@@ -1,22 +1,37 @@
 #ifndef MAT4_H
 #define MAT4_H
 
+#include <stddef.h>
 #include <stdint.h>
+#include "api.h"
 #include "typedefs.h"
 
+/**
+ * Matrix kinds reported by mat4_classify, from the most general to the
+ * most specific. Every kind is also a valid instance of the kinds before
+ * it, so callers can test with >=, e.g. kind >= MAT4_AFFINE.
+ */
+typedef enum {
+    MAT4_GENERAL,       // projective, last row is not (0, 0, 0, 1)
+    MAT4_AFFINE,        // last row is (0, 0, 0, 1)
+    MAT4_RIGID,         // affine with an orthonormal upper 3x3
+    MAT4_TRANSLATION,   // affine with an identity upper 3x3
+    MAT4_IDENTITY
+} mat4_kind;
+
 /**
  * Print a mat4 matrix to stderr
  *
  * @param {mat4} the matrix to dump
  */
-void mat4_dump(mat4 dst);
+GLM_API void mat4_dump(mat4 dst);
 
 /**
  * Set a mat4 to the identity matrix
  *
  * @param {mat4} out the receiving matrix
  */
-void mat4_identity(mat4 dst);
+GLM_API void mat4_identity(mat4 dst);
 
 /**
  * Copy the values from one mat4 to another
@@ -24,7 +39,7 @@ void mat4_identity(mat4 dst);
  * @param {mat4} out the receiving matrix
  * @param {mat4} a the source matrix
  */
-void mat4_copy(mat4 dst, mat4 src);
+GLM_API void mat4_copy(mat4 dst, mat4 src);
 
 /**
  * Set the components of a mat4 to the given values
@@ -47,28 +62,45 @@ void mat4_copy(mat4 dst, mat4 src);
  * @param {Number} m32 Component in column 3, row 2 position (index 14)
  * @param {Number} m33 Component in column 3, row 3 position (index 15)
  */
-void mat4_set(mat4 dst, float m00, float m01, float m02, float m03, float m10, float m11, float m12, float m13, float m20, float m21, float m22, float m23, float m30, float m31, float m32, float m33);
+GLM_API void mat4_set(mat4 dst, float m00, float m01, float m02, float m03, float m10, float m11, float m12, float m13, float m20, float m21, float m22, float m23, float m30, float m31, float m32, float m33);
 
 /**
  * Transpose the values of a mat4
  *
  * @param {mat4} out the receiving matrix
  */
-void mat4_transpose(mat4 dst);
+GLM_API void mat4_transpose(mat4 dst);
 
 /**
  * Inverts a mat4
  *
  * @param {mat4} out the receiving matrix
  */
-void mat4_invert(mat4 dst);
+GLM_API void mat4_invert(mat4 dst);
+
+/**
+ * Inverts an affine mat4, ie. one whose last row is (0, 0, 0, 1).
+ * Only the upper 3x3 is inverted, the translation is rotated back.
+ * The matrix is left unchanged if it is singular.
+ *
+ * @param {mat4} out the receiving matrix
+ */
+GLM_API void mat4_invertAffine(mat4 dst);
+
+/**
+ * Inverts a rigid mat4 (rotation and translation only) by transposing
+ * its upper 3x3. The result is wrong if the matrix holds a scale or shear.
+ *
+ * @param {mat4} out the receiving matrix
+ */
+GLM_API void mat4_invertRigid(mat4 dst);
 
 /**
  * Calculates the adjugate of a mat4
  *
  * @param {mat4} out the receiving matrix
  */
-void mat4_adjoint(mat4 dst);
+GLM_API void mat4_adjoint(mat4 dst);
 
 /**
  * Calculates the determinant of a mat4
@@ -76,7 +108,7 @@ void mat4_adjoint(mat4 dst);
  * @param {mat4} a the source matrix
  * @returns {Number} determinant of a
  */
-float mat4_determinant(mat4 dst);
+GLM_API float mat4_determinant(mat4 dst);
 
 /**
  * Multiplies two mat4s
@@ -84,7 +116,26 @@ float mat4_determinant(mat4 dst);
  * @param {mat4} out the receiving matrix
  * @param {mat4} b the first operand
  */
-void mat4_multiply(mat4 dst, mat4 b);
+GLM_API void mat4_multiply(mat4 dst, mat4 b);
+
+/**
+ * Multiplies two affine mat4s, skipping the projective row.
+ * The last row of the result is always (0, 0, 0, 1).
+ *
+ * @param {mat4} out the receiving matrix
+ * @param {mat4} b the second operand
+ */
+GLM_API void mat4_multiplyAffine(mat4 dst, mat4 b);
+
+/**
+ * Finds the most specific kind of a mat4, see mat4_kind.
+ * The last row and the identity checks are exact, orthonormality is
+ * checked within EPSILON.
+ *
+ * @param {mat4} a the matrix to classify
+ * @returns {mat4_kind} kind of a
+ */
+GLM_API mat4_kind mat4_classify(mat4 a);
 
 /**
  * Translate a mat4 by the given vector
@@ -92,7 +143,7 @@ void mat4_multiply(mat4 dst, mat4 b);
  * @param {mat4} out the receiving matrix
  * @param {vec3} v vector to translate by
  */
-void mat4_translate(mat4 dst, vec3 v);
+GLM_API void mat4_translate(mat4 dst, vec3 v);
 
 /**
  * Translate a mat4 by the given flat 4 floats
@@ -102,7 +153,7 @@ void mat4_translate(mat4 dst, vec3 v);
  * @param {y} Y translation
  * @param {z} Z translation
  */
-void mat4_translatef(mat4 dst, float x, float y, float z);
+GLM_API void mat4_translatef(mat4 dst, float x, float y, float z);
 
 /**
  * Scales the mat4 by the dimensions in the given vec3 not using vectorization
@@ -110,7 +161,7 @@ void mat4_translatef(mat4 dst, float x, float y, float z);
  * @param {mat4} out the receiving matrix
  * @param {vec3} v the vec3 to scale the matrix by
  **/
-void mat4_scale(mat4 dst, vec3 v);
+GLM_API void mat4_scale(mat4 dst, vec3 v);
 
 /**
  * Rotates a mat4 by the given angle around the given axis
@@ -119,7 +170,7 @@ void mat4_scale(mat4 dst, vec3 v);
  * @param {Number} rad the angle to rotate the matrix by
  * @param {vec3} axis the axis to rotate around
  */
-void mat4_rotate(mat4 dst, float rad, vec3 axis);
+GLM_API void mat4_rotate(mat4 dst, float rad, vec3 axis);
 
 /**
  * Rotates a matrix by the given angle around the X axis
@@ -127,7 +178,7 @@ void mat4_rotate(mat4 dst, float rad, vec3 axis);
  * @param {mat4} out the receiving matrix
  * @param {Number} rad the angle to rotate the matrix by
  */
-void mat4_rotateX(mat4 dst, float rad);
+GLM_API void mat4_rotateX(mat4 dst, float rad);
 
 /**
  * Rotates a matrix by the given angle around the Y axis
@@ -135,7 +186,7 @@ void mat4_rotateX(mat4 dst, float rad);
  * @param {mat4} out the receiving matrix
  * @param {Number} rad the angle to rotate the matrix by
  */
-void mat4_rotateY(mat4 dst, float rad);
+GLM_API void mat4_rotateY(mat4 dst, float rad);
 
 /**
  * Rotates a matrix by the given angle around the Z axis
@@ -143,7 +194,7 @@ void mat4_rotateY(mat4 dst, float rad);
  * @param {mat4} out the receiving matrix
  * @param {Number} rad the angle to rotate the matrix by
  */
-void mat4_rotateZ(mat4 dst, float rad);
+GLM_API void mat4_rotateZ(mat4 dst, float rad);
 
 /**
  * Initializes a matrix from a vector translation
@@ -155,7 +206,7 @@ void mat4_rotateZ(mat4 dst, float rad);
  * @param {mat4} out mat4 receiving operation result
  * @param {vec3} v Translation vector
  */
-void mat4_fromTranslation(mat4 dst, vec3 v);
+GLM_API void mat4_fromTranslation(mat4 dst, vec3 v);
 
 /**
  * Initializes a matrix from a vector scaling
@@ -167,7 +218,7 @@ void mat4_fromTranslation(mat4 dst, vec3 v);
  * @param {mat4} out mat4 receiving operation result
  * @param {vec3} v Scaling vector
  */
-void mat4_fromScaling(mat4 dst, vec3 v);
+GLM_API void mat4_fromScaling(mat4 dst, vec3 v);
 
 /**
  * Initializes a matrix from a given angle around a given axis
@@ -180,7 +231,7 @@ void mat4_fromScaling(mat4 dst, vec3 v);
  * @param {Number} rad the angle to rotate the matrix by
  * @param {vec3} axis the axis to rotate around
  */
-void mat4_fromRotation(mat4 dst, float rad, vec3 axis);
+GLM_API void mat4_fromRotation(mat4 dst, float rad, vec3 axis);
 
 /**
  * Initializes a matrix from the given angle around the X axis
@@ -192,7 +243,7 @@ void mat4_fromRotation(mat4 dst, float rad, vec3 axis);
  * @param {mat4} out mat4 receiving operation result
  * @param {Number} rad the angle to rotate the matrix by
  */
-void mat4_fromXRotation(mat4 dst, float rad);
+GLM_API void mat4_fromXRotation(mat4 dst, float rad);
 
 /**
  * Initializes a matrix from the given angle around the Y axis
@@ -204,7 +255,7 @@ void mat4_fromXRotation(mat4 dst, float rad);
  * @param {mat4} out mat4 receiving operation result
  * @param {Number} rad the angle to rotate the matrix by
  */
-void mat4_fromYRotation(mat4 dst, float rad);
+GLM_API void mat4_fromYRotation(mat4 dst, float rad);
 
 /**
  * Initializes a matrix from the given angle around the Z axis
@@ -216,7 +267,7 @@ void mat4_fromYRotation(mat4 dst, float rad);
  * @param {mat4} out mat4 receiving operation result
  * @param {Number} rad the angle to rotate the matrix by
  */
-void mat4_fromZRotation(mat4 dst, float rad);
+GLM_API void mat4_fromZRotation(mat4 dst, float rad);
 
 /**
  * Initializes a matrix from a quaternion rotation and vector translation
@@ -232,7 +283,7 @@ void mat4_fromZRotation(mat4 dst, float rad);
  * @param {quat4} q Rotation quaternion
  * @param {vec3} v Translation vector
  */
-void mat4_fromRotationTranslation(mat4 dst, quat q, vec3 v);
+GLM_API void mat4_fromRotationTranslation(mat4 dst, quat q, vec3 v);
 
 /**
  * Returns the translation vector component of a transformation
@@ -242,7 +293,7 @@ void mat4_fromRotationTranslation(mat4 dst, quat q, vec3 v);
  * @param  {vec3} out Vector to receive translation component
  * @param  {mat4} mat Matrix to be decomposed (input)
  */
-void mat4_getTranslation(vec3 dst, mat4 mat);
+GLM_API void mat4_getTranslation(vec3 dst, mat4 mat);
 
 /**
  * Returns the scaling factor component of a transformation
@@ -253,7 +304,7 @@ void mat4_getTranslation(vec3 dst, mat4 mat);
  * @param  {vec3} out Vector to receive scaling factor component
  * @param  {mat4} mat Matrix to be decomposed (input)
  */
-void mat4_getScaling(vec3 dst, mat4 mat);
+GLM_API void mat4_getScaling(vec3 dst, mat4 mat);
 
 /**
  * Returns a quaternion representing the rotational component
@@ -263,7 +314,7 @@ void mat4_getScaling(vec3 dst, mat4 mat);
  * @param {quat} out Quaternion to receive the rotation component
  * @param {mat4} mat Matrix to be decomposed (input)
  */
-void mat4_getRotation(quat dst, mat4 mat);
+GLM_API void mat4_getRotation(quat dst, mat4 mat);
 
 /**
  * Initializes a matrix from a quaternion rotation, vector translation and vector scale
@@ -281,7 +332,7 @@ void mat4_getRotation(quat dst, mat4 mat);
  * @param {vec3} v Translation vector
  * @param {vec3} s Scaling vector
  */
-void mat4_fromRotationTranslationScale(mat4 dst, quat q, vec3 v, vec3 s);
+GLM_API void mat4_fromRotationTranslationScale(mat4 dst, quat q, vec3 v, vec3 s);
 
 /**
  * Initializes a matrix from a quaternion rotation, vector translation and vector scale, rotating and scaling around the given origin
@@ -302,7 +353,70 @@ void mat4_fromRotationTranslationScale(mat4 dst, quat q, vec3 v, vec3 s);
  * @param {vec3} s Scaling vector
  * @param {vec3} o The origin vector around which to scale and rotate
  */
-void mat4_fromRotationTranslationScaleOrigin(mat4 dst, quat q, vec3 v, vec3 s, vec3 o);
+GLM_API void mat4_fromRotationTranslationScaleOrigin(mat4 dst, quat q, vec3 v, vec3 s, vec3 o);
+
+/**
+ * Creates a matrix from euler angles, a vector translation and a vector
+ * scale, like mat4_fromRotationTranslationScale with the rotation of
+ * quat_fromEuler. This is equivalent to (but much faster than):
+ *
+ *     mat4_identity(dest);
+ *     mat4_translate(dest, v);
+ *     mat4_rotateZ(dest, z);
+ *     mat4_rotateY(dest, y);
+ *     mat4_rotateX(dest, x);
+ *     mat4_scale(dest, s);
+ *
+ * with x, y and z the angles converted from degrees to radians, so a camera
+ * or gizmo built with translate, rotateY (yaw) and rotateX (pitch) is
+ * written in a single pass. With GLM_FAST_TRIG and SSE the three sines and
+ * cosines are computed together.
+ *
+ * @param {mat4} out mat4 receiving operation result
+ * @param {vec3} euler Angles to rotate around the x, y and z axes, in degrees
+ * @param {vec3} v Translation vector
+ * @param {vec3} s Scaling vector
+ */
+GLM_API void mat4_fromEulerTranslationScale(mat4 dst, vec3 euler, vec3 v, vec3 s);
+
+/**
+ * Runs mat4_fromRotationTranslationScale on separate arrays of rotations,
+ * translations and scales, eg. the ones of a scene, and writes the
+ * column-major matrices into an instance buffer. If parent is given every
+ * matrix is premultiplied by it (parent * local).
+ *
+ * Meant for mapped GPU upload buffers: with SSE4/AVX2 4 instances are
+ * built per iteration. When dst and stride are multiples of 16 bytes and
+ * count * stride is over GLM_STREAM_THRESHOLD (1 MB by default, about an
+ * L2 cache), they are written with non-temporal stores that do not read
+ * the buffer into the cache; do not read such a dst back right away.
+ * Smaller buffers are written through the cache.
+ *
+ * @param {float[]} dst the receiving buffer, 16 floats per instance
+ * @param {Number} stride bytes from one instance to the next, 0 for 64
+ * @param {quat_v2[]} q Rotation quaternions
+ * @param {vec3[]} v Translation vectors
+ * @param {vec3[]} s Scaling vectors
+ * @param {Number} count number of instances
+ * @param {mat4} parent matrix applied to every instance, NULL for none
+ */
+GLM_API void mat4_fromRotationTranslationScale_array(float *dst, size_t stride, quat_v2 *q, vec3 *v, vec3 *s, size_t count, mat4 parent);
+
+/**
+ * Same as mat4_fromRotationTranslationScale_array, but writes the top
+ * three rows of every matrix, row after row (12 floats), the compact
+ * layout of instance and ray tracing transforms. The last row of parent
+ * is ignored, so it should be affine.
+ *
+ * @param {float[]} dst the receiving buffer, 12 floats per instance
+ * @param {Number} stride bytes from one instance to the next, 0 for 48
+ * @param {quat_v2[]} q Rotation quaternions
+ * @param {vec3[]} v Translation vectors
+ * @param {vec3[]} s Scaling vectors
+ * @param {Number} count number of instances
+ * @param {mat4} parent affine matrix applied to every instance, NULL for none
+ */
+GLM_API void mat4_fromRotationTranslationScale_array3x4(float *dst, size_t stride, quat_v2 *q, vec3 *v, vec3 *s, size_t count, mat4 parent);
 
 /**
  * Calculates a 4x4 matrix from the given quaternion
@@ -312,7 +426,7 @@ void mat4_fromRotationTranslationScaleOrigin(mat4 dst, quat q, vec3 v, vec3 s, v
  *
  * @returns {mat4} out
  */
-void mat4_fromQuat(mat4 dst, quat q);
+GLM_API void mat4_fromQuat(mat4 dst, quat q);
 
 /**
  * Generates a frustum matrix with the given bounds
@@ -325,7 +439,7 @@ void mat4_fromQuat(mat4 dst, quat q);
  * @param {Number} near Near bound of the frustum
  * @param {Number} far Far bound of the frustum
  */
-void mat4_frustum(mat4 dst, float left, float right, float bottom, float top, float near, float far);
+GLM_API void mat4_frustum(mat4 dst, float left, float right, float bottom, float top, float near, float far);
 
 /**
  * Generates a perspective projection matrix with the given bounds.
@@ -337,7 +451,7 @@ void mat4_frustum(mat4 dst, float left, float right, float bottom, float top, fl
  * @param {number} near Near bound of the frustum
  * @param {number} far Far bound of the frustum, can be 0 or FLT_MAX
  */
-void mat4_perspective(mat4 dst, float fovy, float aspect, float near, float far);
+GLM_API void mat4_perspective(mat4 dst, float fovy, float aspect, float near, float far);
 
 /**
  * Generates a orthogonal projection matrix with the given bounds
@@ -350,7 +464,7 @@ void mat4_perspective(mat4 dst, float fovy, float aspect, float near, float far)
  * @param {number} near Near bound of the frustum
  * @param {number} far Far bound of the frustum
  */
-void mat4_ortho(mat4 dst, float left, float right, float bottom, float top, float near, float far);
+GLM_API void mat4_ortho(mat4 dst, float left, float right, float bottom, float top, float near, float far);
 
 /**
  * Generates a look-at matrix with the given eye position, focal point, and up axis.
@@ -362,7 +476,7 @@ void mat4_ortho(mat4 dst, float left, float right, float bottom, float top, floa
  * @param {vec3} up vec3 pointing up
  * @returns {mat4} out
  */
-void mat4_lookAt(mat4 dst, vec3 eye, vec3 center, vec3 up);
+GLM_API void mat4_lookAt(mat4 dst, vec3 eye, vec3 center, vec3 up);
 
 /**
  * Generates a matrix that makes something look at something else.
@@ -373,7 +487,7 @@ void mat4_lookAt(mat4 dst, vec3 eye, vec3 center, vec3 up);
  * @param {vec3} up vec3 pointing up
  * @returns {mat4} out
  */
-void mat4_targetTo(mat4 dst, vec3 eye, vec3 target, vec3 up);
+GLM_API void mat4_targetTo(mat4 dst, vec3 eye, vec3 target, vec3 up);
 
 /**
  * Returns Frobenius norm of a mat4
@@ -381,7 +495,7 @@ void mat4_targetTo(mat4 dst, vec3 eye, vec3 target, vec3 up);
  * @param {mat4} a the matrix to calculate Frobenius norm of
  * @returns {Number} Frobenius norm
  */
-float mat4_frob(mat4 a);
+GLM_API float mat4_frob(mat4 a);
 
 /**
  * Adds two mat4's
@@ -389,7 +503,7 @@ float mat4_frob(mat4 a);
  * @param {mat4} out the receiving matrix
  * @param {mat4} b the second operand
  */
-void mat4_add(mat4 dst, mat4 b);
+GLM_API void mat4_add(mat4 dst, mat4 b);
 
 /**
  * Subtracts matrix b from matrix a
@@ -397,7 +511,7 @@ void mat4_add(mat4 dst, mat4 b);
  * @param {mat4} out the receiving matrix
  * @param {mat4} b the second operand
  */
-void mat4_subtract(mat4 dst, mat4 b);
+GLM_API void mat4_subtract(mat4 dst, mat4 b);
 
 /**
  * Multiply each element of the matrix by a scalar.
@@ -405,7 +519,7 @@ void mat4_subtract(mat4 dst, mat4 b);
  * @param {mat4} out the receiving matrix
  * @param {Number} b amount to scale the matrix's elements by
  */
-void mat4_multiplyScalar(mat4 dst, float b);
+GLM_API void mat4_multiplyScalar(mat4 dst, float b);
 
 /**
  * Adds two mat4's after multiplying each element of the second operand by a scalar value.
@@ -414,7 +528,7 @@ void mat4_multiplyScalar(mat4 dst, float b);
  * @param {mat4} b the second operand
  * @param {Number} scale the amount to scale b's elements by before adding
  */
-void mat4_multiplyScalarAndAdd(mat4 dst, mat4 b, float scale);
+GLM_API void mat4_multiplyScalarAndAdd(mat4 dst, mat4 b, float scale);
 
 /**
  * Returns whether or not the matrices have exactly the same elements.
@@ -423,6 +537,173 @@ void mat4_multiplyScalarAndAdd(mat4 dst, mat4 b, float scale);
  * @param {mat4} b The second matrix.
  * @returns {uint8_t} True if the matrices are equal, false otherwise.
  */
-uint8_t mat4_equals(mat4 a, mat4 b);
+GLM_API uint8_t mat4_equals(mat4 a, mat4 b);
+
+// Out-of-place variants, see GLM_RESTRICT in api.h
+
+/**
+ * Transpose the values of a mat4
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ */
+GLM_API void mat4_transposeTo(float *GLM_RESTRICT out, mat4 a);
+
+/**
+ * Inverts a mat4
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ */
+GLM_API void mat4_invertTo(float *GLM_RESTRICT out, mat4 a);
+
+/**
+ * Inverts an affine mat4, ie. one whose last row is (0, 0, 0, 1).
+ * Only the upper 3x3 is inverted, the translation is rotated back.
+ * a is copied to out if it is singular.
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ */
+GLM_API void mat4_invertAffineTo(float *GLM_RESTRICT out, mat4 a);
+
+/**
+ * Inverts a rigid mat4 (rotation and translation only) by transposing
+ * its upper 3x3. The result is wrong if the matrix holds a scale or shear.
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ */
+GLM_API void mat4_invertRigidTo(float *GLM_RESTRICT out, mat4 a);
+
+/**
+ * Calculates the adjugate of a mat4
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ */
+GLM_API void mat4_adjointTo(float *GLM_RESTRICT out, mat4 a);
+
+/**
+ * Multiplies two mat4s
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ * @param {mat4} b the first operand
+ */
+GLM_API void mat4_multiplyTo(float *GLM_RESTRICT out, mat4 a, mat4 b);
+
+/**
+ * Multiplies two affine mat4s, skipping the projective row.
+ * The last row of the result is always (0, 0, 0, 1).
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ * @param {mat4} b the second operand
+ */
+GLM_API void mat4_multiplyAffineTo(float *GLM_RESTRICT out, mat4 a, mat4 b);
+
+/**
+ * Translate a mat4 by the given vector
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ * @param {vec3} v vector to translate by
+ */
+GLM_API void mat4_translateTo(float *GLM_RESTRICT out, mat4 a, vec3 v);
+
+/**
+ * Translate a mat4 by the given flat 4 floats
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ * @param {x} X translation
+ * @param {y} Y translation
+ * @param {z} Z translation
+ */
+GLM_API void mat4_translatefTo(float *GLM_RESTRICT out, mat4 a, float x, float y, float z);
+
+/**
+ * Scales the mat4 by the dimensions in the given vec3 not using vectorization
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ * @param {vec3} v the vec3 to scale the matrix by
+ **/
+GLM_API void mat4_scaleTo(float *GLM_RESTRICT out, mat4 a, vec3 v);
+
+/**
+ * Rotates a mat4 by the given angle around the given axis
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ * @param {Number} rad the angle to rotate the matrix by
+ * @param {vec3} axis the axis to rotate around
+ */
+GLM_API void mat4_rotateTo(float *GLM_RESTRICT out, mat4 a, float rad, vec3 axis);
+
+/**
+ * Rotates a matrix by the given angle around the X axis
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ * @param {Number} rad the angle to rotate the matrix by
+ */
+GLM_API void mat4_rotateXTo(float *GLM_RESTRICT out, mat4 a, float rad);
+
+/**
+ * Rotates a matrix by the given angle around the Y axis
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ * @param {Number} rad the angle to rotate the matrix by
+ */
+GLM_API void mat4_rotateYTo(float *GLM_RESTRICT out, mat4 a, float rad);
+
+/**
+ * Rotates a matrix by the given angle around the Z axis
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ * @param {Number} rad the angle to rotate the matrix by
+ */
+GLM_API void mat4_rotateZTo(float *GLM_RESTRICT out, mat4 a, float rad);
+
+/**
+ * Adds two mat4's
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ * @param {mat4} b the second operand
+ */
+GLM_API void mat4_addTo(float *GLM_RESTRICT out, mat4 a, mat4 b);
+
+/**
+ * Subtracts matrix b from matrix a
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ * @param {mat4} b the second operand
+ */
+GLM_API void mat4_subtractTo(float *GLM_RESTRICT out, mat4 a, mat4 b);
+
+/**
+ * Multiply each element of the matrix by a scalar.
+ *
+ * @param {mat4} out the receiving matrix, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ * @param {Number} b amount to scale the matrix's elements by
+ */
+GLM_API void mat4_multiplyScalarTo(float *GLM_RESTRICT out, mat4 a, float b);
+
+/**
+ * Adds two mat4's after multiplying each element of the second operand by a scalar value.
+ *
+ * @param {mat4} out the receiving vector, must not overlap the other arguments
+ * @param {mat4} a the source matrix
+ * @param {mat4} b the second operand
+ * @param {Number} scale the amount to scale b's elements by before adding
+ */
+GLM_API void mat4_multiplyScalarAndAddTo(float *GLM_RESTRICT out, mat4 a, mat4 b, float scale);
 
 #endif
@@ -0,0 +1,103 @@
+#ifndef MAT4SOA_H
+#define MAT4SOA_H
+
+#include <stddef.h>
+#include "api.h"
+#include "typedefs.h"
+
+/**
+ * Number of matrices each element array is padded to
+ */
+#define MAT4SOA_PADDING 8
+
+/**
+ * Required alignment in bytes of the buffer given to mat4soa_init
+ */
+#define MAT4SOA_ALIGNMENT 32
+
+/**
+ * A batch of mat4's stored element-major: element e of matrix i is at
+ * m[e][i], so one SIMD register holds the same element of 4 or 8
+ * matrices and every operation runs one lane per matrix.
+ * Each element array is aligned to MAT4SOA_ALIGNMENT bytes and padded
+ * up to a multiple of MAT4SOA_PADDING. mat4soa_init zeroes the padding;
+ * padding lanes are then processed like any other matrix, so after any
+ * other operation their contents are unspecified.
+ *
+ * All operations expect both batches to have the same count.
+ */
+typedef struct {
+    float *m[16];
+    size_t count;
+} mat4soa;
+
+/**
+ * Returns the count rounded up to a multiple of MAT4SOA_PADDING
+ *
+ * @param {Number} count number of matrices
+ * @returns {Number} padded number of matrices
+ */
+GLM_API size_t mat4soa_paddedCount(size_t count);
+
+/**
+ * Returns the number of floats a buffer needs to hold count matrices
+ *
+ * @param {Number} count number of matrices
+ * @returns {Number} buffer size in floats
+ */
+GLM_API size_t mat4soa_bufferSize(size_t count);
+
+/**
+ * Sets up a mat4soa on top of a caller provided buffer and zeroes it.
+ * The buffer must be aligned to MAT4SOA_ALIGNMENT bytes and hold at
+ * least mat4soa_bufferSize(count) floats.
+ *
+ * @param {mat4soa} dst the batch to set up
+ * @param {float[]} buffer storage for the elements
+ * @param {Number} count number of matrices
+ */
+GLM_API void mat4soa_init(mat4soa *dst, float *buffer, size_t count);
+
+/**
+ * Copies an array of mat4's into a mat4soa
+ *
+ * @param {mat4soa} dst the receiving batch, dst->count matrices are read
+ * @param {mat4[]} src the source matrices
+ */
+GLM_API void mat4soa_fromMat4Array(mat4soa *dst, mat4 *src);
+
+/**
+ * Copies a mat4soa into an array of mat4's
+ *
+ * @param {mat4[]} dst the receiving array, must hold src->count matrices
+ * @param {mat4soa} src the source batch
+ */
+GLM_API void mat4soa_toMat4Array(mat4 *dst, mat4soa *src);
+
+/**
+ * Multiplies every matrix of dst by the matching matrix of b,
+ * like mat4_multiply
+ *
+ * @param {mat4soa} dst the receiving batch
+ * @param {mat4soa} b the second operands
+ */
+GLM_API void mat4soa_multiply(mat4soa *dst, mat4soa *b);
+
+/**
+ * Inverts every matrix of a batch, like mat4_invert.
+ * Singular matrices are left unchanged.
+ *
+ * @param {mat4soa} dst the receiving batch
+ */
+GLM_API void mat4soa_invert(mat4soa *dst);
+
+/**
+ * Calculates the determinant of every matrix of a batch
+ *
+ * @param {float[]} dst receives the determinants, must be aligned to
+ *                  MAT4SOA_ALIGNMENT bytes and hold mat4soa_paddedCount(a->count) floats
+ * @param {mat4soa} a the source batch
+ */
+GLM_API void mat4soa_determinant(float *dst, mat4soa *a);
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stddef.h>
+#include "typedefs.h"
+
+/**
+ * Parallel batch layer: a process wide pool of worker threads that split
+ * large array operations into chunks. Each call blocks until the whole
+ * range is processed, the calling thread works on chunks too.
+ *
+ * This module keeps global state, so it is part of the gl-matrix library
+ * only and is not pulled in by gl-matrix.h or available in GLM_C_INLINE
+ * mode. Until parallel_init is called, and on builds without pthreads,
+ * everything runs on the calling thread.
+ */
+
+/**
+ * Upper bound on the number of threads of the pool
+ */
+#define PARALLEL_MAX_THREADS 256
+
+/**
+ * Default minimum number of items handed to a thread at once
+ */
+#define PARALLEL_DEFAULT_CHUNK 4096
+
+/**
+ * Work function run on the range [begin, end) of a batch
+ */
+typedef void (*parallel_fn)(void *ctx, size_t begin, size_t end);
+
+/**
+ * Starts the thread pool. Calling it again resizes the pool.
+ *
+ * @param {Number} threads total number of threads including the caller,
+ *                 0 for the number of online CPUs
+ * @returns {Number} number of threads actually available
+ */
+size_t parallel_init(size_t threads);
+
+/**
+ * Stops and joins the worker threads
+ */
+void parallel_shutdown(void);
+
+/**
+ * Returns the number of threads work is split across, including the caller
+ *
+ * @returns {Number} thread count
+ */
+size_t parallel_threadCount(void);
+
+/**
+ * Sets the chunk size used when none is given, rounded up to a multiple
+ * of 8 so SIMD kernels see whole registers
+ *
+ * @param {Number} chunk minimum number of items per chunk, 0 restores the default
+ */
+void parallel_setChunkSize(size_t chunk);
+
+/**
+ * Runs fn over [0, count) split into chunks across the pool and returns
+ * once every chunk is done. Calls made from inside fn run serially.
+ *
+ * @param {Number} count number of items
+ * @param {Number} chunk number of items per chunk, 0 for the default
+ * @param {parallel_fn} fn function to run on each chunk
+ * @param {void*} ctx pointer passed through to fn
+ */
+void parallel_for(size_t count, size_t chunk, parallel_fn fn, void *ctx);
+
+/**
+ * Parallel version of vec3_transformMat4_array
+ *
+ * @param {vec3[]} dst the receiving vectors
+ * @param {vec3[]} src the vectors to transform
+ * @param {Number} count number of vectors
+ * @param {mat4} m matrix to transform with
+ */
+void parallel_vec3_transformMat4(vec3 *dst, vec3 *src, size_t count, mat4 m);
+
+/**
+ * Parallel version of vec3_transformMat3_array
+ *
+ * @param {vec3[]} dst the receiving vectors
+ * @param {vec3[]} src the vectors to transform
+ * @param {Number} count number of vectors
+ * @param {mat3} m the 3x3 matrix to transform with
+ */
+void parallel_vec3_transformMat3(vec3 *dst, vec3 *src, size_t count, mat3 m);
+
+/**
+ * Parallel version of vec3_transformQuat_array
+ *
+ * @param {vec3[]} dst the receiving vectors
+ * @param {vec3[]} src the vectors to transform
+ * @param {Number} count number of vectors
+ * @param {quat} q quaternion to transform with
+ */
+void parallel_vec3_transformQuat(vec3 *dst, vec3 *src, size_t count, quat q);
+
+/**
+ * Multiplies every mat4 of dst by the matching mat4 of b, ie.
+ * mat4_multiply(dst[i], b[i]) for each i
+ *
+ * @param {mat4[]} dst the receiving matrices
+ * @param {mat4[]} b the second operands
+ * @param {Number} count number of matrices
+ */
+void parallel_mat4_multiply(mat4 *dst, mat4 *b, size_t count);
+
+#endif
@@ -1,7 +1,9 @@
 #ifndef QUAT_H
 #define QUAT_H
 
+#include <stddef.h>
 #include <stdint.h>
+#include "api.h"
 #include "typedefs.h"
 
 /**
@@ -9,7 +11,7 @@
  *
  * @param {quat} out the receiving quaternion
  */
-void quat_identity(quat dst);
+GLM_API void quat_identity(quat dst);
 
 /**
  * Sets a quat from the given angle and rotation axis,
@@ -19,7 +21,7 @@ void quat_identity(quat dst);
  * @param {vec3} axis the axis around which to rotate
  * @param {Number} rad the angle in radians
  **/
-void quat_setAxisAngle(quat dst, vec3 axis, float rad);
+GLM_API void quat_setAxisAngle(quat dst, vec3 axis, float rad);
 
 /**
  * Gets the rotation axis and angle for a given
@@ -34,7 +36,7 @@ void quat_setAxisAngle(quat dst, vec3 axis, float rad);
  * @param  {quat} q     Quaternion to be decomposed
  * @return {Number}     Angle, in radians, of the rotation
  */
-float quat_getAxisAngle(vec3 out_axis, quat q);
+GLM_API float quat_getAxisAngle(vec3 out_axis, quat q);
 
 /**
  * Multiplies two quat's
@@ -42,7 +44,7 @@ float quat_getAxisAngle(vec3 out_axis, quat q);
  * @param {quat} out the receiving quaternion
  * @param {quat} b the second operand
  */
-void quat_multiply(quat dst, quat b);
+GLM_API void quat_multiply(quat dst, quat b);
 
 /**
  * Rotates a quaternion by the given angle about the X axis
@@ -50,7 +52,7 @@ void quat_multiply(quat dst, quat b);
  * @param {quat} out quat receiving operation result
  * @param {number} rad angle (in radians) to rotate
  */
-void quat_rotateX(quat dst, float rad);
+GLM_API void quat_rotateX(quat dst, float rad);
 
 /**
  * Rotates a quaternion by the given angle about the Y axis
@@ -58,7 +60,7 @@ void quat_rotateX(quat dst, float rad);
  * @param {quat} out quat receiving operation result
  * @param {number} rad angle (in radians) to rotate
  */
-void quat_rotateY(quat dst, float rad);
+GLM_API void quat_rotateY(quat dst, float rad);
 
 /**
  * Rotates a quaternion by the given angle about the Z axis
@@ -66,7 +68,7 @@ void quat_rotateY(quat dst, float rad);
  * @param {quat} out quat receiving operation result
  * @param {number} rad angle (in radians) to rotate
  */
-void quat_rotateZ(quat dst, float rad);
+GLM_API void quat_rotateZ(quat dst, float rad);
 
 /**
  * Calculates the W component of a quat from the X, Y, and Z components.
@@ -75,7 +77,7 @@ void quat_rotateZ(quat dst, float rad);
  *
  * @param {quat} out the receiving quaternion
  */
-void quat_calculateW(quat dst);
+GLM_API void quat_calculateW(quat dst);
 
 /**
  * Performs a spherical linear interpolation between two quat
@@ -84,14 +86,39 @@ void quat_calculateW(quat dst);
  * @param {quat} b the second operand
  * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
  */
-void quat_slerp(quat dst, quat b, float t);
+GLM_API void quat_slerp(quat dst, quat b, float t);
+
+/**
+ * Performs a normalized linear interpolation between two quat along the
+ * shortest path. Much cheaper than quat_slerp but does not move at a
+ * constant angular speed: the rotation is off by up to 0.14 radians
+ * (8 degrees) when the inputs are 180 degrees apart, less when they are
+ * closer.
+ *
+ * @param {quat} out the receiving quaternion
+ * @param {quat} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_nlerp(quat dst, quat b, float t);
+
+/**
+ * Performs a spherical linear interpolation between two unit quat with a
+ * polynomial instead of trigonometric functions. For t in [0-1] the
+ * rotation is within 6e-5 radians (0.004 degrees) of quat_slerp and the
+ * length within 3e-5 of 1.
+ *
+ * @param {quat} out the receiving quaternion
+ * @param {quat} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_slerpFast(quat dst, quat b, float t);
 
 /**
  * Calculates the inverse of a quat
  *
  * @param {quat} out the receiving quaternion
  */
-void quat_invert(quat dst);
+GLM_API void quat_invert(quat dst);
 
 /**
  * Calculates the conjugate of a quat
@@ -100,7 +127,7 @@ void quat_invert(quat dst);
  * @param {quat} out the receiving quaternion
  * @param {quat} a quat to calculate conjugate of
  */
-void quat_conjugate(quat dst);
+GLM_API void quat_conjugate(quat dst);
 
 /**
  * Creates a quaternion from the given 3x3 rotation matrix.
@@ -111,7 +138,7 @@ void quat_conjugate(quat dst);
  * @param {quat} out the receiving quaternion
  * @param {mat3} m rotation matrix
  */
-void quat_fromMat3(quat dst, mat3 m);
+GLM_API void quat_fromMat3(quat dst, mat3 m);
 
 /**
  * Creates a quaternion from the given euler angle x, y, z.
@@ -121,6 +148,158 @@ void quat_fromMat3(quat dst, mat3 m);
  * @param {y} Angle to rotate around Y axis in degrees.
  * @param {z} Angle to rotate around Z axis in degrees.
  */
-void quat_fromEuler(quat dst, float x, float y, float z);
+GLM_API void quat_fromEuler(quat dst, float x, float y, float z);
+
+
+/**
+ * Copies an array of version 1 (16 float) quaternions into
+ * an array of packed version 2 (4 float) quaternions.
+ *
+ * @param {quat_v2[]} dst the receiving array
+ * @param {quat_v1[]} src the quaternions to pack
+ * @param {Number} count number of quaternions
+ */
+GLM_API void quat_packArray(quat_v2 *dst, quat_v1 *src, size_t count);
+
+/**
+ * Copies an array of packed version 2 (4 float) quaternions into
+ * an array of version 1 (16 float) quaternions.
+ * Components 4 to 15 of the receiving quaternions are left untouched.
+ *
+ * @param {quat_v1[]} dst the receiving array
+ * @param {quat_v2[]} src the quaternions to unpack
+ * @param {Number} count number of quaternions
+ */
+GLM_API void quat_unpackArray(quat_v1 *dst, quat_v2 *src, size_t count);
+
+/**
+ * Interpolates every quat of an array towards the matching quat of a
+ * second array with quat_nlerp, eg. to blend two poses.
+ *
+ * @param {quat_v2[]} dst the receiving array
+ * @param {quat_v2[]} b the second operands, may be the same array as dst
+ * @param {Number} count number of quaternions
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_nlerp_array(quat_v2 *dst, quat_v2 *b, size_t count, float t);
+
+/**
+ * Interpolates every quat of an array towards the matching quat of a
+ * second array with quat_slerpFast, eg. to blend two poses.
+ *
+ * @param {quat_v2[]} dst the receiving array
+ * @param {quat_v2[]} b the second operands, may be the same array as dst
+ * @param {Number} count number of quaternions
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_slerpFast_array(quat_v2 *dst, quat_v2 *b, size_t count, float t);
+
+/**
+ * Creates an array of quaternions from euler angles like quat_fromEuler,
+ * computing the sines and cosines of 4 or 8 angles at once with the fast
+ * sincos (absolute error below 1e-7) whatever GLM_FAST_TRIG is set to.
+ *
+ * @param {quat_v2[]} dst the receiving array
+ * @param {vec3[]} euler angles around the X, Y and Z axis in degrees
+ * @param {Number} count number of quaternions
+ */
+GLM_API void quat_fromEuler_array(quat_v2 *dst, vec3 *euler, size_t count);
+
+// Out-of-place variants, see GLM_RESTRICT in api.h
+
+/**
+ * Multiplies two quat's
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {quat} b the second operand
+ */
+GLM_API void quat_multiplyTo(float *GLM_RESTRICT out, quat a, quat b);
+
+/**
+ * Rotates a quaternion by the given angle about the X axis
+ *
+ * @param {quat} out quat receiving operation result, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {number} rad angle (in radians) to rotate
+ */
+GLM_API void quat_rotateXTo(float *GLM_RESTRICT out, quat a, float rad);
+
+/**
+ * Rotates a quaternion by the given angle about the Y axis
+ *
+ * @param {quat} out quat receiving operation result, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {number} rad angle (in radians) to rotate
+ */
+GLM_API void quat_rotateYTo(float *GLM_RESTRICT out, quat a, float rad);
+
+/**
+ * Rotates a quaternion by the given angle about the Z axis
+ *
+ * @param {quat} out quat receiving operation result, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {number} rad angle (in radians) to rotate
+ */
+GLM_API void quat_rotateZTo(float *GLM_RESTRICT out, quat a, float rad);
+
+/**
+ * Calculates the W component of a quat from the X, Y, and Z components.
+ * Assumes that quaternion is 1 unit in length.
+ * Any existing W component will be ignored.
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ */
+GLM_API void quat_calculateWTo(float *GLM_RESTRICT out, quat a);
+
+/**
+ * Performs a spherical linear interpolation between two quat
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {quat} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_slerpTo(float *GLM_RESTRICT out, quat a, quat b, float t);
+
+/**
+ * Performs a normalized linear interpolation between two quat, see quat_nlerp
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {quat} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_nlerpTo(float *GLM_RESTRICT out, quat a, quat b, float t);
+
+/**
+ * Performs an approximate spherical linear interpolation between two
+ * unit quat, see quat_slerpFast
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {quat} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_slerpFastTo(float *GLM_RESTRICT out, quat a, quat b, float t);
+
+/**
+ * Calculates the inverse of a quat
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ */
+GLM_API void quat_invertTo(float *GLM_RESTRICT out, quat a);
+
+/**
+ * Calculates the conjugate of a quat
+ * If the quaternion is normalized, this function is faster than quat.inverse and produces the same result.
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {quat} a quat to calculate conjugate of
+ */
+GLM_API void quat_conjugateTo(float *GLM_RESTRICT out, quat a);
 
 #endif
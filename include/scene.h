@@ -0,0 +1,98 @@
+#ifndef SCENE_H
+#define SCENE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "api.h"
+#include "typedefs.h"
+
+/**
+ * A transform hierarchy stored as flat arrays, one entry per node.
+ * Nodes must be sorted topologically: the parent of node i is either -1
+ * (a root) or an index lower than i, so a single forward pass sees every
+ * parent before its children.
+ *
+ * The local transform of each node is kept as rotation, translation and
+ * scale; world receives the composed world matrices. All arrays are owned
+ * by the caller and must hold count entries.
+ */
+typedef struct {
+    int32_t *parent;
+    quat_v2 *rotation;
+    vec3 *translation;
+    vec3 *scale;
+    mat4 *world;
+    uint8_t *dirty;
+    size_t count;
+} scene;
+
+/**
+ * Sets up a scene on top of caller provided arrays. Every node is reset
+ * to an identity root and marked dirty.
+ *
+ * @param {scene} dst the scene to set up
+ * @param {int32_t[]} parent storage for the parent indices
+ * @param {quat_v2[]} rotation storage for the local rotations
+ * @param {vec3[]} translation storage for the local translations
+ * @param {vec3[]} scale storage for the local scales
+ * @param {mat4[]} world storage for the world matrices
+ * @param {uint8_t[]} dirty storage for the dirty flags
+ * @param {Number} count number of nodes
+ */
+GLM_API void scene_init(scene *dst, int32_t *parent, quat_v2 *rotation, vec3 *translation, vec3 *scale, mat4 *world, uint8_t *dirty, size_t count);
+
+/**
+ * Sets the parent of a node and marks it dirty
+ *
+ * @param {scene} dst the scene to modify
+ * @param {Number} node index of the node
+ * @param {Number} parent index of the parent, lower than node, or -1 for a root
+ */
+GLM_API void scene_setParent(scene *dst, size_t node, int32_t parent);
+
+/**
+ * Sets the local rotation of a node and marks it dirty
+ *
+ * @param {scene} dst the scene to modify
+ * @param {Number} node index of the node
+ * @param {quat} q rotation quaternion
+ */
+GLM_API void scene_setRotation(scene *dst, size_t node, quat q);
+
+/**
+ * Sets the local translation of a node and marks it dirty
+ *
+ * @param {scene} dst the scene to modify
+ * @param {Number} node index of the node
+ * @param {vec3} v translation vector
+ */
+GLM_API void scene_setTranslation(scene *dst, size_t node, vec3 v);
+
+/**
+ * Sets the local scale of a node and marks it dirty
+ *
+ * @param {scene} dst the scene to modify
+ * @param {Number} node index of the node
+ * @param {vec3} s scaling vector
+ */
+GLM_API void scene_setScale(scene *dst, size_t node, vec3 s);
+
+/**
+ * Marks a node dirty after its local transform was written directly
+ *
+ * @param {scene} dst the scene to modify
+ * @param {Number} node index of the node
+ */
+GLM_API void scene_markDirty(scene *dst, size_t node);
+
+/**
+ * Recomputes the world matrix of every dirty node and of all their
+ * descendants in one pass over the arrays, then clears the dirty flags.
+ * Clean subtrees are skipped.
+ *
+ * @param {scene} dst the scene to update
+ * @returns {Number} number of world matrices recomputed
+ */
+GLM_API size_t scene_update(scene *dst);
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef SKIN_H
+#define SKIN_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "api.h"
+#include "typedefs.h"
+
+/**
+ * Number of bones that can influence one vertex
+ */
+#define SKIN_INFLUENCES 4
+
+/**
+ * Linear blend skinning: blends the palette matrices of every vertex with
+ * its weights and transforms the vertex position and normal with the
+ * result, in one pass over the vertices. Normals are transformed by the
+ * upper 3x3 of the blended matrix and renormalized, so palettes with
+ * non-uniform scale skew them. Only the upper 3 rows of the palette
+ * matrices are used.
+ *
+ * Every vertex has SKIN_INFLUENCES joint indices and weights. Unused
+ * influences need a weight of 0 and a valid joint index, eg. 0.
+ *
+ * @param {vec3[]} dstPositions receives the skinned positions, may be the same array as positions
+ * @param {vec3[]} dstNormals receives the skinned normals, may be the same array as normals, NULL to skip normals
+ * @param {vec3[]} positions the bind pose positions
+ * @param {vec3[]} normals the bind pose normals, NULL to skip normals
+ * @param {uint16_t[]} joints SKIN_INFLUENCES palette indices per vertex
+ * @param {vec4[]} weights the weights of the joints, summing up to 1
+ * @param {Number} count number of vertices
+ * @param {mat4[]} palette the skinning matrices, ie. joint world matrix times inverse bind matrix
+ */
+GLM_API void skin_linearBlend(vec3 *dstPositions, vec3 *dstNormals, vec3 *positions, vec3 *normals, uint16_t *joints, vec4 *weights, size_t count, mat4 *palette);
+
+/**
+ * Dual quaternion skinning: blends the palette dquats of every vertex with
+ * dquat_blend and transforms the vertex position and normal with the
+ * result, in one pass over the vertices. Blends 8 floats per influence
+ * instead of 12 and keeps the volume around twisting joints, but the
+ * palette can only hold rotations and translations.
+ *
+ * Joints and weights are laid out as for skin_linearBlend.
+ *
+ * @param {vec3[]} dstPositions receives the skinned positions, may be the same array as positions
+ * @param {vec3[]} dstNormals receives the skinned normals, may be the same array as normals, NULL to skip normals
+ * @param {vec3[]} positions the bind pose positions
+ * @param {vec3[]} normals the bind pose normals, NULL to skip normals
+ * @param {uint16_t[]} joints SKIN_INFLUENCES palette indices per vertex
+ * @param {vec4[]} weights the weights of the joints, summing up to 1
+ * @param {Number} count number of vertices
+ * @param {dquat[]} palette the skinning transforms, normalized
+ */
+GLM_API void skin_dualQuat(vec3 *dstPositions, vec3 *dstNormals, vec3 *positions, vec3 *normals, uint16_t *joints, vec4 *weights, size_t count, dquat *palette);
+
+#endif
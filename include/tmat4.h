@@ -0,0 +1,207 @@
+#ifndef TMAT4_H
+#define TMAT4_H
+
+#include <stddef.h>
+#include "api.h"
+#include "typedefs.h"
+
+/**
+ * Structure known about the matrix of a tmat4, as a combination of bits.
+ * A bit that is set guarantees the property; a missing bit only means it
+ * is not known, so 0 (TMAT4_GENERAL) is always valid.
+ */
+enum {
+    TMAT4_GENERAL = 0,
+    TMAT4_AFFINE = 1,       // last row is (0, 0, 0, 1)
+    TMAT4_ORTHONORMAL = 2,  // upper 3x3 is orthonormal (a rotation, maybe mirrored)
+    TMAT4_DIAGONAL = 4,     // upper 3x3 is diagonal (a scale)
+
+    TMAT4_RIGID = TMAT4_AFFINE | TMAT4_ORTHONORMAL,
+    TMAT4_SCALE = TMAT4_AFFINE | TMAT4_DIAGONAL,
+    TMAT4_TRANSLATION = TMAT4_AFFINE | TMAT4_ORTHONORMAL | TMAT4_DIAGONAL
+};
+
+/**
+ * A mat4 tagged with what is known about its structure. The tmat4
+ * builders set the tag, and multiply, invert and transform use it to pick
+ * a kernel that skips the terms known to be zero. The tag follows the
+ * matrix through composition, so a chain of translations, rotations and
+ * scales never pays for the projective row.
+ *
+ * m is a regular mat4 and can be passed to every mat4 function for
+ * reading. Set kind again (or use tmat4_fromMat4) after changing m
+ * through them.
+ */
+typedef struct {
+    mat4 m;
+    int kind;
+} tmat4;
+
+/**
+ * Set a tmat4 to the identity matrix
+ *
+ * @param {tmat4} out the receiving matrix
+ */
+GLM_API void tmat4_identity(tmat4 *dst);
+
+/**
+ * Copies a mat4 into a tmat4 and finds its kind. The last row and the
+ * zeros of a diagonal are checked exactly, orthonormality within EPSILON
+ * like mat4_classify.
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {mat4} m the matrix to copy
+ */
+GLM_API void tmat4_fromMat4(tmat4 *dst, mat4 m);
+
+/**
+ * Creates a tmat4 from a vector translation, see mat4_fromTranslation
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {vec3} v Translation vector
+ */
+GLM_API void tmat4_fromTranslation(tmat4 *dst, vec3 v);
+
+/**
+ * Creates a tmat4 from a vector scaling, see mat4_fromScaling
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {vec3} v Scaling vector
+ */
+GLM_API void tmat4_fromScaling(tmat4 *dst, vec3 v);
+
+/**
+ * Creates a tmat4 from a unit quaternion rotation, see mat4_fromQuat
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {quat} q Rotation quaternion
+ */
+GLM_API void tmat4_fromQuat(tmat4 *dst, quat q);
+
+/**
+ * Creates a tmat4 from a unit quaternion rotation and vector translation,
+ * see mat4_fromRotationTranslation
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {quat} q Rotation quaternion
+ * @param {vec3} v Translation vector
+ */
+GLM_API void tmat4_fromRotationTranslation(tmat4 *dst, quat q, vec3 v);
+
+/**
+ * Creates a tmat4 from a quaternion rotation, vector translation and
+ * vector scale, see mat4_fromRotationTranslationScale
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {quat} q Rotation quaternion
+ * @param {vec3} v Translation vector
+ * @param {vec3} s Scaling vector
+ */
+GLM_API void tmat4_fromRotationTranslationScale(tmat4 *dst, quat q, vec3 v, vec3 s);
+
+/**
+ * Generates a perspective projection tmat4, see mat4_perspective
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {number} fovy Vertical field of view in radians
+ * @param {number} aspect Aspect ratio. typically viewport width/height
+ * @param {number} near Near bound of the frustum
+ * @param {number} far Far bound of the frustum, 0 or FLT_MAX for infinite
+ */
+GLM_API void tmat4_perspective(tmat4 *dst, float fovy, float aspect, float near, float far);
+
+/**
+ * Generates an orthogonal projection tmat4, see mat4_ortho
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {number} left Left bound of the frustum
+ * @param {number} right Right bound of the frustum
+ * @param {number} bottom Bottom bound of the frustum
+ * @param {number} top Top bound of the frustum
+ * @param {number} near Near bound of the frustum
+ * @param {number} far Far bound of the frustum
+ */
+GLM_API void tmat4_ortho(tmat4 *dst, float left, float right, float bottom, float top, float near, float far);
+
+/**
+ * Generates a look-at view tmat4, see mat4_lookAt
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {vec3} eye Position of the viewer
+ * @param {vec3} center Point the viewer is looking at
+ * @param {vec3} up vec3 pointing up
+ */
+GLM_API void tmat4_lookAt(tmat4 *dst, vec3 eye, vec3 center, vec3 up);
+
+/**
+ * Multiplies two tmat4s, dst = dst * b, with the cheapest kernel their
+ * kinds allow:
+ * - dst a scale and translation: each row of b is scaled, 24 multiplies
+ * - b a scale and translation: each column of dst is scaled, 24 multiplies
+ * - dst a projection with a diagonal upper 3x3: 40 multiplies
+ * - both affine: mat4_multiplyAffine
+ * - otherwise mat4_multiply
+ * The result keeps the bits both operands have when b is affine, and is
+ * TMAT4_GENERAL otherwise.
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {tmat4} b the second operand, may be the same as out
+ */
+GLM_API void tmat4_multiply(tmat4 *dst, tmat4 *b);
+
+/**
+ * Inverts a tmat4 with the cheapest kernel its kind allows: reciprocals
+ * for a scale and translation, mat4_invertRigid, mat4_invertAffine or
+ * mat4_invert. The matrix is left unchanged if it is singular.
+ *
+ * @param {tmat4} out the receiving matrix
+ */
+GLM_API void tmat4_invert(tmat4 *dst);
+
+/**
+ * Translate a tmat4 by the given vector, see mat4_translate. Keeps the kind.
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {vec3} v vector to translate by
+ */
+GLM_API void tmat4_translate(tmat4 *dst, vec3 v);
+
+/**
+ * Scales the tmat4 by the dimensions in the given vec3, see mat4_scale.
+ * The matrix is no longer known to be orthonormal.
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {vec3} v the vec3 to scale the matrix by
+ */
+GLM_API void tmat4_scale(tmat4 *dst, vec3 v);
+
+/**
+ * Rotates a tmat4 by the given angle around the given axis, see
+ * mat4_rotate. The matrix is no longer known to be diagonal.
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {Number} rad the angle to rotate the matrix by
+ * @param {vec3} axis the axis to rotate around
+ */
+GLM_API void tmat4_rotate(tmat4 *dst, float rad, vec3 axis);
+
+/**
+ * Transforms the vec3 with a tmat4. Like vec3_transformMat4, but affine
+ * matrices skip the w divide and scales only take 3 multiply-adds.
+ *
+ * @param {vec3} out the receiving vector
+ * @param {tmat4} m matrix to transform with
+ */
+GLM_API void vec3_transformTmat4(vec3 dst, tmat4 *m);
+
+/**
+ * Transforms an array of vec3's with a tmat4, see vec3_transformMat4_array.
+ *
+ * @param {vec3[]} dst the receiving array, may be the same array as src
+ * @param {vec3[]} src the vectors to transform
+ * @param {Number} count number of vectors
+ * @param {tmat4} m matrix to transform with
+ */
+GLM_API void vec3_transformTmat4_array(vec3 *dst, vec3 *src, size_t count, tmat4 *m);
+
+#endif
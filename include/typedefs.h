@@ -3,8 +3,86 @@
 typedef float mat2[4];
 typedef float mat3[9];
 typedef float mat4[16];
-typedef float quat[16];
 typedef float vec2[2];
 typedef float vec3[3];
 typedef float vec4[4];
+
+/*
+ * Quaternions only use their first four components. Version 1 of the
+ * library declared them as 16 floats, version 2 stores them in 16 bytes.
+ * Define GLM_QUAT_COMPAT before including any header to keep the old
+ * layout for quat. Functions taking a single quat work with both layouts;
+ * functions taking arrays of quaternions (quat_v2 *) expect the version 2
+ * layout, use quat_packArray/quat_unpackArray to convert old buffers.
+ */
+typedef float quat_v1[16];
+typedef float quat_v2[4];
+#ifdef GLM_QUAT_COMPAT
+#define GLM_QUAT_VERSION 1
+typedef quat_v1 quat;
+#else
+#define GLM_QUAT_VERSION 2
+typedef quat_v2 quat;
+#endif
+
+/*
+ * Dual quaternion: the real part (x, y, z, w) in the first four floats
+ * holds the rotation, the dual part (x, y, z, w) in the last four the
+ * translation, like quat2 of gl-matrix.js.
+ */
+typedef float dquat[8];
+
+/*
+ * View frustum: 6 planes (a, b, c, d) with normalized inward facing
+ * normals, in the order left, right, bottom, top, near, far. A point p is
+ * inside a plane when a * p.x + b * p.y + c * p.z + d >= 0.
+ */
+typedef vec4 frustum[6];
+
+/*
+ * Aligned storage variants of vec4, quat and mat4. They have the same
+ * layout and decay to the same float pointer, so they can be passed to
+ * every function taking the plain type, and the functions of aligned.h
+ * use aligned SIMD loads and stores on them. mat4a is aligned to a full
+ * AVX register, so none of its 16 or 32 byte loads splits a cache line.
+ * quata always has the version 2 layout.
+ */
+#if defined(_MSC_VER)
+#define GLM_ALIGNAS(n) __declspec(align(n))
+#else
+#define GLM_ALIGNAS(n) __attribute__((aligned(n)))
+#endif
+
+#if defined(__cplusplus)
+#define GLM_ALIGNOF(t) alignof(t)
+#define GLM_STATIC_ASSERT(cond, msg) static_assert(cond, msg)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define GLM_ALIGNOF(t) _Alignof(t)
+#define GLM_STATIC_ASSERT(cond, msg) _Static_assert(cond, msg)
+#else
+#if defined(_MSC_VER)
+#define GLM_ALIGNOF(t) __alignof(t)
+#else
+#define GLM_ALIGNOF(t) __alignof__(t)
+#endif
+#define GLM_STATIC_ASSERT_NAME2(line) glm_static_assert_##line
+#define GLM_STATIC_ASSERT_NAME(line) GLM_STATIC_ASSERT_NAME2(line)
+#define GLM_STATIC_ASSERT(cond, msg) typedef char GLM_STATIC_ASSERT_NAME(__LINE__)[(cond) ? 1 : -1]
+#endif
+
+#define GLM_VEC4A_ALIGNMENT 16
+#define GLM_QUATA_ALIGNMENT 16
+#define GLM_MAT4A_ALIGNMENT 32
+
+typedef GLM_ALIGNAS(GLM_VEC4A_ALIGNMENT) float vec4a[4];
+typedef GLM_ALIGNAS(GLM_QUATA_ALIGNMENT) float quata[4];
+typedef GLM_ALIGNAS(GLM_MAT4A_ALIGNMENT) float mat4a[16];
+
+GLM_STATIC_ASSERT(sizeof(vec4a) == sizeof(vec4), "vec4a must have the layout of vec4");
+GLM_STATIC_ASSERT(sizeof(quata) == sizeof(quat_v2), "quata must have the layout of quat_v2");
+GLM_STATIC_ASSERT(sizeof(mat4a) == sizeof(mat4), "mat4a must have the layout of mat4");
+GLM_STATIC_ASSERT(GLM_ALIGNOF(vec4a) == GLM_VEC4A_ALIGNMENT, "vec4a is not 16 byte aligned");
+GLM_STATIC_ASSERT(GLM_ALIGNOF(quata) == GLM_QUATA_ALIGNMENT, "quata is not 16 byte aligned");
+GLM_STATIC_ASSERT(GLM_ALIGNOF(mat4a) == GLM_MAT4A_ALIGNMENT, "mat4a is not 32 byte aligned");
+
 #endif
@@ -2,6 +2,7 @@
 #define VEC2_H
 
 #include <stdint.h>
+#include "api.h"
 #include "typedefs.h"
 
 /**
@@ -10,7 +11,7 @@
  * @param {vec2} out the receiving vector
  * @param {vec2} a the source vector
  */
-void vec2_copy(vec2 dst, vec2 a);
+GLM_API void vec2_copy(vec2 dst, vec2 a);
 
 /**
  * Set the components of a vec2 to the given values
@@ -19,7 +20,7 @@ void vec2_copy(vec2 dst, vec2 a);
  * @param {Number} x X component
  * @param {Number} y Y component
  */
-void vec2_set(vec2 dst, float x, float y);
+GLM_API void vec2_set(vec2 dst, float x, float y);
 
 /**
  * Adds two vec2's
@@ -27,7 +28,7 @@ void vec2_set(vec2 dst, float x, float y);
  * @param {vec2} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_add(vec2 dst, vec2 b);
+GLM_API void vec2_add(vec2 dst, vec2 b);
 
 /**
  * Subtracts vector b from vector a
@@ -35,7 +36,7 @@ void vec2_add(vec2 dst, vec2 b);
  * @param {vec2} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_subtract(vec2 dst, vec2 b);
+GLM_API void vec2_subtract(vec2 dst, vec2 b);
 
 /**
  * Multiplies two vec2's
@@ -43,7 +44,7 @@ void vec2_subtract(vec2 dst, vec2 b);
  * @param {vec2} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_multiply(vec2 dst, vec2 b);
+GLM_API void vec2_multiply(vec2 dst, vec2 b);
 
 /**
  * Divides two vec2's
@@ -51,21 +52,21 @@ void vec2_multiply(vec2 dst, vec2 b);
  * @param {vec2} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_divide(vec2 dst, vec2 b);
+GLM_API void vec2_divide(vec2 dst, vec2 b);
 
 /**
  * ceilf the components of a vec2
  *
  * @param {vec2} out the receiving vector
  */
-void vec2_ceil(vec2 dst);
+GLM_API void vec2_ceil(vec2 dst);
 
 /**
  * floorf the components of a vec2
  *
  * @param {vec2} out the receiving vector
  */
-void vec2_floor(vec2 dst);
+GLM_API void vec2_floor(vec2 dst);
 
 /**
  * Returns the minimum of two vec2's
@@ -73,7 +74,7 @@ void vec2_floor(vec2 dst);
  * @param {vec2} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_min(vec2 dst, vec2 b);
+GLM_API void vec2_min(vec2 dst, vec2 b);
 
 /**
  * Returns the maximum of two vec2's
@@ -81,14 +82,14 @@ void vec2_min(vec2 dst, vec2 b);
  * @param {vec2} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_max(vec2 dst, vec2 b);
+GLM_API void vec2_max(vec2 dst, vec2 b);
 
 /**
  * roundf the components of a vec2
  *
  * @param {vec2} out the receiving vector
  */
-void vec2_round(vec2 dst);
+GLM_API void vec2_round(vec2 dst);
 
 /**
  * Scales a vec2 by a scalar number
@@ -96,7 +97,7 @@ void vec2_round(vec2 dst);
  * @param {vec2} out the receiving vector
  * @param {Number} b amount to scale the vector by
  */
-void vec2_scale(vec2 dst, float b);
+GLM_API void vec2_scale(vec2 dst, float b);
 
 /**
  * Adds two vec2's after scaling the second operand by a scalar value
@@ -105,7 +106,7 @@ void vec2_scale(vec2 dst, float b);
  * @param {vec2} b the second operand
  * @param {Number} scale the amount to scale b by before adding
  */
-void vec2_scaleAndAdd(vec2 dst, vec2 b, float scale);
+GLM_API void vec2_scaleAndAdd(vec2 dst, vec2 b, float scale);
 
 /**
  * Calculates the euclidian distance between two vec2's
@@ -114,7 +115,7 @@ void vec2_scaleAndAdd(vec2 dst, vec2 b, float scale);
  * @param {vec2} b the second operand
  * @returns {Number} distance between a and b
  */
-float vec2_distance(vec2 a, vec2 b);
+GLM_API float vec2_distance(vec2 a, vec2 b);
 
 /**
  * Calculates the squared euclidian distance between two vec2's
@@ -123,7 +124,7 @@ float vec2_distance(vec2 a, vec2 b);
  * @param {vec2} b the second operand
  * @returns {Number} squared distance between a and b
  */
-float vec2_squaredDistance(vec2 a, vec2 b);
+GLM_API float vec2_squaredDistance(vec2 a, vec2 b);
 
 /**
  * Calculates the length of a vec2
@@ -131,7 +132,7 @@ float vec2_squaredDistance(vec2 a, vec2 b);
  * @param {vec2} a vector to calculate length of
  * @returns {Number} length of a
  */
-float vec2_length(vec2 a);
+GLM_API float vec2_length(vec2 a);
 
 /**
  * Calculates the squared length of a vec2
@@ -139,7 +140,7 @@ float vec2_length(vec2 a);
  * @param {vec2} a vector to calculate squared length of
  * @returns {Number} squared length of a
  */
-float vec2_squaredLength(vec2 a);
+GLM_API float vec2_squaredLength(vec2 a);
 
 /**
  * Negates the components of a vec2
@@ -148,21 +149,31 @@ float vec2_squaredLength(vec2 a);
  * @param {vec2} a vector to negate
  * @returns {vec2} out
  */
-void vec2_negate(vec2 dst);
+GLM_API void vec2_negate(vec2 dst);
 
 /**
  * Returns the inverse of the components of a vec2
  *
  * @param {vec2} out the receiving vector
  */
-void vec2_inverse(vec2 dst);
+GLM_API void vec2_inverse(vec2 dst);
 
 /**
  * Normalize a vec2
  *
  * @param {vec2} out the receiving vector
  */
-void vec2_normalize(vec2 dst);
+GLM_API void vec2_normalize(vec2 dst);
+
+/**
+ * Normalize a vec2 with the fast reciprocal square root: the hardware
+ * estimate and one Newton-Raphson step with SSE4/AVX2, within 2^-21
+ * relative of vec2_normalize. Plain C builds compute it exactly.
+ * Vectors with a squared length below FLT_MIN are left as they are.
+ *
+ * @param {vec2} out the receiving vector
+ */
+GLM_API void vec2_normalizeFast(vec2 dst);
 
 /**
  * Calculates the dot product of two vec2's
@@ -171,7 +182,7 @@ void vec2_normalize(vec2 dst);
  * @param {vec2} b the second operand
  * @returns {Number} dot product of a and b
  */
-float vec2_dot(vec2 a, vec2 b);
+GLM_API float vec2_dot(vec2 a, vec2 b);
 
 /**
  * Computes the cross product of two vec2's
@@ -180,7 +191,7 @@ float vec2_dot(vec2 a, vec2 b);
  * @param {vec3} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_cross(vec3 dst, vec2 b);
+GLM_API void vec2_cross(vec3 dst, vec2 b);
 
 /**
  * Performs a linear interpolation between two vec2's
@@ -189,7 +200,7 @@ void vec2_cross(vec3 dst, vec2 b);
  * @param {vec2} b the second operand
  * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
  */
-void vec2_lerp(vec2 dst, vec2 b, float t);
+GLM_API void vec2_lerp(vec2 dst, vec2 b, float t);
 
 /**
  * Transforms the vec2 with a mat2
@@ -197,7 +208,7 @@ void vec2_lerp(vec2 dst, vec2 b, float t);
  * @param {vec2} out the receiving vector
  * @param {mat2} m matrix to transform with
  */
-void vec2_transformMat2(vec2 dst, mat2 m);
+GLM_API void vec2_transformMat2(vec2 dst, mat2 m);
 
 /**
  * Transforms the vec2 with a mat2d
@@ -205,7 +216,7 @@ void vec2_transformMat2(vec2 dst, mat2 m);
  * @param {vec2} out the receiving vector
  * @param {mat2d} m matrix to transform with
  */
-void vec2_transformMat2d(vec2 dst, mat2 m);
+GLM_API void vec2_transformMat2d(vec2 dst, mat2 m);
 
 /**
  * Transforms the vec2 with a mat3
@@ -214,7 +225,7 @@ void vec2_transformMat2d(vec2 dst, mat2 m);
  * @param {vec2} out the receiving vector
  * @param {mat3} m matrix to transform with
  */
-void vec2_transformMat3(vec2 dst, mat3 m);
+GLM_API void vec2_transformMat3(vec2 dst, mat3 m);
 
 /**
  * Transforms the vec2 with a mat4
@@ -225,7 +236,7 @@ void vec2_transformMat3(vec2 dst, mat3 m);
  * @param {vec2} a the vector to transform
  * @param {mat4} m matrix to transform with
  */
-void vec2_transformMat4(vec2 dst, mat4 m);
+GLM_API void vec2_transformMat4(vec2 dst, mat4 m);
 
 /**
  * Rotate a 2D vector
@@ -233,7 +244,7 @@ void vec2_transformMat4(vec2 dst, mat4 m);
  * @param {vec2} b The origin of the rotation
  * @param {Number} c The angle of rotation
  */
-void vec2_rotate(vec2 dst, vec2 b, float c);
+GLM_API void vec2_rotate(vec2 dst, vec2 b, float c);
 
 /**
  * Get the angle between two 2D vectors
@@ -241,7 +252,7 @@ void vec2_rotate(vec2 dst, vec2 b, float c);
  * @param {vec2} b The second operand
  * @returns {Number} The angle in radians
  */
-float vec2_angle(vec2 a, vec2 b);
+GLM_API float vec2_angle(vec2 a, vec2 b);
 
 /**
  * Returns whether or not the vectors exactly have the same elements
@@ -250,6 +261,190 @@ float vec2_angle(vec2 a, vec2 b);
  * @param {vec2} b The second vector.
  * @returns {Boolean} True if the vectors are equal, false otherwise.
  */
-uint8_t vec2_exactEquals(vec2 a, vec2 b);
+GLM_API uint8_t vec2_exactEquals(vec2 a, vec2 b);
+
+// Out-of-place variants, see GLM_RESTRICT in api.h
+
+/**
+ * Adds two vec2's
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ */
+GLM_API void vec2_addTo(float *GLM_RESTRICT out, vec2 a, vec2 b);
+
+/**
+ * Subtracts vector b from vector a
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ */
+GLM_API void vec2_subtractTo(float *GLM_RESTRICT out, vec2 a, vec2 b);
+
+/**
+ * Multiplies two vec2's
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ */
+GLM_API void vec2_multiplyTo(float *GLM_RESTRICT out, vec2 a, vec2 b);
+
+/**
+ * Divides two vec2's
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ */
+GLM_API void vec2_divideTo(float *GLM_RESTRICT out, vec2 a, vec2 b);
+
+/**
+ * ceilf the components of a vec2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ */
+GLM_API void vec2_ceilTo(float *GLM_RESTRICT out, vec2 a);
+
+/**
+ * floorf the components of a vec2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ */
+GLM_API void vec2_floorTo(float *GLM_RESTRICT out, vec2 a);
+
+/**
+ * Returns the minimum of two vec2's
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ */
+GLM_API void vec2_minTo(float *GLM_RESTRICT out, vec2 a, vec2 b);
+
+/**
+ * Returns the maximum of two vec2's
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ */
+GLM_API void vec2_maxTo(float *GLM_RESTRICT out, vec2 a, vec2 b);
+
+/**
+ * roundf the components of a vec2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ */
+GLM_API void vec2_roundTo(float *GLM_RESTRICT out, vec2 a);
+
+/**
+ * Scales a vec2 by a scalar number
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {Number} b amount to scale the vector by
+ */
+GLM_API void vec2_scaleTo(float *GLM_RESTRICT out, vec2 a, float b);
+
+/**
+ * Adds two vec2's after scaling the second operand by a scalar value
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ * @param {Number} scale the amount to scale b by before adding
+ */
+GLM_API void vec2_scaleAndAddTo(float *GLM_RESTRICT out, vec2 a, vec2 b, float scale);
+
+/**
+ * Negates the components of a vec2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} a vector to negate
+ * @returns {vec2} out
+ */
+GLM_API void vec2_negateTo(float *GLM_RESTRICT out, vec2 a);
+
+/**
+ * Returns the inverse of the components of a vec2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ */
+GLM_API void vec2_inverseTo(float *GLM_RESTRICT out, vec2 a);
+
+/**
+ * Normalize a vec2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ */
+GLM_API void vec2_normalizeTo(float *GLM_RESTRICT out, vec2 a);
+
+/**
+ * Performs a linear interpolation between two vec2's
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void vec2_lerpTo(float *GLM_RESTRICT out, vec2 a, vec2 b, float t);
+
+/**
+ * Transforms the vec2 with a mat2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {mat2} m matrix to transform with
+ */
+GLM_API void vec2_transformMat2To(float *GLM_RESTRICT out, vec2 a, mat2 m);
+
+/**
+ * Transforms the vec2 with a mat2d
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {mat2d} m matrix to transform with, 6 floats (a, b, c, d, tx, ty)
+ */
+GLM_API void vec2_transformMat2dTo(float *GLM_RESTRICT out, vec2 a, const float *m);
+
+/**
+ * Transforms the vec2 with a mat3
+ * 3rd vector component is implicitly '1'
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {mat3} m matrix to transform with
+ */
+GLM_API void vec2_transformMat3To(float *GLM_RESTRICT out, vec2 a, mat3 m);
+
+/**
+ * Transforms the vec2 with a mat4
+ * 3rd vector component is implicitly '0'
+ * 4th vector component is implicitly '1'
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} a the vector to transform
+ * @param {mat4} m matrix to transform with
+ */
+GLM_API void vec2_transformMat4To(float *GLM_RESTRICT out, vec2 a, mat4 m);
+
+/**
+ * Rotate a 2D vector
+ * @param {vec2} out The receiving vec2, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b The origin of the rotation
+ * @param {Number} c The angle of rotation
+ */
+GLM_API void vec2_rotateTo(float *GLM_RESTRICT out, vec2 a, vec2 b, float c);
 
 #endif
@@ -1,7 +1,9 @@
 #ifndef VEC3_H
 #define VEC3_H
 
+#include <stddef.h>
 #include <stdint.h>
+#include "api.h"
 #include "typedefs.h"
 
 /**
@@ -10,7 +12,7 @@
  * @param {vec3} a vector to calculate length of
  * @returns {Number} length of a
  */
-float vec3_length(vec3 a);
+GLM_API float vec3_length(vec3 a);
 
 /**
  * Copy the values from one vec3 to another
@@ -18,7 +20,7 @@ float vec3_length(vec3 a);
  * @param {vec3} out the receiving vector
  * @param {vec3} a the source vector
  */
-void vec3_copy(vec3 dst, vec3 a);
+GLM_API void vec3_copy(vec3 dst, vec3 a);
 
 /**
  * Set the components of a vec3 to the given values
@@ -28,7 +30,7 @@ void vec3_copy(vec3 dst, vec3 a);
  * @param {Number} y Y component
  * @param {Number} z Z component
  */
-void vec3_set(vec3 dst, float x, float y, float z);
+GLM_API void vec3_set(vec3 dst, float x, float y, float z);
 
 /**
  * Adds two vec3's
@@ -36,7 +38,7 @@ void vec3_set(vec3 dst, float x, float y, float z);
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_add(vec3 dst, vec3 b);
+GLM_API void vec3_add(vec3 dst, vec3 b);
 
 /**
  * Subtracts vector b from vector a
@@ -44,7 +46,7 @@ void vec3_add(vec3 dst, vec3 b);
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_subtract(vec3 dst, vec3 b);
+GLM_API void vec3_subtract(vec3 dst, vec3 b);
 
 /**
  * Multiplies two vec3's
@@ -52,7 +54,7 @@ void vec3_subtract(vec3 dst, vec3 b);
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_multiply(vec3 dst, vec3 b);
+GLM_API void vec3_multiply(vec3 dst, vec3 b);
 
 /**
  * Divides two vec3's
@@ -60,21 +62,21 @@ void vec3_multiply(vec3 dst, vec3 b);
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_divide(vec3 dst, vec3 b);
+GLM_API void vec3_divide(vec3 dst, vec3 b);
 
 /**
  * Math.ceil the components of a vec3
  *
  * @param {vec3} out the receiving vector
  */
-void vec3_ceil(vec3 dst);
+GLM_API void vec3_ceil(vec3 dst);
 
 /**
  * Math.floor the components of a vec3
  *
  * @param {vec3} out the receiving vector
  */
-void vec3_floor(vec3 dst);
+GLM_API void vec3_floor(vec3 dst);
 
 /**
  * Returns the minimum of two vec3's
@@ -82,7 +84,7 @@ void vec3_floor(vec3 dst);
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_min(vec3 dst, vec3 b);
+GLM_API void vec3_min(vec3 dst, vec3 b);
 
 /**
  * Returns the maximum of two vec3's
@@ -90,14 +92,14 @@ void vec3_min(vec3 dst, vec3 b);
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_max(vec3 dst, vec3 b);
+GLM_API void vec3_max(vec3 dst, vec3 b);
 
 /**
  * Math.round the components of a vec3
  *
  * @param {vec3} out the receiving vector
  */
-void vec3_round(vec3 dst);
+GLM_API void vec3_round(vec3 dst);
 
 /**
  * Scales a vec3 by a scalar number
@@ -105,7 +107,7 @@ void vec3_round(vec3 dst);
  * @param {vec3} out the receiving vector
  * @param {Number} b amount to scale the vector by
  */
-void vec3_scale(vec3 dst, float b);
+GLM_API void vec3_scale(vec3 dst, float b);
 
 /**
  * Adds two vec3's after scaling the second operand by a scalar value
@@ -114,7 +116,7 @@ void vec3_scale(vec3 dst, float b);
  * @param {vec3} b the second operand
  * @param {Number} scale the amount to scale b by before adding
  */
-void vec3_scaleAndAdd(vec3 dst, vec3 b, float scale);
+GLM_API void vec3_scaleAndAdd(vec3 dst, vec3 b, float scale);
 
 /**
  * Calculates the euclidian distance between two vec3's
@@ -123,7 +125,7 @@ void vec3_scaleAndAdd(vec3 dst, vec3 b, float scale);
  * @param {vec3} b the second operand
  * @returns {Number} distance between a and b
  */
-float vec3_distance(vec3 a, vec3 b);
+GLM_API float vec3_distance(vec3 a, vec3 b);
 
 /**
  * Calculates the squared euclidian distance between two vec3's
@@ -132,7 +134,7 @@ float vec3_distance(vec3 a, vec3 b);
  * @param {vec3} b the second operand
  * @returns {Number} squared distance between a and b
  */
-float vec3_squaredDistance(vec3 a, vec3 b);
+GLM_API float vec3_squaredDistance(vec3 a, vec3 b);
 
 /**
  * Calculates the squared length of a vec3
@@ -140,28 +142,38 @@ float vec3_squaredDistance(vec3 a, vec3 b);
  * @param {vec3} a vector to calculate squared length of
  * @returns {Number} squared length of a
  */
-float vec3_squaredLength(vec3 a);
+GLM_API float vec3_squaredLength(vec3 a);
 
 /**
  * Negates the components of a vec3
  *
  * @param {vec3} out the receiving vector
  */
-void vec3_negate(vec3 dst);
+GLM_API void vec3_negate(vec3 dst);
 
 /**
  * Returns the inverse of the components of a vec3
  *
  * @param {vec3} out the receiving vector
  */
-void vec3_inverse(vec3 dst);
+GLM_API void vec3_inverse(vec3 dst);
 
 /**
  * Normalize a vec3
  *
  * @param {vec3} out the receiving vector
  */
-void vec3_normalize(vec3 dst);
+GLM_API void vec3_normalize(vec3 dst);
+
+/**
+ * Normalize a vec3 with the fast reciprocal square root: the hardware
+ * estimate and one Newton-Raphson step with SSE4/AVX2, within 2^-21
+ * relative of vec3_normalize. Plain C builds compute it exactly.
+ * Vectors with a squared length below FLT_MIN are left as they are.
+ *
+ * @param {vec3} out the receiving vector
+ */
+GLM_API void vec3_normalizeFast(vec3 dst);
 
 /**
  * Calculates the dot product of two vec3's
@@ -170,7 +182,7 @@ void vec3_normalize(vec3 dst);
  * @param {vec3} b the second operand
  * @returns {Number} dot product of a and b
  */
-float vec3_dot(vec3 a, vec3 b);
+GLM_API float vec3_dot(vec3 a, vec3 b);
 
 /**
  * Computes the cross product of two vec3's
@@ -178,7 +190,7 @@ float vec3_dot(vec3 a, vec3 b);
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_cross(vec3 dst, vec3 b);
+GLM_API void vec3_cross(vec3 dst, vec3 b);
 
 /**
  * Performs a linear interpolation between two vec3's
@@ -187,7 +199,7 @@ void vec3_cross(vec3 dst, vec3 b);
  * @param {vec3} b the second operand
  * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
  */
-void vec3_lerp(vec3 dst, vec3 b, float t);
+GLM_API void vec3_lerp(vec3 dst, vec3 b, float t);
 
 /**
  * Performs a hermite interpolation with two control points
@@ -198,7 +210,7 @@ void vec3_lerp(vec3 dst, vec3 b, float t);
  * @param {vec3} d the fourth operand
  * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
  */
-void vec3_hermite(vec3 dst, vec3 b, vec3 c, vec3 d, float t);
+GLM_API void vec3_hermite(vec3 dst, vec3 b, vec3 c, vec3 d, float t);
 
 /**
  * Performs a bezier interpolation with two control points
@@ -209,7 +221,7 @@ void vec3_hermite(vec3 dst, vec3 b, vec3 c, vec3 d, float t);
  * @param {vec3} d the fourth operand
  * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
  */
-void vec3_bezier(vec3 dst, vec3 b, vec3 c, vec3 d, float t);
+GLM_API void vec3_bezier(vec3 dst, vec3 b, vec3 c, vec3 d, float t);
 
 /**
  * Transforms the vec3 with a mat4.
@@ -218,7 +230,7 @@ void vec3_bezier(vec3 dst, vec3 b, vec3 c, vec3 d, float t);
  * @param {vec3} out the receiving vector
  * @param {mat4} m matrix to transform with
  */
-void vec3_transformMat4(vec3 dst, mat4 m);
+GLM_API void vec3_transformMat4(vec3 dst, mat4 m);
 
 /**
  * Transforms the vec3 with a mat3.
@@ -226,7 +238,7 @@ void vec3_transformMat4(vec3 dst, mat4 m);
  * @param {vec3} out the receiving vector
  * @param {mat3} m the 3x3 matrix to transform with
  */
-void vec3_transformMat3(vec3 dst, mat3 m);
+GLM_API void vec3_transformMat3(vec3 dst, mat3 m);
 
 /**
  * Transforms the vec3 with a quat
@@ -235,7 +247,7 @@ void vec3_transformMat3(vec3 dst, mat3 m);
  * @param {vec3} out the receiving vector
  * @param {quat} q quaternion to transform with
  */
-void vec3_transformQuat(vec3 dst, quat q);
+GLM_API void vec3_transformQuat(vec3 dst, quat q);
 
 /**
  * Rotate a 3D vector around the x-axis
@@ -243,7 +255,7 @@ void vec3_transformQuat(vec3 dst, quat q);
  * @param {vec3} b The origin of the rotation
  * @param {Number} c The angle of rotation
  */
-void vec3_rotateX(vec3 dst, vec3 b, float c);
+GLM_API void vec3_rotateX(vec3 dst, vec3 b, float c);
 
 /**
  * Rotate a 3D vector around the y-axis
@@ -251,7 +263,7 @@ void vec3_rotateX(vec3 dst, vec3 b, float c);
  * @param {vec3} b The origin of the rotation
  * @param {Number} c The angle of rotation
  */
-void vec3_rotateY(vec3 dst, vec3 b, float c);
+GLM_API void vec3_rotateY(vec3 dst, vec3 b, float c);
 
 /**
  * Rotate a 3D vector around the z-axis
@@ -259,7 +271,7 @@ void vec3_rotateY(vec3 dst, vec3 b, float c);
  * @param {vec3} b The origin of the rotation
  * @param {Number} c The angle of rotation
  */
-void vec3_rotateZ(vec3 dst, vec3 b, float c);
+GLM_API void vec3_rotateZ(vec3 dst, vec3 b, float c);
 
 /**
  * Get the angle between two 3D vectors
@@ -267,7 +279,7 @@ void vec3_rotateZ(vec3 dst, vec3 b, float c);
  * @param {vec3} b The second operand
  * @returns {Number} The angle in radians
  */
-float vec3_angle(vec3 a, vec3 b);
+GLM_API float vec3_angle(vec3 a, vec3 b);
 
 /**
  * Returns whether or not the vectors have exactly the same elements
@@ -276,6 +288,273 @@ float vec3_angle(vec3 a, vec3 b);
  * @param {vec3} b The second vector.
  * @returns {Boolean} True if the vectors are equal, false otherwise.
  */
-uint8_t vec3_equals(vec3 a, vec3 b);
+GLM_API uint8_t vec3_equals(vec3 a, vec3 b);
+
+/**
+ * Transforms an array of vec3's with a mat4.
+ * 4th vector component is implicitly '1'
+ * Gives the same result as calling vec3_transformMat4 on every element.
+ *
+ * @param {vec3[]} dst the receiving array, may be the same array as src
+ * @param {vec3[]} src the vectors to transform
+ * @param {Number} count number of vectors in src and dst
+ * @param {mat4} m matrix to transform with
+ */
+GLM_API void vec3_transformMat4_array(vec3 *dst, vec3 *src, size_t count, mat4 m);
+
+/**
+ * Transforms an array of vec3's with a mat3.
+ * Gives the same result as calling vec3_transformMat3 on every element.
+ *
+ * @param {vec3[]} dst the receiving array, may be the same array as src
+ * @param {vec3[]} src the vectors to transform
+ * @param {Number} count number of vectors in src and dst
+ * @param {mat3} m the 3x3 matrix to transform with
+ */
+GLM_API void vec3_transformMat3_array(vec3 *dst, vec3 *src, size_t count, mat3 m);
+
+/**
+ * Transforms an array of vec3's with a quat.
+ * Gives the same result as calling vec3_transformQuat on every element.
+ *
+ * @param {vec3[]} dst the receiving array, may be the same array as src
+ * @param {vec3[]} src the vectors to transform
+ * @param {Number} count number of vectors in src and dst
+ * @param {quat} q quaternion to transform with
+ */
+GLM_API void vec3_transformQuat_array(vec3 *dst, vec3 *src, size_t count, quat q);
+
+/**
+ * Normalizes an array of vec3's with the fast reciprocal square root.
+ * Matches vec3_normalizeFast on every element within its error bound,
+ * the SIMD kernels may round differently.
+ *
+ * @param {vec3[]} dst the receiving array, may be the same array as src
+ * @param {vec3[]} src the vectors to normalize
+ * @param {Number} count number of vectors in src and dst
+ */
+GLM_API void vec3_normalizeFast_array(vec3 *dst, vec3 *src, size_t count);
+
+// Out-of-place variants, see GLM_RESTRICT in api.h
+
+/**
+ * Adds two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_addTo(float *GLM_RESTRICT out, vec3 a, vec3 b);
+
+/**
+ * Subtracts vector b from vector a
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_subtractTo(float *GLM_RESTRICT out, vec3 a, vec3 b);
+
+/**
+ * Multiplies two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_multiplyTo(float *GLM_RESTRICT out, vec3 a, vec3 b);
+
+/**
+ * Divides two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_divideTo(float *GLM_RESTRICT out, vec3 a, vec3 b);
+
+/**
+ * Math.ceil the components of a vec3
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ */
+GLM_API void vec3_ceilTo(float *GLM_RESTRICT out, vec3 a);
+
+/**
+ * Math.floor the components of a vec3
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ */
+GLM_API void vec3_floorTo(float *GLM_RESTRICT out, vec3 a);
+
+/**
+ * Returns the minimum of two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_minTo(float *GLM_RESTRICT out, vec3 a, vec3 b);
+
+/**
+ * Returns the maximum of two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_maxTo(float *GLM_RESTRICT out, vec3 a, vec3 b);
+
+/**
+ * Math.round the components of a vec3
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ */
+GLM_API void vec3_roundTo(float *GLM_RESTRICT out, vec3 a);
+
+/**
+ * Scales a vec3 by a scalar number
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {Number} b amount to scale the vector by
+ */
+GLM_API void vec3_scaleTo(float *GLM_RESTRICT out, vec3 a, float b);
+
+/**
+ * Adds two vec3's after scaling the second operand by a scalar value
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ * @param {Number} scale the amount to scale b by before adding
+ */
+GLM_API void vec3_scaleAndAddTo(float *GLM_RESTRICT out, vec3 a, vec3 b, float scale);
+
+/**
+ * Negates the components of a vec3
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ */
+GLM_API void vec3_negateTo(float *GLM_RESTRICT out, vec3 a);
+
+/**
+ * Returns the inverse of the components of a vec3
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ */
+GLM_API void vec3_inverseTo(float *GLM_RESTRICT out, vec3 a);
+
+/**
+ * Normalize a vec3
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ */
+GLM_API void vec3_normalizeTo(float *GLM_RESTRICT out, vec3 a);
+
+/**
+ * Computes the cross product of two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_crossTo(float *GLM_RESTRICT out, vec3 a, vec3 b);
+
+/**
+ * Performs a linear interpolation between two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void vec3_lerpTo(float *GLM_RESTRICT out, vec3 a, vec3 b, float t);
+
+/**
+ * Performs a hermite interpolation with two control points
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ * @param {vec3} c the third operand
+ * @param {vec3} d the fourth operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void vec3_hermiteTo(float *GLM_RESTRICT out, vec3 a, vec3 b, vec3 c, vec3 d, float t);
+
+/**
+ * Performs a bezier interpolation with two control points
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ * @param {vec3} c the third operand
+ * @param {vec3} d the fourth operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void vec3_bezierTo(float *GLM_RESTRICT out, vec3 a, vec3 b, vec3 c, vec3 d, float t);
+
+/**
+ * Transforms the vec3 with a mat4.
+ * 4th vector component is implicitly '1'
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {mat4} m matrix to transform with
+ */
+GLM_API void vec3_transformMat4To(float *GLM_RESTRICT out, vec3 a, mat4 m);
+
+/**
+ * Transforms the vec3 with a mat3.
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {mat3} m the 3x3 matrix to transform with
+ */
+GLM_API void vec3_transformMat3To(float *GLM_RESTRICT out, vec3 a, mat3 m);
+
+/**
+ * Transforms the vec3 with a quat
+ * Can also be used for dual quaternions. (Multiply it with the real part)
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {quat} q quaternion to transform with
+ */
+GLM_API void vec3_transformQuatTo(float *GLM_RESTRICT out, vec3 a, quat q);
+
+/**
+ * Rotate a 3D vector around the x-axis
+ * @param {vec3} out The receiving vec3, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b The origin of the rotation
+ * @param {Number} c The angle of rotation
+ */
+GLM_API void vec3_rotateXTo(float *GLM_RESTRICT out, vec3 a, vec3 b, float c);
+
+/**
+ * Rotate a 3D vector around the y-axis
+ * @param {vec3} out The receiving vec3, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b The origin of the rotation
+ * @param {Number} c The angle of rotation
+ */
+GLM_API void vec3_rotateYTo(float *GLM_RESTRICT out, vec3 a, vec3 b, float c);
+
+/**
+ * Rotate a 3D vector around the z-axis
+ * @param {vec3} out The receiving vec3, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b The origin of the rotation
+ * @param {Number} c The angle of rotation
+ */
+GLM_API void vec3_rotateZTo(float *GLM_RESTRICT out, vec3 a, vec3 b, float c);
 
 #endif
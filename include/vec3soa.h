@@ -0,0 +1,147 @@
+#ifndef VEC3SOA_H
+#define VEC3SOA_H
+
+#include <stddef.h>
+#include "api.h"
+#include "typedefs.h"
+
+/**
+ * Number of vectors each component array is padded to
+ */
+#define VEC3SOA_PADDING 8
+
+/**
+ * Required alignment in bytes of the buffer given to vec3soa_init
+ */
+#define VEC3SOA_ALIGNMENT 32
+
+/**
+ * A stream of vec3's stored as structure-of-arrays: all x components,
+ * then all y components, then all z components.
+ * Each component array is aligned to VEC3SOA_ALIGNMENT bytes and padded
+ * up to a multiple of VEC3SOA_PADDING, so every operation works on whole
+ * SIMD registers. vec3soa_init zeroes the padding; padding lanes are then
+ * processed like any other vector, so after any other operation their
+ * contents are unspecified.
+ *
+ * All operations expect both streams to have the same count.
+ */
+typedef struct {
+    float *x;
+    float *y;
+    float *z;
+    size_t count;
+} vec3soa;
+
+/**
+ * Returns the count rounded up to a multiple of VEC3SOA_PADDING
+ *
+ * @param {Number} count number of vectors
+ * @returns {Number} padded number of vectors
+ */
+GLM_API size_t vec3soa_paddedCount(size_t count);
+
+/**
+ * Returns the number of floats a buffer needs to hold count vectors
+ *
+ * @param {Number} count number of vectors
+ * @returns {Number} buffer size in floats
+ */
+GLM_API size_t vec3soa_bufferSize(size_t count);
+
+/**
+ * Sets up a vec3soa on top of a caller provided buffer and zeroes it.
+ * The buffer must be aligned to VEC3SOA_ALIGNMENT bytes and hold at
+ * least vec3soa_bufferSize(count) floats.
+ *
+ * @param {vec3soa} dst the stream to set up
+ * @param {float[]} buffer storage for the components
+ * @param {Number} count number of vectors
+ */
+GLM_API void vec3soa_init(vec3soa *dst, float *buffer, size_t count);
+
+/**
+ * Copies an array of vec3's into a vec3soa
+ *
+ * @param {vec3soa} dst the receiving stream, dst->count vectors are read
+ * @param {vec3[]} src the source vectors
+ */
+GLM_API void vec3soa_fromVec3Array(vec3soa *dst, vec3 *src);
+
+/**
+ * Copies a vec3soa into an array of vec3's
+ *
+ * @param {vec3[]} dst the receiving array, must hold src->count vectors
+ * @param {vec3soa} src the source stream
+ */
+GLM_API void vec3soa_toVec3Array(vec3 *dst, vec3soa *src);
+
+/**
+ * Adds two streams of vec3's
+ *
+ * @param {vec3soa} dst the receiving stream
+ * @param {vec3soa} b the second operand
+ */
+GLM_API void vec3soa_add(vec3soa *dst, vec3soa *b);
+
+/**
+ * Adds two streams of vec3's after scaling the second operand by a scalar value
+ *
+ * @param {vec3soa} dst the receiving stream
+ * @param {vec3soa} b the second operand
+ * @param {Number} scale the amount to scale b by before adding
+ */
+GLM_API void vec3soa_scaleAndAdd(vec3soa *dst, vec3soa *b, float scale);
+
+/**
+ * Normalizes every vec3 of a stream
+ *
+ * @param {vec3soa} dst the receiving stream
+ */
+GLM_API void vec3soa_normalize(vec3soa *dst);
+
+/**
+ * Normalizes every vec3 of a stream with the fast reciprocal square root,
+ * see vec3_normalizeFast
+ *
+ * @param {vec3soa} dst the receiving stream
+ */
+GLM_API void vec3soa_normalizeFast(vec3soa *dst);
+
+/**
+ * Calculates the dot products of two streams of vec3's
+ *
+ * @param {float[]} dst receives the dot products, must be aligned to
+ *                  VEC3SOA_ALIGNMENT bytes and hold vec3soa_paddedCount(a->count) floats
+ * @param {vec3soa} a the first operand
+ * @param {vec3soa} b the second operand
+ */
+GLM_API void vec3soa_dot(float *dst, vec3soa *a, vec3soa *b);
+
+/**
+ * Computes the cross products of two streams of vec3's
+ *
+ * @param {vec3soa} dst the receiving stream
+ * @param {vec3soa} b the second operand
+ */
+GLM_API void vec3soa_cross(vec3soa *dst, vec3soa *b);
+
+/**
+ * Performs a linear interpolation between two streams of vec3's
+ *
+ * @param {vec3soa} dst the receiving stream
+ * @param {vec3soa} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void vec3soa_lerp(vec3soa *dst, vec3soa *b, float t);
+
+/**
+ * Transforms every vec3 of a stream with a mat4.
+ * 4th vector component is implicitly '1'
+ *
+ * @param {vec3soa} dst the receiving stream
+ * @param {mat4} m matrix to transform with
+ */
+GLM_API void vec3soa_transformMat4(vec3soa *dst, mat4 m);
+
+#endif
@@ -1,7 +1,9 @@
 #ifndef VEC4_H
 #define VEC4_H
 
+#include <stddef.h>
 #include <stdint.h>
+#include "api.h"
 #include "typedefs.h"
 
 /**
@@ -10,7 +12,7 @@
  * @param {vec4} out the receiving vector
  * @param {vec4} a the source vector
  */
-void vec4_copy(vec4 dst, vec4 a);
+GLM_API void vec4_copy(vec4 dst, vec4 a);
 
 /**
  * Set the components of a vec4 to the given values
@@ -21,7 +23,7 @@ void vec4_copy(vec4 dst, vec4 a);
  * @param {Number} z Z component
  * @param {Number} w W component
  */
-void vec4_set(vec4 dst, float x, float y, float z, float w);
+GLM_API void vec4_set(vec4 dst, float x, float y, float z, float w);
 
 /**
  * Adds two vec4's
@@ -30,7 +32,7 @@ void vec4_set(vec4 dst, float x, float y, float z, float w);
  * @param {vec4} a the first operand
  * @param {vec4} b the second operand
  */
-void vec4_add(vec4 dst, vec4 b);
+GLM_API void vec4_add(vec4 dst, vec4 b);
 
 /**
  * Subtracts vector b from vector a
@@ -39,7 +41,7 @@ void vec4_add(vec4 dst, vec4 b);
  * @param {vec4} a the first operand
  * @param {vec4} b the second operand
  */
-void vec4_subtract(vec4 dst, vec4 b);
+GLM_API void vec4_subtract(vec4 dst, vec4 b);
 
 /**
  * Multiplies two vec4's
@@ -48,7 +50,7 @@ void vec4_subtract(vec4 dst, vec4 b);
  * @param {vec4} a the first operand
  * @param {vec4} b the second operand
  */
-void vec4_multiply(vec4 dst, vec4 b);
+GLM_API void vec4_multiply(vec4 dst, vec4 b);
 
 /**
  * Divides two vec4's
@@ -57,7 +59,7 @@ void vec4_multiply(vec4 dst, vec4 b);
  * @param {vec4} a the first operand
  * @param {vec4} b the second operand
  */
-void vec4_divide(vec4 dst, vec4 b);
+GLM_API void vec4_divide(vec4 dst, vec4 b);
 
 /**
  * ceilf the components of a vec4
@@ -65,7 +67,7 @@ void vec4_divide(vec4 dst, vec4 b);
  * @param {vec4} out the receiving vector
  * @param {vec4} a vector to ceil
  */
-void vec4_ceil(vec4 dst);
+GLM_API void vec4_ceil(vec4 dst);
 
 /**
  * floorf the components of a vec4
@@ -73,7 +75,7 @@ void vec4_ceil(vec4 dst);
  * @param {vec4} out the receiving vector
  * @param {vec4} a vector to floor
  */
-void vec4_floor(vec4 dst);
+GLM_API void vec4_floor(vec4 dst);
 
 /**
  * Returns the minimum of two vec4's
@@ -82,7 +84,7 @@ void vec4_floor(vec4 dst);
  * @param {vec4} a the first operand
  * @param {vec4} b the second operand
  */
-void vec4_min(vec4 dst, vec4 b);
+GLM_API void vec4_min(vec4 dst, vec4 b);
 
 /**
  * Returns the maximum of two vec4's
@@ -91,7 +93,7 @@ void vec4_min(vec4 dst, vec4 b);
  * @param {vec4} a the first operand
  * @param {vec4} b the second operand
  */
-void vec4_max(vec4 dst, vec4 b);
+GLM_API void vec4_max(vec4 dst, vec4 b);
 
 /**
  * roundf the components of a vec4
@@ -99,7 +101,7 @@ void vec4_max(vec4 dst, vec4 b);
  * @param {vec4} out the receiving vector
  * @param {vec4} a vector to round
  */
-void vec4_round(vec4 dst);
+GLM_API void vec4_round(vec4 dst);
 
 /**
  * Scales a vec4 by a scalar number
@@ -108,7 +110,7 @@ void vec4_round(vec4 dst);
  * @param {vec4} a the vector to scale
  * @param {Number} b amount to scale the vector by
  */
-void vec4_scale(vec4 dst, float b);
+GLM_API void vec4_scale(vec4 dst, float b);
 
 /**
  * Adds two vec4's after scaling the second operand by a scalar value
@@ -117,7 +119,7 @@ void vec4_scale(vec4 dst, float b);
  * @param {vec4} b the second operand
  * @param {Number} scale the amount to scale b by before adding
  */
-void vec4_scaleAndAdd(vec4 dst, vec4 b, float scale);
+GLM_API void vec4_scaleAndAdd(vec4 dst, vec4 b, float scale);
 
 /**
  * Calculates the euclidian distance between two vec4's
@@ -126,7 +128,7 @@ void vec4_scaleAndAdd(vec4 dst, vec4 b, float scale);
  * @param {vec4} b the second operand
  * @returns {Number} distance between a and b
  */
-float vec4_distance(vec4 a, vec4 b);
+GLM_API float vec4_distance(vec4 a, vec4 b);
 
 /**
  * Calculates the squared euclidian distance between two vec4's
@@ -135,7 +137,7 @@ float vec4_distance(vec4 a, vec4 b);
  * @param {vec4} b the second operand
  * @returns {Number} squared distance between a and b
  */
-float vec4_squaredDistance(vec4 a, vec4 b);
+GLM_API float vec4_squaredDistance(vec4 a, vec4 b);
 
 /**
  * Calculates the length of a vec4
@@ -143,7 +145,7 @@ float vec4_squaredDistance(vec4 a, vec4 b);
  * @param {vec4} a vector to calculate length of
  * @returns {Number} length of a
  */
-float vec4_length(vec4 a);
+GLM_API float vec4_length(vec4 a);
 
 /**
  * Calculates the squared length of a vec4
@@ -151,7 +153,7 @@ float vec4_length(vec4 a);
  * @param {vec4} a vector to calculate squared length of
  * @returns {Number} squared length of a
  */
-float vec4_squaredLength(vec4 a);
+GLM_API float vec4_squaredLength(vec4 a);
 
 /**
  * Negates the components of a vec4
@@ -159,7 +161,7 @@ float vec4_squaredLength(vec4 a);
  * @param {vec4} out the receiving vector
  * @param {vec4} a vector to negate
  */
-void vec4_negate(vec4 dst);
+GLM_API void vec4_negate(vec4 dst);
 
 /**
  * Returns the inverse of the components of a vec4
@@ -167,7 +169,7 @@ void vec4_negate(vec4 dst);
  * @param {vec4} out the receiving vector
  * @param {vec4} a vector to invert
  */
-void vec4_inverse(vec4 dst);
+GLM_API void vec4_inverse(vec4 dst);
 
 /**
  * Normalize a vec4
@@ -175,7 +177,29 @@ void vec4_inverse(vec4 dst);
  * @param {vec4} out the receiving vector
  * @param {vec4} a vector to normalize
  */
-void vec4_normalize(vec4 dst);
+GLM_API void vec4_normalize(vec4 dst);
+
+/**
+ * Normalize a vec4 with the fast reciprocal square root: the hardware
+ * estimate and one Newton-Raphson step with SSE4/AVX2, within 2^-21
+ * relative of vec4_normalize. Plain C builds compute it exactly.
+ * Vectors with a squared length below FLT_MIN are left as they are.
+ *
+ * @param {vec4} out the receiving vector
+ */
+GLM_API void vec4_normalizeFast(vec4 dst);
+
+/**
+ * Normalizes an array of vec4's with the fast reciprocal square root,
+ * eg. a pose of quats after blending.
+ * Matches vec4_normalizeFast on every element within its error bound,
+ * the SIMD kernels may round differently.
+ *
+ * @param {vec4[]} dst the receiving array, may be the same array as src
+ * @param {vec4[]} src the vectors to normalize
+ * @param {Number} count number of vectors in src and dst
+ */
+GLM_API void vec4_normalizeFast_array(vec4 *dst, vec4 *src, size_t count);
 
 /**
  * Calculates the dot product of two vec4's
@@ -184,7 +208,7 @@ void vec4_normalize(vec4 dst);
  * @param {vec4} b the second operand
  * @returns {Number} dot product of a and b
  */
-float vec4_dot(vec4 a, vec4 b);
+GLM_API float vec4_dot(vec4 a, vec4 b);
 
 /**
  * Performs a linear interpolation between two vec4's
@@ -193,7 +217,7 @@ float vec4_dot(vec4 a, vec4 b);
  * @param {vec4} b the second operand
  * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
  */
-void vec4_lerp(vec4 dst, vec4 b, float t);
+GLM_API void vec4_lerp(vec4 dst, vec4 b, float t);
 
 /**
  * Transforms the vec4 with a mat4.
@@ -201,7 +225,7 @@ void vec4_lerp(vec4 dst, vec4 b, float t);
  * @param {vec4} out the receiving vector
  * @param {mat4} m matrix to transform with
  */
-void vec4_transformMat4(vec4 dst, mat4 m);
+GLM_API void vec4_transformMat4(vec4 dst, mat4 m);
 
 /**
  * Transforms the vec4 with a quat
@@ -209,7 +233,7 @@ void vec4_transformMat4(vec4 dst, mat4 m);
  * @param {vec4} out the receiving vector
  * @param {quat} q quaternion to transform with
  */
-void vec4_transformQuat(vec4 dst, quat q);
+GLM_API void vec4_transformQuat(vec4 dst, quat q);
 
 /**
  * Returns whether or not the vectors have exactly the same elements
@@ -218,6 +242,170 @@ void vec4_transformQuat(vec4 dst, quat q);
  * @param {vec4} b The second vector.
  * @returns {Boolean} True if the vectors are equal, false otherwise.
  */
-uint8_t vec4_equals(vec4 a, vec4 b);
+GLM_API uint8_t vec4_equals(vec4 a, vec4 b);
+
+// Out-of-place variants, see GLM_RESTRICT in api.h
+
+/**
+ * Adds two vec4's
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the first operand
+ * @param {vec4} b the second operand
+ */
+GLM_API void vec4_addTo(float *GLM_RESTRICT out, vec4 a, vec4 b);
+
+/**
+ * Subtracts vector b from vector a
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the first operand
+ * @param {vec4} b the second operand
+ */
+GLM_API void vec4_subtractTo(float *GLM_RESTRICT out, vec4 a, vec4 b);
+
+/**
+ * Multiplies two vec4's
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the first operand
+ * @param {vec4} b the second operand
+ */
+GLM_API void vec4_multiplyTo(float *GLM_RESTRICT out, vec4 a, vec4 b);
+
+/**
+ * Divides two vec4's
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the first operand
+ * @param {vec4} b the second operand
+ */
+GLM_API void vec4_divideTo(float *GLM_RESTRICT out, vec4 a, vec4 b);
+
+/**
+ * ceilf the components of a vec4
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a vector to ceil
+ */
+GLM_API void vec4_ceilTo(float *GLM_RESTRICT out, vec4 a);
+
+/**
+ * floorf the components of a vec4
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a vector to floor
+ */
+GLM_API void vec4_floorTo(float *GLM_RESTRICT out, vec4 a);
+
+/**
+ * Returns the minimum of two vec4's
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the first operand
+ * @param {vec4} b the second operand
+ */
+GLM_API void vec4_minTo(float *GLM_RESTRICT out, vec4 a, vec4 b);
+
+/**
+ * Returns the maximum of two vec4's
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the first operand
+ * @param {vec4} b the second operand
+ */
+GLM_API void vec4_maxTo(float *GLM_RESTRICT out, vec4 a, vec4 b);
+
+/**
+ * roundf the components of a vec4
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a vector to round
+ */
+GLM_API void vec4_roundTo(float *GLM_RESTRICT out, vec4 a);
+
+/**
+ * Scales a vec4 by a scalar number
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the vector to scale
+ * @param {Number} b amount to scale the vector by
+ */
+GLM_API void vec4_scaleTo(float *GLM_RESTRICT out, vec4 a, float b);
+
+/**
+ * Adds two vec4's after scaling the second operand by a scalar value
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} b the second operand
+ * @param {Number} scale the amount to scale b by before adding
+ */
+GLM_API void vec4_scaleAndAddTo(float *GLM_RESTRICT out, vec4 a, vec4 b, float scale);
+
+/**
+ * Negates the components of a vec4
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a vector to negate
+ */
+GLM_API void vec4_negateTo(float *GLM_RESTRICT out, vec4 a);
+
+/**
+ * Returns the inverse of the components of a vec4
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a vector to invert
+ */
+GLM_API void vec4_inverseTo(float *GLM_RESTRICT out, vec4 a);
+
+/**
+ * Normalize a vec4
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a vector to normalize
+ */
+GLM_API void vec4_normalizeTo(float *GLM_RESTRICT out, vec4 a);
+
+/**
+ * Performs a linear interpolation between two vec4's
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void vec4_lerpTo(float *GLM_RESTRICT out, vec4 a, vec4 b, float t);
+
+/**
+ * Transforms the vec4 with a mat4.
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {mat4} m matrix to transform with
+ */
+GLM_API void vec4_transformMat4To(float *GLM_RESTRICT out, vec4 a, mat4 m);
+
+/**
+ * Transforms the vec4 with a quat
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {quat} q quaternion to transform with
+ */
+GLM_API void vec4_transformQuatTo(float *GLM_RESTRICT out, vec4 a, quat q);
 
 #endif
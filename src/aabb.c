@@ -0,0 +1,74 @@
+#include "aabb.h"
+#include "simd.h"
+
+/**
+ * Transforms an axis aligned box with a mat4 and replaces it with the
+ * axis aligned box around the result (J. Arvo, "Transforming Axis-Aligned
+ * Bounding Boxes"). Gives the same box as transforming all 8 corners with
+ * vec3_transformMat4, but without the corners: 18 multiplies and no
+ * divides. Only the upper 3 rows of the matrix are used, so it must be
+ * affine.
+ *
+ * @param {vec3} min the minimum corner of the box, receives the new minimum
+ * @param {vec3} max the maximum corner of the box, receives the new maximum
+ * @param {mat4} m matrix to transform with
+ */
+GLM_API void aabb_transformMat4(vec3 min, vec3 max, mat4 m) {
+#if defined(GLM_SSE4)
+    glm_aabb_transformMat4_array_sse4(min, max, min, max, 1, m);
+#else
+    GLM_DISPATCH_RETURN(aabb_transformMat4_array, min, max, min, max, 1, m);
+    float amin[3], amax[3];
+    int i, j;
+
+    for (j = 0; j < 3; j++) {
+        amin[j] = min[j];
+        amax[j] = max[j];
+    }
+    for (i = 0; i < 3; i++) {
+        // Start at the translation and add the smaller / larger product of every column
+        float lo = m[12 + i], hi = m[12 + i];
+        for (j = 0; j < 3; j++) {
+            float a = m[4 * j + i] * amin[j];
+            float b = m[4 * j + i] * amax[j];
+            lo += a < b ? a : b;
+            hi += a < b ? b : a;
+        }
+        min[i] = lo;
+        max[i] = hi;
+    }
+#endif
+}
+
+/**
+ * Transforms an array of boxes, each with its own matrix, eg. the local
+ * bounds of every instance with its world matrix.
+ * Gives the same result as calling aabb_transformMat4 on every element.
+ *
+ * @param {vec3[]} dstMin receives the minimum corners, may be the same array as min
+ * @param {vec3[]} dstMax receives the maximum corners, may be the same array as max
+ * @param {vec3[]} min the minimum corners of the boxes
+ * @param {vec3[]} max the maximum corners of the boxes
+ * @param {Number} count number of boxes
+ * @param {mat4[]} m the affine matrices to transform with, one per box
+ */
+GLM_API void aabb_transformMat4_array(vec3 *dstMin, vec3 *dstMax, vec3 *min, vec3 *max, size_t count, mat4 *m) {
+    size_t i = 0;
+
+#if defined(GLM_SSE4)
+    i = glm_aabb_transformMat4_array_sse4(dstMin[0], dstMax[0], min[0], max[0], count, m[0]);
+#elif defined(GLM_DISPATCH)
+    if (glm_dispatch.aabb_transformMat4_array) {
+        i = glm_dispatch.aabb_transformMat4_array(dstMin[0], dstMax[0], min[0], max[0], count, m[0]);
+    }
+#endif
+
+    for (; i < count; i++) {
+        int k;
+        for (k = 0; k < 3; k++) {
+            dstMin[i][k] = min[i][k];
+            dstMax[i][k] = max[i][k];
+        }
+        aabb_transformMat4(dstMin[i], dstMax[i], m[i]);
+    }
+}
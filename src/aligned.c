@@ -0,0 +1,215 @@
+#include "aligned.h"
+#include "vec4.h"
+#include "mat4.h"
+#include "quat.h"
+#include "simd.h"
+#include "noalias.h"
+
+/**
+ * Copy the values from one vec4a to another
+ *
+ * @param {vec4a} dst the receiving vector
+ * @param {vec4a} a the source vector
+ */
+GLM_API void vec4a_copy(vec4a dst, vec4a a) {
+    GLM_ASSERT_ALIGNED(dst, GLM_VEC4A_ALIGNMENT);
+    GLM_ASSERT_ALIGNED(a, GLM_VEC4A_ALIGNMENT);
+#if defined(GLM_SSE4)
+    _mm_store_ps(dst, _mm_load_ps(a));
+#else
+    vec4_copy(dst, a);
+#endif
+}
+
+/**
+ * Adds two vec4a's
+ *
+ * @param {vec4a} dst the receiving vector
+ * @param {vec4a} b the second operand
+ */
+GLM_API void vec4a_add(vec4a dst, vec4a b) {
+    GLM_ASSERT_ALIGNED(dst, GLM_VEC4A_ALIGNMENT);
+    GLM_ASSERT_ALIGNED(b, GLM_VEC4A_ALIGNMENT);
+#if defined(GLM_SSE4)
+    _mm_store_ps(dst, _mm_add_ps(_mm_load_ps(dst), _mm_load_ps(b)));
+#else
+    vec4_add(dst, b);
+#endif
+}
+
+/**
+ * Scales a vec4a by a scalar number
+ *
+ * @param {vec4a} dst the receiving vector
+ * @param {Number} b amount to scale the vector by
+ */
+GLM_API void vec4a_scale(vec4a dst, float b) {
+    GLM_ASSERT_ALIGNED(dst, GLM_VEC4A_ALIGNMENT);
+#if defined(GLM_SSE4)
+    _mm_store_ps(dst, _mm_mul_ps(_mm_load_ps(dst), _mm_set1_ps(b)));
+#else
+    vec4_scale(dst, b);
+#endif
+}
+
+/**
+ * Calculates the dot product of two vec4a's
+ *
+ * @param {vec4a} a the first operand
+ * @param {vec4a} b the second operand
+ * @returns {Number} dot product of a and b
+ */
+GLM_API float vec4a_dot(vec4a a, vec4a b) {
+    GLM_ASSERT_ALIGNED(a, GLM_VEC4A_ALIGNMENT);
+    GLM_ASSERT_ALIGNED(b, GLM_VEC4A_ALIGNMENT);
+#if defined(GLM_SSE4)
+    return _mm_cvtss_f32(_mm_dp_ps(_mm_load_ps(a), _mm_load_ps(b), 0xf1));
+#else
+    return vec4_dot(a, b);
+#endif
+}
+
+/**
+ * Transforms the vec4a with a mat4a
+ *
+ * @param {vec4a} dst the receiving vector
+ * @param {mat4a} m matrix to transform with
+ */
+GLM_API void vec4a_transformMat4a(vec4a dst, mat4a m) {
+    GLM_ASSERT_ALIGNED(dst, GLM_VEC4A_ALIGNMENT);
+    GLM_ASSERT_ALIGNED(m, GLM_MAT4A_ALIGNMENT);
+#if defined(GLM_SSE4)
+    __m128 v = _mm_load_ps(dst);
+    __m128 r = _mm_mul_ps(_mm_load_ps(m), GLM_SWIZZLE(v, 0, 0, 0, 0));
+    r = glm_madd_ps(_mm_load_ps(m + 4), GLM_SWIZZLE(v, 1, 1, 1, 1), r);
+    r = glm_madd_ps(_mm_load_ps(m + 8), GLM_SWIZZLE(v, 2, 2, 2, 2), r);
+    r = glm_madd_ps(_mm_load_ps(m + 12), GLM_SWIZZLE(v, 3, 3, 3, 3), r);
+    _mm_store_ps(dst, r);
+#else
+    vec4_transformMat4(dst, m);
+#endif
+}
+
+/**
+ * Multiplies two quata's
+ *
+ * @param {quata} dst the receiving quaternion
+ * @param {quata} b the second operand
+ */
+GLM_API void quata_multiply(quata dst, quata b) {
+    GLM_ASSERT_ALIGNED(dst, GLM_QUATA_ALIGNMENT);
+    GLM_ASSERT_ALIGNED(b, GLM_QUATA_ALIGNMENT);
+#if defined(GLM_SSE4)
+    __m128 a = _mm_load_ps(dst);
+    __m128 bv = _mm_load_ps(b);
+    // Flips the sign of the w lane
+    __m128 negw = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, (int)0x80000000));
+    __m128 r = _mm_mul_ps(GLM_SWIZZLE(a, 3, 3, 3, 3), bv);
+    r = _mm_add_ps(r, _mm_xor_ps(_mm_mul_ps(GLM_SWIZZLE(a, 0, 1, 2, 0), GLM_SWIZZLE(bv, 3, 3, 3, 0)), negw));
+    r = _mm_add_ps(r, _mm_xor_ps(_mm_mul_ps(GLM_SWIZZLE(a, 1, 2, 0, 1), GLM_SWIZZLE(bv, 2, 0, 1, 1)), negw));
+    r = _mm_sub_ps(r, _mm_mul_ps(GLM_SWIZZLE(a, 2, 0, 1, 2), GLM_SWIZZLE(bv, 1, 2, 0, 2)));
+    _mm_store_ps(dst, r);
+#else
+    quat_multiply(dst, b);
+#endif
+}
+
+/**
+ * Copy the values from one mat4a to another
+ *
+ * @param {mat4a} dst the receiving matrix
+ * @param {mat4a} src the source matrix
+ */
+GLM_API void mat4a_copy(mat4a dst, mat4a src) {
+    GLM_ASSERT_ALIGNED(dst, GLM_MAT4A_ALIGNMENT);
+    GLM_ASSERT_ALIGNED(src, GLM_MAT4A_ALIGNMENT);
+#if defined(GLM_AVX2)
+    __m256 c01 = _mm256_load_ps(src);
+    __m256 c23 = _mm256_load_ps(src + 8);
+    _mm256_store_ps(dst, c01);
+    _mm256_store_ps(dst + 8, c23);
+#elif defined(GLM_SSE4)
+    __m128 c0 = _mm_load_ps(src);
+    __m128 c1 = _mm_load_ps(src + 4);
+    __m128 c2 = _mm_load_ps(src + 8);
+    __m128 c3 = _mm_load_ps(src + 12);
+    _mm_store_ps(dst, c0);
+    _mm_store_ps(dst + 4, c1);
+    _mm_store_ps(dst + 8, c2);
+    _mm_store_ps(dst + 12, c3);
+#else
+    mat4_copy(dst, src);
+#endif
+}
+
+/**
+ * Transpose the values of a mat4a
+ *
+ * @param {mat4a} dst the receiving matrix
+ */
+GLM_API void mat4a_transpose(mat4a dst) {
+    GLM_ASSERT_ALIGNED(dst, GLM_MAT4A_ALIGNMENT);
+#if defined(GLM_SSE4)
+    __m128 c0 = _mm_load_ps(dst);
+    __m128 c1 = _mm_load_ps(dst + 4);
+    __m128 c2 = _mm_load_ps(dst + 8);
+    __m128 c3 = _mm_load_ps(dst + 12);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    _mm_store_ps(dst, c0);
+    _mm_store_ps(dst + 4, c1);
+    _mm_store_ps(dst + 8, c2);
+    _mm_store_ps(dst + 12, c3);
+#else
+    mat4_transpose(dst);
+#endif
+}
+
+/**
+ * Multiplies two mat4a's
+ *
+ * @param {mat4a} dst the receiving matrix
+ * @param {mat4a} b the second operand
+ */
+GLM_API void mat4a_multiply(mat4a dst, mat4a b) {
+    GLM_ASSERT_ALIGNED(dst, GLM_MAT4A_ALIGNMENT);
+    GLM_ASSERT_ALIGNED(b, GLM_MAT4A_ALIGNMENT);
+#if defined(GLM_AVX2)
+    // Same as glm_mat4_multiply_avx2 with aligned accesses
+    __m256 a0 = _mm256_broadcast_ps((const __m128 *)dst);
+    __m256 a1 = _mm256_broadcast_ps((const __m128 *)(dst + 4));
+    __m256 a2 = _mm256_broadcast_ps((const __m128 *)(dst + 8));
+    __m256 a3 = _mm256_broadcast_ps((const __m128 *)(dst + 12));
+    __m256 b01 = _mm256_load_ps(b);
+    __m256 b23 = _mm256_load_ps(b + 8);
+
+    __m256 r01 = _mm256_mul_ps(a0, _mm256_permute_ps(b01, 0x00));
+    __m256 r23 = _mm256_mul_ps(a0, _mm256_permute_ps(b23, 0x00));
+    r01 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b01, 0x55), r01);
+    r23 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b23, 0x55), r23);
+    r01 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b01, 0xaa), r01);
+    r23 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b23, 0xaa), r23);
+    r01 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b01, 0xff), r01);
+    r23 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b23, 0xff), r23);
+
+    _mm256_store_ps(dst, r01);
+    _mm256_store_ps(dst + 8, r23);
+#elif defined(GLM_SSE4)
+    // Same as glm_mat4_multiply_sse4 with aligned accesses
+    __m128 a0 = _mm_load_ps(dst);
+    __m128 a1 = _mm_load_ps(dst + 4);
+    __m128 a2 = _mm_load_ps(dst + 8);
+    __m128 a3 = _mm_load_ps(dst + 12);
+    int i;
+
+    for (i = 0; i < 16; i += 4) {
+        __m128 bi = _mm_load_ps(b + i);
+        __m128 r = _mm_mul_ps(a0, GLM_SWIZZLE(bi, 0, 0, 0, 0));
+        r = glm_madd_ps(a1, GLM_SWIZZLE(bi, 1, 1, 1, 1), r);
+        r = glm_madd_ps(a2, GLM_SWIZZLE(bi, 2, 2, 2, 2), r);
+        r = glm_madd_ps(a3, GLM_SWIZZLE(bi, 3, 3, 3, 3), r);
+        _mm_store_ps(dst + i, r);
+    }
+#else
+    mat4_multiply(dst, b);
+#endif
+}
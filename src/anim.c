@@ -0,0 +1,154 @@
+#include "anim.h"
+#include "vec3.h"
+#include "vec4.h"
+#include "quat.h"
+#include "mat4.h"
+
+/*
+ * Key lookup shared by consecutive tracks of a batch: baked clips usually
+ * give every track the same times array, which is then searched once.
+ */
+typedef struct {
+    float *times;
+    size_t count;
+    size_t key;
+} glm_anim_lookup;
+
+static inline size_t glm_anim_lookupKey(glm_anim_lookup *last, anim_track *track, float t) {
+    if (track->times != last->times || track->count != last->count) {
+        last->times = track->times;
+        last->count = track->count;
+        last->key = anim_findKey(track, t);
+    } else {
+        track->cursor = last->key;
+    }
+    return last->key;
+}
+
+static inline void glm_anim_vec3At(vec3 dst, anim_track *track, size_t k, float t) {
+    float *times = track->times;
+    float *v = track->values + 3 * k;
+
+    if (k + 1 >= track->count || t <= times[k]) {
+        vec3_copy(dst, v);
+        return;
+    }
+    vec3_lerpTo(dst, v, v + 3, (t - times[k]) / (times[k + 1] - times[k]));
+}
+
+static inline void glm_anim_quatAt(quat dst, anim_track *track, size_t k, float t) {
+    float *times = track->times;
+    float *v = track->values + 4 * k;
+
+    if (k + 1 >= track->count || t <= times[k]) {
+        vec4_copy(dst, v);
+        return;
+    }
+    quat_slerpTo(dst, v, v + 4, (t - times[k]) / (times[k + 1] - times[k]));
+}
+
+GLM_API void anim_initTrack(anim_track *dst, float *times, float *values, size_t count) {
+    dst->times = times;
+    dst->values = values;
+    dst->count = count;
+    dst->cursor = 0;
+}
+
+GLM_API void anim_initClip(anim_clip *dst, anim_track *translation, anim_track *rotation, anim_track *scale, size_t count) {
+    dst->translation = translation;
+    dst->rotation = rotation;
+    dst->scale = scale;
+    dst->count = count;
+}
+
+GLM_API size_t anim_findKey(anim_track *track, float t) {
+    float *times = track->times;
+    size_t n = track->count, k = track->cursor;
+
+    // Forward playback stays on the cached key or moves to the next one
+    if (k + 1 < n && times[k] <= t) {
+        if (t < times[k + 1]) {
+            return k;
+        }
+        if (k + 2 < n && t < times[k + 2]) {
+            track->cursor = k + 1;
+            return k + 1;
+        }
+    }
+
+    if (n < 2 || t < times[1]) {
+        k = 0;
+    } else if (t >= times[n - 1]) {
+        k = n - 1;
+    } else {
+        // times[lo] <= t < times[hi]
+        size_t lo = 1, hi = n - 1;
+        while (hi - lo > 1) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (times[mid] <= t) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        k = lo;
+    }
+    track->cursor = k;
+    return k;
+}
+
+GLM_API void anim_sampleVec3(vec3 dst, anim_track *track, float t) {
+    if (!track->count) {
+        return;
+    }
+    glm_anim_vec3At(dst, track, anim_findKey(track, t), t);
+}
+
+GLM_API void anim_sampleQuat(quat dst, anim_track *track, float t) {
+    if (!track->count) {
+        return;
+    }
+    glm_anim_quatAt(dst, track, anim_findKey(track, t), t);
+}
+
+GLM_API void anim_sampleTRS(vec3 *translation, quat_v2 *rotation, vec3 *scale, anim_clip *clip, float t) {
+    glm_anim_lookup last = { NULL, 0, 0 };
+    size_t i;
+
+    for (i = 0; i < clip->count; i++) {
+        anim_track *track;
+
+        if (clip->translation && (track = &clip->translation[i])->count) {
+            glm_anim_vec3At(translation[i], track, glm_anim_lookupKey(&last, track, t), t);
+        }
+        if (clip->rotation && (track = &clip->rotation[i])->count) {
+            glm_anim_quatAt(rotation[i], track, glm_anim_lookupKey(&last, track, t), t);
+        }
+        if (clip->scale && (track = &clip->scale[i])->count) {
+            glm_anim_vec3At(scale[i], track, glm_anim_lookupKey(&last, track, t), t);
+        }
+    }
+}
+
+GLM_API void anim_sampleMat4(mat4 *dst, anim_clip *clip, float t) {
+    glm_anim_lookup last = { NULL, 0, 0 };
+    size_t i;
+
+    for (i = 0; i < clip->count; i++) {
+        vec3 v = { 0, 0, 0 }, s = { 1, 1, 1 };
+        quat q;
+        anim_track *track;
+
+        quat_identity(q);
+        if (clip->translation && (track = &clip->translation[i])->count) {
+            glm_anim_vec3At(v, track, glm_anim_lookupKey(&last, track, t), t);
+        }
+        if (clip->rotation && (track = &clip->rotation[i])->count) {
+            glm_anim_quatAt(q, track, glm_anim_lookupKey(&last, track, t), t);
+        }
+        if (clip->scale && (track = &clip->scale[i])->count) {
+            glm_anim_vec3At(s, track, glm_anim_lookupKey(&last, track, t), t);
+        }
+        mat4_fromRotationTranslationScale(dst[i], q, v, s);
+    }
+}
@@ -0,0 +1,143 @@
+#include "dispatch.h"
+#include "simd.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+static const char *level_names[] = { "none", "sse4", "avx2" };
+
+dispatch_level dispatch_detect(void) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    // Also checks that the OS saves the AVX registers
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return DISPATCH_AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return DISPATCH_SSE4;
+    }
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int info[4];
+    int sse41, fma, osxsave, avx2 = 0;
+
+    __cpuid(info, 1);
+    sse41 = (info[2] >> 19) & 1;
+    fma = (info[2] >> 12) & 1;
+    osxsave = (info[2] >> 27) & 1;
+    if (osxsave && (_xgetbv(0) & 6) == 6) {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] >> 5) & 1;
+    }
+    if (avx2 && fma) {
+        return DISPATCH_AVX2;
+    }
+    if (sse41) {
+        return DISPATCH_SSE4;
+    }
+#endif
+    return DISPATCH_NONE;
+}
+
+const char *dispatch_levelName(dispatch_level level) {
+    if ((unsigned)level >= sizeof(level_names) / sizeof(level_names[0])) {
+        return "unknown";
+    }
+    return level_names[level];
+}
+
+#if defined(GLM_DISPATCH)
+
+glm_dispatch_table glm_dispatch;
+
+static dispatch_level current = DISPATCH_NONE;
+
+dispatch_level dispatch_getLevel(void) {
+    return current;
+}
+
+dispatch_level dispatch_setLevel(dispatch_level level) {
+    glm_dispatch_table table;
+    dispatch_level best = dispatch_detect();
+
+    if (level > best) {
+        level = best;
+    }
+    memset(&table, 0, sizeof(table));
+    if (level >= DISPATCH_SSE4) {
+        glm_dispatch_fill_sse4(&table);
+    }
+    if (level >= DISPATCH_AVX2) {
+        glm_dispatch_fill_avx2(&table);
+    }
+    glm_dispatch = table;
+    current = level;
+    return level;
+}
+
+static int name_equals(const char *a, const char *b) {
+    for (; *a && *b; a++, b++) {
+        if (tolower((unsigned char)*a) != *b) {
+            return 0;
+        }
+    }
+    return *a == *b;
+}
+
+static void dispatch_init(void) {
+    const char *env = getenv("GLM_SIMD");
+    dispatch_level level = dispatch_detect();
+
+    if (env && *env) {
+        dispatch_level l;
+        for (l = DISPATCH_NONE; l <= DISPATCH_AVX2; l++) {
+            if (name_equals(env, level_names[l])) {
+                break;
+            }
+        }
+        if (l <= DISPATCH_AVX2) {
+            level = l;
+        } else {
+            fprintf(stderr, "gl-matrix: unknown GLM_SIMD value '%s', using %s\n", env, dispatch_levelName(level));
+        }
+    }
+    dispatch_setLevel(level);
+}
+
+// Pick the level before main() so the kernels never see a half set up table
+#if defined(__GNUC__)
+__attribute__((constructor)) static void dispatch_constructor(void) {
+    dispatch_init();
+}
+#elif defined(_MSC_VER)
+#pragma section(".CRT$XCU", read)
+static void __cdecl dispatch_constructor(void) {
+    dispatch_init();
+}
+__declspec(allocate(".CRT$XCU")) static void (__cdecl *dispatch_constructor_ptr)(void) = dispatch_constructor;
+#endif
+
+#else
+
+// Fixed backend, the level is whatever the library was compiled for
+dispatch_level dispatch_getLevel(void) {
+#if defined(GLM_AVX2)
+    return DISPATCH_AVX2;
+#elif defined(GLM_SSE4)
+    return DISPATCH_SSE4;
+#else
+    return DISPATCH_NONE;
+#endif
+}
+
+dispatch_level dispatch_setLevel(dispatch_level level) {
+    (void)level;
+    return dispatch_getLevel();
+}
+
+#endif
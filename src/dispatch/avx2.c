@@ -0,0 +1,31 @@
+/*
+ * AVX2 + FMA entries of the runtime dispatch table, built with -mavx2 -mfma.
+ * Kernels without an AVX2 version use the SSE4.1 one, which gets FMA here
+ * just like in a GL_MATRIX_SIMD=AVX2 build.
+ */
+#include "../simd.h"
+
+void glm_dispatch_fill_avx2(glm_dispatch_table *table) {
+#if defined(GLM_AVX2)
+    table->mat4_transpose = glm_mat4_transpose_sse4;
+    table->mat4_invert = glm_mat4_invert_sse4;
+    table->mat4_multiply = glm_mat4_multiply_avx2;
+    table->mat4_multiplyAffine = glm_mat4_multiplyAffine_avx2;
+    table->mat4_scaleMultiply = glm_mat4_scaleMultiply_avx2;
+    table->mat4_multiplyScale = glm_mat4_multiplyScale_sse4;
+    table->vec3_transformMat4_array = glm_vec3_transformMat4_array_avx2;
+    table->vec3_transformMat3_array = glm_vec3_transformMat3_array_avx2;
+    table->vec3_transformQuat_array = glm_vec3_transformQuat_array_avx2;
+    table->quat_nlerp_array = glm_quat_nlerp_array_avx2;
+    table->quat_slerpFast_array = glm_quat_slerpFast_array_avx2;
+    table->skin_linearBlend = glm_skin_linearBlend_avx2;
+    table->skin_dualQuat = glm_skin_dualQuat_sse4;
+    table->aabb_transformMat4_array = glm_aabb_transformMat4_array_sse4;
+    table->vec3_normalizeFast_array = glm_vec3_normalizeFast_array_avx2;
+    table->vec4_normalizeFast_array = glm_vec4_normalizeFast_array_avx2;
+    table->quat_fromEuler_array = glm_quat_fromEuler_array_avx2;
+    table->mat4_fromRotationTranslationScale_array = glm_mat4_fromRotationTranslationScale_array_sse4;
+#else
+    (void)table;
+#endif
+}
@@ -0,0 +1,29 @@
+/*
+ * SSE4.1 entries of the runtime dispatch table, built with -msse4.1
+ */
+#include "../simd.h"
+
+void glm_dispatch_fill_sse4(glm_dispatch_table *table) {
+#if defined(GLM_SSE4)
+    table->mat4_transpose = glm_mat4_transpose_sse4;
+    table->mat4_invert = glm_mat4_invert_sse4;
+    table->mat4_multiply = glm_mat4_multiply_sse4;
+    table->mat4_multiplyAffine = glm_mat4_multiplyAffine_sse4;
+    table->mat4_scaleMultiply = glm_mat4_scaleMultiply_sse4;
+    table->mat4_multiplyScale = glm_mat4_multiplyScale_sse4;
+    table->vec3_transformMat4_array = glm_vec3_transformMat4_array_sse4;
+    table->vec3_transformMat3_array = glm_vec3_transformMat3_array_sse4;
+    table->vec3_transformQuat_array = glm_vec3_transformQuat_array_sse4;
+    table->quat_nlerp_array = glm_quat_nlerp_array_sse4;
+    table->quat_slerpFast_array = glm_quat_slerpFast_array_sse4;
+    table->skin_linearBlend = glm_skin_linearBlend_sse4;
+    table->skin_dualQuat = glm_skin_dualQuat_sse4;
+    table->aabb_transformMat4_array = glm_aabb_transformMat4_array_sse4;
+    table->vec3_normalizeFast_array = glm_vec3_normalizeFast_array_sse4;
+    table->vec4_normalizeFast_array = glm_vec4_normalizeFast_array_sse4;
+    table->quat_fromEuler_array = glm_quat_fromEuler_array_sse4;
+    table->mat4_fromRotationTranslationScale_array = glm_mat4_fromRotationTranslationScale_array_sse4;
+#else
+    (void)table;
+#endif
+}
@@ -0,0 +1,185 @@
+#include "dquat.h"
+#include "mat4.h"
+#include <math.h>
+
+/**
+ * Set a dquat to the identity dual quaternion
+ *
+ * @param {dquat} out the receiving dual quaternion
+ */
+GLM_API void dquat_identity(dquat dst) {
+    dst[0] = 0;
+    dst[1] = 0;
+    dst[2] = 0;
+    dst[3] = 1;
+    dst[4] = 0;
+    dst[5] = 0;
+    dst[6] = 0;
+    dst[7] = 0;
+}
+
+/**
+ * Copy the values from one dquat to another
+ *
+ * @param {dquat} out the receiving dual quaternion
+ * @param {dquat} a the source dual quaternion
+ */
+GLM_API void dquat_copy(dquat dst, dquat a) {
+    size_t i;
+    for (i = 0; i < 8; i++) {
+        dst[i] = a[i];
+    }
+}
+
+/**
+ * Creates a dual quat from a quaternion and a translation, rotating first
+ *
+ * @param {dquat} out the receiving dual quaternion
+ * @param {quat} q the rotation, normalized
+ * @param {vec3} t the translation
+ */
+GLM_API void dquat_fromRotationTranslation(dquat dst, quat q, vec3 t) {
+    float ax = t[0] * 0.5f, ay = t[1] * 0.5f, az = t[2] * 0.5f;
+    float bx = q[0], by = q[1], bz = q[2], bw = q[3];
+
+    dst[0] = bx;
+    dst[1] = by;
+    dst[2] = bz;
+    dst[3] = bw;
+    dst[4] = ax * bw + ay * bz - az * by;
+    dst[5] = ay * bw + az * bx - ax * bz;
+    dst[6] = az * bw + ax * by - ay * bx;
+    dst[7] = -ax * bx - ay * by - az * bz;
+}
+
+/**
+ * Gets the translation of a normalized dual quat
+ *
+ * @param {vec3} out the receiving vector
+ * @param {dquat} a dual quaternion to be decomposed
+ */
+GLM_API void dquat_getTranslation(vec3 dst, dquat a) {
+    float ax = a[4], ay = a[5], az = a[6], aw = a[7];
+    float bx = -a[0], by = -a[1], bz = -a[2], bw = a[3];
+
+    dst[0] = (ax * bw + aw * bx + ay * bz - az * by) * 2;
+    dst[1] = (ay * bw + aw * by + az * bx - ax * bz) * 2;
+    dst[2] = (az * bw + aw * bz + ax * by - ay * bx) * 2;
+}
+
+/**
+ * Multiplies two dquat's, the result applies b first and then out,
+ * like quat_multiply
+ *
+ * @param {dquat} out the receiving dual quaternion
+ * @param {dquat} b the second operand
+ */
+GLM_API void dquat_multiply(dquat dst, dquat b) {
+    float ax0 = dst[0], ay0 = dst[1], az0 = dst[2], aw0 = dst[3];
+    float ax1 = dst[4], ay1 = dst[5], az1 = dst[6], aw1 = dst[7];
+    float bx0 = b[0], by0 = b[1], bz0 = b[2], bw0 = b[3];
+    float bx1 = b[4], by1 = b[5], bz1 = b[6], bw1 = b[7];
+
+    dst[0] = ax0 * bw0 + aw0 * bx0 + ay0 * bz0 - az0 * by0;
+    dst[1] = ay0 * bw0 + aw0 * by0 + az0 * bx0 - ax0 * bz0;
+    dst[2] = az0 * bw0 + aw0 * bz0 + ax0 * by0 - ay0 * bx0;
+    dst[3] = aw0 * bw0 - ax0 * bx0 - ay0 * by0 - az0 * bz0;
+    dst[4] = ax0 * bw1 + aw0 * bx1 + ay0 * bz1 - az0 * by1 + ax1 * bw0 + aw1 * bx0 + ay1 * bz0 - az1 * by0;
+    dst[5] = ay0 * bw1 + aw0 * by1 + az0 * bx1 - ax0 * bz1 + ay1 * bw0 + aw1 * by0 + az1 * bx0 - ax1 * bz0;
+    dst[6] = az0 * bw1 + aw0 * bz1 + ax0 * by1 - ay0 * bx1 + az1 * bw0 + aw1 * bz0 + ax1 * by0 - ay1 * bx0;
+    dst[7] = aw0 * bw1 - ax0 * bx1 - ay0 * by1 - az0 * bz1 + aw1 * bw0 - ax1 * bx0 - ay1 * by0 - az1 * bz0;
+}
+
+/**
+ * Normalizes a dquat: scales it to a unit real part and makes the dual
+ * part orthogonal to the real part
+ *
+ * @param {dquat} out the dual quaternion to normalize
+ */
+GLM_API void dquat_normalize(dquat dst) {
+    float len = dst[0] * dst[0] + dst[1] * dst[1] + dst[2] * dst[2] + dst[3] * dst[3];
+
+    if (len > 0) {
+        float inv = 1 / sqrtf(len);
+        float a0 = dst[0] * inv, a1 = dst[1] * inv, a2 = dst[2] * inv, a3 = dst[3] * inv;
+        float b0 = dst[4], b1 = dst[5], b2 = dst[6], b3 = dst[7];
+        float a_dot_b = a0 * b0 + a1 * b1 + a2 * b2 + a3 * b3;
+
+        dst[0] = a0;
+        dst[1] = a1;
+        dst[2] = a2;
+        dst[3] = a3;
+        dst[4] = (b0 - a0 * a_dot_b) * inv;
+        dst[5] = (b1 - a1 * a_dot_b) * inv;
+        dst[6] = (b2 - a2 * a_dot_b) * inv;
+        dst[7] = (b3 - a3 * a_dot_b) * inv;
+    }
+}
+
+/**
+ * Dual quaternion linear blending: sums the weighted dquats and
+ * normalizes the result. Dquats whose real part lies in the other
+ * hemisphere than the first one are negated, so the blend takes the
+ * shortest path.
+ *
+ * @param {dquat} out the receiving dual quaternion
+ * @param {dquat[]} dq the dual quaternions to blend
+ * @param {float[]} weights the weight of every dual quaternion
+ * @param {Number} count number of dual quaternions, at least 1
+ */
+GLM_API void dquat_blend(dquat dst, dquat *dq, float *weights, size_t count) {
+    float *first = dq[0];
+    float b[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    size_t i, k;
+
+    for (i = 0; i < count; i++) {
+        float w = weights[i];
+        // take the shortest path
+        if (first[0] * dq[i][0] + first[1] * dq[i][1] + first[2] * dq[i][2] + first[3] * dq[i][3] < 0) {
+            w = -w;
+        }
+        for (k = 0; k < 8; k++) {
+            b[k] += w * dq[i][k];
+        }
+    }
+    dquat_copy(dst, b);
+    dquat_normalize(dst);
+}
+
+/**
+ * Transforms the vec3 with a normalized dquat: rotates it with the real
+ * part, then translates it
+ *
+ * @param {vec3} out the receiving vector
+ * @param {dquat} a dual quaternion to transform with
+ */
+GLM_API void vec3_transformDquat(vec3 dst, dquat a) {
+    float qx = a[0], qy = a[1], qz = a[2], qw = a[3];
+    float dx = a[4], dy = a[5], dz = a[6], dw = a[7];
+    float x = dst[0], y = dst[1], z = dst[2];
+    // u = q.xyz x v + w * v
+    float ux = qy * z - qz * y + qw * x;
+    float uy = qz * x - qx * z + qw * y;
+    float uz = qx * y - qy * x + qw * z;
+    // t = 2 * vector part of dual * conjugate(real)
+    float tx = 2 * (qw * dx - dw * qx + qy * dz - qz * dy);
+    float ty = 2 * (qw * dy - dw * qy + qz * dx - qx * dz);
+    float tz = 2 * (qw * dz - dw * qz + qx * dy - qy * dx);
+
+    dst[0] = x + 2 * (qy * uz - qz * uy) + tx;
+    dst[1] = y + 2 * (qz * ux - qx * uz) + ty;
+    dst[2] = z + 2 * (qx * uy - qy * ux) + tz;
+}
+
+/**
+ * Creates a matrix from a normalized dquat
+ *
+ * @param {mat4} out mat4 receiving operation result
+ * @param {dquat} a the dual quaternion
+ */
+GLM_API void mat4_fromDquat(mat4 dst, dquat a) {
+    vec3 t;
+
+    dquat_getTranslation(t, a);
+    mat4_fromRotationTranslation(dst, a, t);
+}
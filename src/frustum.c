@@ -0,0 +1,187 @@
+#include "frustum.h"
+#include "simd.h"
+#include <math.h>
+
+/**
+ * Extracts the frustum planes of a view-projection matrix, eg. the
+ * product of mat4_perspective and mat4_lookAt. Planes are in the space
+ * the matrix transforms from, so a projection matrix alone gives view
+ * space planes.
+ *
+ * @param {frustum} out the receiving frustum
+ * @param {mat4} m the view-projection matrix, clip z in [-1, 1]
+ */
+GLM_API void frustum_fromMat4(frustum dst, mat4 m) {
+    int i, k;
+
+    // Gribb/Hartmann: every plane is the 4th row of m plus or minus one of the others
+    for (i = 0; i < 3; i++) {
+        for (k = 0; k < 4; k++) {
+            dst[2 * i][k] = m[4 * k + 3] + m[4 * k + i];
+            dst[2 * i + 1][k] = m[4 * k + 3] - m[4 * k + i];
+        }
+    }
+    for (i = 0; i < 6; i++) {
+        float len = dst[i][0] * dst[i][0] + dst[i][1] * dst[i][1] + dst[i][2] * dst[i][2];
+        if (len > 0) {
+            len = 1 / sqrtf(len);
+        }
+        for (k = 0; k < 4; k++) {
+            dst[i][k] *= len;
+        }
+    }
+}
+
+/**
+ * Tests if a sphere is at least partly inside the frustum. Spheres near a
+ * corner of the frustum may be reported visible while outside.
+ *
+ * @param {frustum} f the frustum
+ * @param {vec3} center the center of the sphere
+ * @param {Number} radius the radius of the sphere
+ * @returns {Number} 1 if the sphere may be visible, 0 if it is outside
+ */
+GLM_API int frustum_testSphere(frustum f, vec3 center, float radius) {
+    int i;
+    for (i = 0; i < 6; i++) {
+        if (f[i][0] * center[0] + f[i][1] * center[1] + f[i][2] * center[2] + f[i][3] + radius < 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Tests if an axis aligned box is at least partly inside the frustum.
+ * Boxes near an edge of the frustum may be reported visible while outside.
+ *
+ * @param {frustum} f the frustum
+ * @param {vec3} min the minimum corner of the box
+ * @param {vec3} max the maximum corner of the box
+ * @returns {Number} 1 if the box may be visible, 0 if it is outside
+ */
+GLM_API int frustum_testAABB(frustum f, vec3 min, vec3 max) {
+    int i;
+    for (i = 0; i < 6; i++) {
+        // Only the corner furthest along the plane normal matters
+        float x = f[i][0] >= 0 ? max[0] : min[0];
+        float y = f[i][1] >= 0 ? max[1] : min[1];
+        float z = f[i][2] >= 0 ? max[2] : min[2];
+        if (f[i][0] * x + f[i][1] * y + f[i][2] * z + f[i][3] < 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Runs frustum_testSphere on a stream of spheres and writes the results
+ * as a bitmask: object i is visible when bit (i & 7) of dst[i >> 3] is set.
+ * The bits past centers->count in the last byte are cleared.
+ *
+ * @param {uint8_t[]} dst receives the bitmask, must hold
+ *                    vec3soa_paddedCount(centers->count) / 8 bytes
+ * @param {frustum} f the frustum
+ * @param {vec3soa} centers the centers of the spheres
+ * @param {float[]} radii the radii, must be aligned to VEC3SOA_ALIGNMENT
+ *                  bytes and hold vec3soa_paddedCount(centers->count) floats
+ */
+GLM_API void frustum_cullSpheres(uint8_t *dst, frustum f, vec3soa *centers, float *radii) {
+    size_t i, count = centers->count;
+#if defined(GLM_VF_WIDTH)
+    size_t n = vec3soa_paddedCount(count);
+    glm_vf zero = glm_vf_zero();
+    for (i = 0; i < n; i += GLM_VF_WIDTH) {
+        glm_vf x = glm_vf_load(centers->x + i), y = glm_vf_load(centers->y + i), z = glm_vf_load(centers->z + i);
+        glm_vf r = glm_vf_load(radii + i);
+        glm_vf out = zero;
+        unsigned bits;
+        int k;
+        for (k = 0; k < 6; k++) {
+            glm_vf dist = glm_vf_madd(glm_vf_set1(f[k][0]), x, glm_vf_add(glm_vf_set1(f[k][3]), r));
+            dist = glm_vf_madd(glm_vf_set1(f[k][1]), y, dist);
+            dist = glm_vf_madd(glm_vf_set1(f[k][2]), z, dist);
+            out = glm_vf_or(out, glm_vf_cmplt(dist, zero));
+        }
+        bits = (~(unsigned)glm_vf_movemask(out) & ((1u << GLM_VF_WIDTH) - 1)) << (i & 7);
+        if ((i & 7) == 0) {
+            dst[i >> 3] = (uint8_t)bits;
+        } else {
+            dst[i >> 3] |= (uint8_t)bits;
+        }
+    }
+    if (count & 7) {
+        dst[count >> 3] &= (uint8_t)((1u << (count & 7)) - 1);
+    }
+#else
+    for (i = 0; i < count; i++) {
+        vec3 c;
+        c[0] = centers->x[i];
+        c[1] = centers->y[i];
+        c[2] = centers->z[i];
+        if ((i & 7) == 0) {
+            dst[i >> 3] = 0;
+        }
+        if (frustum_testSphere(f, c, radii[i])) {
+            dst[i >> 3] |= (uint8_t)(1u << (i & 7));
+        }
+    }
+#endif
+}
+
+/**
+ * Runs frustum_testAABB on a stream of boxes and writes the results as a
+ * bitmask laid out as for frustum_cullSpheres.
+ *
+ * @param {uint8_t[]} dst receives the bitmask, must hold
+ *                    vec3soa_paddedCount(mins->count) / 8 bytes
+ * @param {frustum} f the frustum
+ * @param {vec3soa} mins the minimum corners of the boxes
+ * @param {vec3soa} maxs the maximum corners of the boxes
+ */
+GLM_API void frustum_cullAABBs(uint8_t *dst, frustum f, vec3soa *mins, vec3soa *maxs) {
+    size_t i, count = mins->count;
+#if defined(GLM_VF_WIDTH)
+    size_t n = vec3soa_paddedCount(count);
+    glm_vf zero = glm_vf_zero();
+    for (i = 0; i < n; i += GLM_VF_WIDTH) {
+        glm_vf minx = glm_vf_load(mins->x + i), miny = glm_vf_load(mins->y + i), minz = glm_vf_load(mins->z + i);
+        glm_vf maxx = glm_vf_load(maxs->x + i), maxy = glm_vf_load(maxs->y + i), maxz = glm_vf_load(maxs->z + i);
+        glm_vf out = zero;
+        unsigned bits;
+        int k;
+        for (k = 0; k < 6; k++) {
+            // The corner is picked per plane, not per lane
+            glm_vf dist = glm_vf_madd(glm_vf_set1(f[k][0]), f[k][0] >= 0 ? maxx : minx, glm_vf_set1(f[k][3]));
+            dist = glm_vf_madd(glm_vf_set1(f[k][1]), f[k][1] >= 0 ? maxy : miny, dist);
+            dist = glm_vf_madd(glm_vf_set1(f[k][2]), f[k][2] >= 0 ? maxz : minz, dist);
+            out = glm_vf_or(out, glm_vf_cmplt(dist, zero));
+        }
+        bits = (~(unsigned)glm_vf_movemask(out) & ((1u << GLM_VF_WIDTH) - 1)) << (i & 7);
+        if ((i & 7) == 0) {
+            dst[i >> 3] = (uint8_t)bits;
+        } else {
+            dst[i >> 3] |= (uint8_t)bits;
+        }
+    }
+    if (count & 7) {
+        dst[count >> 3] &= (uint8_t)((1u << (count & 7)) - 1);
+    }
+#else
+    for (i = 0; i < count; i++) {
+        vec3 min, max;
+        min[0] = mins->x[i];
+        min[1] = mins->y[i];
+        min[2] = mins->z[i];
+        max[0] = maxs->x[i];
+        max[1] = maxs->y[i];
+        max[2] = maxs->z[i];
+        if ((i & 7) == 0) {
+            dst[i >> 3] = 0;
+        }
+        if (frustum_testAABB(f, min, max)) {
+            dst[i >> 3] |= (uint8_t)(1u << (i & 7));
+        }
+    }
+#endif
+}
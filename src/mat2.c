@@ -1,25 +1,27 @@
 #include "mat2.h"
+#include "noalias.h"
+#include "simd.h"
 #include <math.h>
 
-void mat2_identity(mat2 dst) {
+GLM_API void mat2_identity(mat2 dst) {
     dst[0] = 1;
     dst[3] = 1;
 }
 
-void mat2_copy(mat2 dst, mat2 src) {
+GLM_API void mat2_copy(mat2 dst, mat2 src) {
     dst[0] = src[0];
     dst[1] = src[1];
     dst[2] = src[2];
     dst[3] = src[3];
 }
 
-void mat2_transpose(mat2 dst) {
+GLM_API void mat2_transpose(mat2 dst) {
     float a1 = dst[1];
     dst[1] = dst[2];
     dst[2] = a1;
 }
 
-void mat2_invert(mat2 dst) {
+GLM_API void mat2_invert(mat2 dst) {
     float a0 = dst[0];
     float a1 = dst[1];
     float a2 = dst[2];
@@ -38,7 +40,7 @@ void mat2_invert(mat2 dst) {
     dst[3] =  a0 * det;
 }
 
-void mat2_adjoint(mat2 dst) {
+GLM_API void mat2_adjoint(mat2 dst) {
     float a0 = dst[0];
     dst[0] =  dst[3];
     dst[1] = -dst[1];
@@ -46,11 +48,11 @@ void mat2_adjoint(mat2 dst) {
     dst[3] =  a0;
 }
 
-float mat2_determinant(mat2 dst) {
+GLM_API float mat2_determinant(mat2 dst) {
     return dst[0] * dst[3] - dst[2] * dst[1];
 }
 
-void mat2_multiply(mat2 dst, mat2 op) {
+GLM_API void mat2_multiply(mat2 dst, mat2 op) {
     float a0 = dst[0], a1 = dst[1], a2 = dst[2], a3 = dst[3];
     float b0 = op[0], b1 = op[1], b2 = op[2], b3 = op[3];
     dst[0] = a0 * b0 + a2 * b1;
@@ -59,17 +61,17 @@ void mat2_multiply(mat2 dst, mat2 op) {
     dst[3] = a1 * b2 + a3 * b3;
 }
 
-void mat2_rotate(mat2 dst, float rad) {
+GLM_API void mat2_rotate(mat2 dst, float rad) {
     float a0 = dst[0], a1 = dst[1], a2 = dst[2], a3 = dst[3];
-    float s = sinf(rad);
-    float c = cosf(rad);
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
     dst[0] = (a0 *  c) + (a2 * s);
     dst[1] = (a1 *  c) + (a3 * s);
     dst[2] = (a0 * -s) + (a2 * c);
     dst[3] = (a1 * -s) + (a3 * c);
 }
 
-void mat2_scale(mat2 dst, vec2 v) {
+GLM_API void mat2_scale(mat2 dst, vec2 v) {
     float a0 = dst[0], a1 = dst[1], a2 = dst[2], a3 = dst[3];
     float v0 = v[0], v1 = v[1];
     dst[0] = a0 * v0;
@@ -78,50 +80,156 @@ void mat2_scale(mat2 dst, vec2 v) {
     dst[3] = a3 * v1;
 }
 
-void mat2_fromRotation(mat2 dst, float rad) {
-    float s = sinf(rad);
-    float c = cosf(rad);
+GLM_API void mat2_fromRotation(mat2 dst, float rad) {
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
     dst[0] = c;
     dst[1] = s;
     dst[2] = -s;
     dst[3] = c;
 }
 
-void mat2_fromScaling(mat2 dst, vec2 v) {
+GLM_API void mat2_fromScaling(mat2 dst, vec2 v) {
     dst[0] = v[0];
     dst[1] = 0;
     dst[2] = 0;
     dst[3] = v[1];
 }
 
-void mat2_add(mat2 dst, mat2 b) {
+GLM_API void mat2_add(mat2 dst, mat2 b) {
     dst[0] = dst[0] + b[0];
     dst[1] = dst[1] + b[1];
     dst[2] = dst[2] + b[2];
     dst[3] = dst[3] + b[3];
 }
 
-void mat2_subtract(mat2 dst, mat2 b) {
+GLM_API void mat2_subtract(mat2 dst, mat2 b) {
     dst[0] = dst[0] - b[0];
     dst[1] = dst[1] - b[1];
     dst[2] = dst[2] - b[2];
     dst[3] = dst[3] - b[3];
 }
 
-uint8_t mat2_equals(mat2 a, mat2 b) {
+GLM_API uint8_t mat2_equals(mat2 a, mat2 b) {
   return a[0] == b[0] && a[1] == b[1] && a[2] == b[2] && a[3] == b[3];
 }
 
-void mat2_multiplyScalar(mat2 dst, float b) {
+GLM_API void mat2_multiplyScalar(mat2 dst, float b) {
     dst[0] = dst[0] * b;
     dst[1] = dst[1] * b;
     dst[2] = dst[2] * b;
     dst[3] = dst[3] * b;
 }
 
-void mat2_multiplyScalarAndAdd(mat2 dst, mat2 b, float scale) {
+GLM_API void mat2_multiplyScalarAndAdd(mat2 dst, mat2 b, float scale) {
     dst[0] = dst[0] + (b[0] * scale);
     dst[1] = dst[1] + (b[1] * scale);
     dst[2] = dst[2] + (b[2] * scale);
     dst[3] = dst[3] + (b[3] * scale);
 }
+
+GLM_API void mat2_transposeTo(float *GLM_RESTRICT out, mat2 a) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    out[0] = a[0];
+    out[1] = a[2];
+    out[2] = a[1];
+    out[3] = a[3];
+}
+
+GLM_API void mat2_invertTo(float *GLM_RESTRICT out, mat2 a) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    float a0 = a[0];
+    float a1 = a[1];
+    float a2 = a[2];
+    float a3 = a[3];
+
+    float det = (a0 * a3) - (a2 * a1);
+
+    if (!det) {
+        mat2_copy(out, a);
+        return;
+    }
+    det = 1.0 / det;
+
+    out[0] =  a3 * det;
+    out[1] = -a1 * det;
+    out[2] = -a2 * det;
+    out[3] =  a0 * det;
+}
+
+GLM_API void mat2_adjointTo(float *GLM_RESTRICT out, mat2 a) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    float a0 = a[0];
+    out[0] =  a[3];
+    out[1] = -a[1];
+    out[2] = -a[2];
+    out[3] =  a0;
+}
+
+GLM_API void mat2_multiplyTo(float *GLM_RESTRICT out, mat2 a, mat2 op) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, op, 4);
+    float a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+    float b0 = op[0], b1 = op[1], b2 = op[2], b3 = op[3];
+    out[0] = a0 * b0 + a2 * b1;
+    out[1] = a1 * b0 + a3 * b1;
+    out[2] = a0 * b2 + a2 * b3;
+    out[3] = a1 * b2 + a3 * b3;
+}
+
+GLM_API void mat2_rotateTo(float *GLM_RESTRICT out, mat2 a, float rad) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    float a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
+    out[0] = (a0 *  c) + (a2 * s);
+    out[1] = (a1 *  c) + (a3 * s);
+    out[2] = (a0 * -s) + (a2 * c);
+    out[3] = (a1 * -s) + (a3 * c);
+}
+
+GLM_API void mat2_scaleTo(float *GLM_RESTRICT out, mat2 a, vec2 v) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, v, 2);
+    float a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+    float v0 = v[0], v1 = v[1];
+    out[0] = a0 * v0;
+    out[1] = a1 * v0;
+    out[2] = a2 * v1;
+    out[3] = a3 * v1;
+}
+
+GLM_API void mat2_addTo(float *GLM_RESTRICT out, mat2 a, mat2 b) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    out[0] = a[0] + b[0];
+    out[1] = a[1] + b[1];
+    out[2] = a[2] + b[2];
+    out[3] = a[3] + b[3];
+}
+
+GLM_API void mat2_subtractTo(float *GLM_RESTRICT out, mat2 a, mat2 b) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    out[0] = a[0] - b[0];
+    out[1] = a[1] - b[1];
+    out[2] = a[2] - b[2];
+    out[3] = a[3] - b[3];
+}
+
+GLM_API void mat2_multiplyScalarTo(float *GLM_RESTRICT out, mat2 a, float b) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    out[0] = a[0] * b;
+    out[1] = a[1] * b;
+    out[2] = a[2] * b;
+    out[3] = a[3] * b;
+}
+
+GLM_API void mat2_multiplyScalarAndAddTo(float *GLM_RESTRICT out, mat2 a, mat2 b, float scale) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    out[0] = a[0] + (b[0] * scale);
+    out[1] = a[1] + (b[1] * scale);
+    out[2] = a[2] + (b[2] * scale);
+    out[3] = a[3] + (b[3] * scale);
+}
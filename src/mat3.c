@@ -1,4 +1,6 @@
 #include "mat3.h"
+#include "noalias.h"
+#include "simd.h"
 #include <math.h>
 
 /**
@@ -7,7 +9,7 @@
  * @param {mat3} out the receiving 3x3 matrix
  * @param {mat4} a   the source 4x4 matrix
  */
-void mat3_fromMat4(mat3 dst, mat4 a) {
+GLM_API void mat3_fromMat4(mat3 dst, mat4 a) {
     dst[0] = a[0];
     dst[1] = a[1];
     dst[2] = a[2];
@@ -25,7 +27,7 @@ void mat3_fromMat4(mat3 dst, mat4 a) {
  * @param {mat3} out the receiving matrix
  * @param {mat3} a the source matrix
  */
-void mat3_copy(mat3 dst, mat3 a) {
+GLM_API void mat3_copy(mat3 dst, mat3 a) {
     dst[0] = a[0];
     dst[1] = a[1];
     dst[2] = a[2];
@@ -51,7 +53,7 @@ void mat3_copy(mat3 dst, mat3 a) {
  * @param {Number} m21 Component in column 2, row 1 position (index 7)
  * @param {Number} m22 Component in column 2, row 2 position (index 8)
  */
-void mat3_set(mat3 dst, float m00, float m01, float m02, float m10, float m11, float m12, float m20, float m21, float m22) {
+GLM_API void mat3_set(mat3 dst, float m00, float m01, float m02, float m10, float m11, float m12, float m20, float m21, float m22) {
     dst[0] = m00;
     dst[1] = m01;
     dst[2] = m02;
@@ -68,7 +70,7 @@ void mat3_set(mat3 dst, float m00, float m01, float m02, float m10, float m11, f
  *
  * @param {mat3} out the receiving matrix
  */
-void mat3_identity(mat3 dst) {
+GLM_API void mat3_identity(mat3 dst) {
     dst[0] = 1;
     dst[1] = 0;
     dst[2] = 0;
@@ -85,7 +87,7 @@ void mat3_identity(mat3 dst) {
  *
  * @param {mat3} out the receiving matrix
  */
-void mat3_transpose(mat3 dst) {
+GLM_API void mat3_transpose(mat3 dst) {
     // If we are transposing ourselves we can skip a few steps but have to cache some values
     float a01 = dst[1], a02 = dst[2], a12 = dst[5];
     dst[1] = dst[3];
@@ -102,7 +104,7 @@ void mat3_transpose(mat3 dst) {
  * @param {mat3} out the receiving matrix
  * @returns {mat3} out
  */
-void mat3_invert(mat3 dst) {
+GLM_API void mat3_invert(mat3 dst) {
     float a00 = dst[0], a01 = dst[1], a02 = dst[2];
     float a10 = dst[3], a11 = dst[4], a12 = dst[5];
     float a20 = dst[6], a21 = dst[7], a22 = dst[8];
@@ -135,7 +137,7 @@ void mat3_invert(mat3 dst) {
  *
  * @param {mat3} out the receiving matrix
  */
-void mat3_adjoint(mat3 dst) {
+GLM_API void mat3_adjoint(mat3 dst) {
     float a00 = dst[0], a01 = dst[1], a02 = dst[2];
     float a10 = dst[3], a11 = dst[4], a12 = dst[5];
     float a20 = dst[6], a21 = dst[7], a22 = dst[8];
@@ -157,7 +159,7 @@ void mat3_adjoint(mat3 dst) {
  * @param {mat3} a the source matrix
  * @returns {Number} determinant of a
  */
-float mat3_determinant(mat3 dst) {
+GLM_API float mat3_determinant(mat3 dst) {
     float a00 = dst[0], a01 = dst[1], a02 = dst[2];
     float a10 = dst[3], a11 = dst[4], a12 = dst[5];
     float a20 = dst[6], a21 = dst[7], a22 = dst[8];
@@ -171,7 +173,7 @@ float mat3_determinant(mat3 dst) {
  * @param {mat3} out the receiving matrix
  * @param {mat3} b the second operand
  */
-void mat3_multiply(mat3 dst, mat3 b) {
+GLM_API void mat3_multiply(mat3 dst, mat3 b) {
     float a00 = dst[0], a01 = dst[1], a02 = dst[2];
     float a10 = dst[3], a11 = dst[4], a12 = dst[5];
     float a20 = dst[6], a21 = dst[7], a22 = dst[8];
@@ -199,7 +201,7 @@ void mat3_multiply(mat3 dst, mat3 b) {
  * @param {mat3} out the receiving matrix
  * @param {vec2} v vector to translate by
  */
-void mat3_translate(mat3 dst, vec2 v) {
+GLM_API void mat3_translate(mat3 dst, vec2 v) {
     float a00 = dst[0], a01 = dst[1], a02 = dst[2],
         a10 = dst[3], a11 = dst[4], a12 = dst[5],
         a20 = dst[6], a21 = dst[7], a22 = dst[8],
@@ -224,13 +226,13 @@ void mat3_translate(mat3 dst, vec2 v) {
  * @param {mat3} out the receiving matrix
  * @param {Number} rad the angle to rotate the matrix by
  */
-void mat3_rotate(mat3 dst, float rad) {
+GLM_API void mat3_rotate(mat3 dst, float rad) {
     float a00 = dst[0], a01 = dst[1], a02 = dst[2],
         a10 = dst[3], a11 = dst[4], a12 = dst[5],
         a20 = dst[6], a21 = dst[7], a22 = dst[8],
+        s, c;
 
-    s = sinf(rad),
-    c = cosf(rad);
+    glm_rotation_sincos(rad, &s, &c);
 
     dst[0] = c * a00 + s * a10;
     dst[1] = c * a01 + s * a11;
@@ -251,7 +253,7 @@ void mat3_rotate(mat3 dst, float rad) {
  * @param {mat3} out the receiving matrix
  * @param {vec2} v the vec2 to scale the matrix by
  **/
-void mat3_scale(mat3 dst, vec2 v) {
+GLM_API void mat3_scale(mat3 dst, vec2 v) {
     float x = v[0], y = v[1];
 
     dst[0] = x * dst[0];
@@ -277,7 +279,7 @@ void mat3_scale(mat3 dst, vec2 v) {
  * @param {mat3} out mat3 receiving operation result
  * @param {vec2} v Translation vector
  */
-void mat3_fromTranslation(mat3 dst, vec2 v) {
+GLM_API void mat3_fromTranslation(mat3 dst, vec2 v) {
     dst[0] = 1;
     dst[1] = 0;
     dst[2] = 0;
@@ -300,8 +302,9 @@ void mat3_fromTranslation(mat3 dst, vec2 v) {
  * @param {Number} rad the angle to rotate the matrix by
  * @returns {mat3} out
  */
-void mat3_fromRotation(mat3 dst, float rad) {
-    float s = sinf(rad), c = cosf(rad);
+GLM_API void mat3_fromRotation(mat3 dst, float rad) {
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
 
     dst[0] = c;
     dst[1] = s;
@@ -326,7 +329,7 @@ void mat3_fromRotation(mat3 dst, float rad) {
  * @param {mat3} out mat3 receiving operation result
  * @param {vec2} v Scaling vector
  */
-void mat3_fromScaling(mat3 dst, vec2 v) {
+GLM_API void mat3_fromScaling(mat3 dst, vec2 v) {
     dst[0] = v[0];
     dst[1] = 0;
     dst[2] = 0;
@@ -346,7 +349,7 @@ void mat3_fromScaling(mat3 dst, vec2 v) {
  * @param {mat3} out the receiving matrix
  * @param {mat2d} a the matrix to copy
  **/
-void mat3_fromMat2d(mat3 dst, mat2 a) {
+GLM_API void mat3_fromMat2d(mat3 dst, mat2 a) {
     dst[0] = a[0];
     dst[1] = a[1];
     dst[2] = 0;
@@ -366,7 +369,7 @@ void mat3_fromMat2d(mat3 dst, mat2 a) {
 * @param {mat3} out mat3 receiving operation result
 * @param {quat} q Quaternion to create matrix from
 */
-void mat3_fromQuat(mat3 dst, quat q) {
+GLM_API void mat3_fromQuat(mat3 dst, quat q) {
     float x = q[0], y = q[1], z = q[2], w = q[3];
     float x2 = x + x;
     float y2 = y + y;
@@ -401,7 +404,7 @@ void mat3_fromQuat(mat3 dst, quat q) {
 * @param {mat3} out mat3 receiving operation result
 * @param {mat4} a Mat4 to derive the normal matrix from
 */
-void mat3_normalFromMat4(mat3 dst, mat4 a) {
+GLM_API void mat3_normalFromMat4(mat3 dst, mat4 a) {
     float a00 = a[0], a01 = a[1], a02 = a[2], a03 = a[3];
     float a10 = a[4], a11 = a[5], a12 = a[6], a13 = a[7];
     float a20 = a[8], a21 = a[9], a22 = a[10], a23 = a[11];
@@ -448,7 +451,7 @@ void mat3_normalFromMat4(mat3 dst, mat4 a) {
  * @param {number} width Width of your gl context
  * @param {number} height Height of gl context
  */
-void mat3_projection(mat3 dst, float width, float height) {
+GLM_API void mat3_projection(mat3 dst, float width, float height) {
     dst[0] = 2 / width;
     dst[1] = 0;
     dst[2] = 0;
@@ -466,7 +469,7 @@ void mat3_projection(mat3 dst, float width, float height) {
  * @param {mat3} a the matrix to calculate Frobenius norm of
  * @returns {Number} Frobenius norm
  */
-float mat3_frob(mat3 a) {
+GLM_API float mat3_frob(mat3 a) {
   return (sqrtf(powf(a[0], 2) + powf(a[1], 2) + powf(a[2], 2) + powf(a[3], 2) + powf(a[4], 2) + powf(a[5], 2) + powf(a[6], 2) + powf(a[7], 2) + powf(a[8], 2)));
 }
 
@@ -476,7 +479,7 @@ float mat3_frob(mat3 a) {
  * @param {mat3} out the receiving matrix
  * @param {mat3} b the second operand
  */
-void mat3_add(mat3 dst, mat3 b) {
+GLM_API void mat3_add(mat3 dst, mat3 b) {
     dst[0] = dst[0] + b[0];
     dst[1] = dst[1] + b[1];
     dst[2] = dst[2] + b[2];
@@ -494,7 +497,7 @@ void mat3_add(mat3 dst, mat3 b) {
  * @param {mat3} out the receiving matrix
  * @param {mat3} b the second operand
  */
-void mat3_subtract(mat3 dst, mat3 b) {
+GLM_API void mat3_subtract(mat3 dst, mat3 b) {
     dst[0] = dst[0] - b[0];
     dst[1] = dst[1] - b[1];
     dst[2] = dst[2] - b[2];
@@ -512,7 +515,7 @@ void mat3_subtract(mat3 dst, mat3 b) {
  * @param {mat3} out the receiving matrix
  * @param {Number} b amount to scale the matrix's elements by
  */
-void mat3_multiplyScalar(mat3 dst, float b) {
+GLM_API void mat3_multiplyScalar(mat3 dst, float b) {
     dst[0] = dst[0] * b;
     dst[1] = dst[1] * b;
     dst[2] = dst[2] * b;
@@ -531,7 +534,7 @@ void mat3_multiplyScalar(mat3 dst, float b) {
  * @param {mat3} b the second operand
  * @param {Number} scale the amount to scale b's elements by before adding
  */
-void mat3_multiplyScalarAndAdd(mat3 dst, mat3 b, float scale) {
+GLM_API void mat3_multiplyScalarAndAdd(mat3 dst, mat3 b, float scale) {
     dst[0] = dst[0] + (b[0] * scale);
     dst[1] = dst[1] + (b[1] * scale);
     dst[2] = dst[2] + (b[2] * scale);
@@ -550,8 +553,284 @@ void mat3_multiplyScalarAndAdd(mat3 dst, mat3 b, float scale) {
  * @param {mat3} b The second matrix.
  * @returns {uint8_t} 1 if the matrices are equal, 0 otherwise.
  */
-uint8_t mat3_equals(mat3 a, mat3 b) {
+GLM_API uint8_t mat3_equals(mat3 a, mat3 b) {
     return a[0] == b[0] && a[1] == b[1] && a[2] == b[2] &&
         a[3] == b[3] && a[4] == b[4] && a[5] == b[5] &&
         a[6] == b[6] && a[7] == b[7] && a[8] == b[8];
 }
+
+/**
+ * Transpose the values of a mat3
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ */
+GLM_API void mat3_transposeTo(float *GLM_RESTRICT out, mat3 a) {
+    GLM_ASSERT_NOALIAS(out, 9, a, 9);
+    out[0] = a[0];
+    out[1] = a[3];
+    out[2] = a[6];
+    out[3] = a[1];
+    out[4] = a[4];
+    out[5] = a[7];
+    out[6] = a[2];
+    out[7] = a[5];
+    out[8] = a[8];
+}
+
+/**
+ * Inverts a mat3
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @returns {mat3} out
+ */
+GLM_API void mat3_invertTo(float *GLM_RESTRICT out, mat3 a) {
+    GLM_ASSERT_NOALIAS(out, 9, a, 9);
+    float a00 = a[0], a01 = a[1], a02 = a[2];
+    float a10 = a[3], a11 = a[4], a12 = a[5];
+    float a20 = a[6], a21 = a[7], a22 = a[8];
+
+    float b01 = a22 * a11 - a12 * a21;
+    float b11 = -a22 * a10 + a12 * a20;
+    float b21 = a21 * a10 - a11 * a20;
+
+    // Calculate the determinant
+    float det = a00 * b01 + a01 * b11 + a02 * b21;
+
+    if (!det) {
+        mat3_copy(out, a);
+        return;
+    }
+    det = 1.0 / det;
+
+    out[0] = b01 * det;
+    out[1] = (-a22 * a01 + a02 * a21) * det;
+    out[2] = (a12 * a01 - a02 * a11) * det;
+    out[3] = b11 * det;
+    out[4] = (a22 * a00 - a02 * a20) * det;
+    out[5] = (-a12 * a00 + a02 * a10) * det;
+    out[6] = b21 * det;
+    out[7] = (-a21 * a00 + a01 * a20) * det;
+    out[8] = (a11 * a00 - a01 * a10) * det;
+}
+
+/**
+ * Calculates the adjugate of a mat3
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ */
+GLM_API void mat3_adjointTo(float *GLM_RESTRICT out, mat3 a) {
+    GLM_ASSERT_NOALIAS(out, 9, a, 9);
+    float a00 = a[0], a01 = a[1], a02 = a[2];
+    float a10 = a[3], a11 = a[4], a12 = a[5];
+    float a20 = a[6], a21 = a[7], a22 = a[8];
+
+    out[0] = (a11 * a22 - a12 * a21);
+    out[1] = (a02 * a21 - a01 * a22);
+    out[2] = (a01 * a12 - a02 * a11);
+    out[3] = (a12 * a20 - a10 * a22);
+    out[4] = (a00 * a22 - a02 * a20);
+    out[5] = (a02 * a10 - a00 * a12);
+    out[6] = (a10 * a21 - a11 * a20);
+    out[7] = (a01 * a20 - a00 * a21);
+    out[8] = (a00 * a11 - a01 * a10);
+}
+
+/**
+ * Multiplies two mat3's
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {mat3} b the second operand
+ */
+GLM_API void mat3_multiplyTo(float *GLM_RESTRICT out, mat3 a, mat3 b) {
+    GLM_ASSERT_NOALIAS(out, 9, a, 9);
+    GLM_ASSERT_NOALIAS(out, 9, b, 9);
+    float a00 = a[0], a01 = a[1], a02 = a[2];
+    float a10 = a[3], a11 = a[4], a12 = a[5];
+    float a20 = a[6], a21 = a[7], a22 = a[8];
+
+    float b00 = b[0], b01 = b[1], b02 = b[2];
+    float b10 = b[3], b11 = b[4], b12 = b[5];
+    float b20 = b[6], b21 = b[7], b22 = b[8];
+
+    out[0] = b00 * a00 + b01 * a10 + b02 * a20;
+    out[1] = b00 * a01 + b01 * a11 + b02 * a21;
+    out[2] = b00 * a02 + b01 * a12 + b02 * a22;
+
+    out[3] = b10 * a00 + b11 * a10 + b12 * a20;
+    out[4] = b10 * a01 + b11 * a11 + b12 * a21;
+    out[5] = b10 * a02 + b11 * a12 + b12 * a22;
+
+    out[6] = b20 * a00 + b21 * a10 + b22 * a20;
+    out[7] = b20 * a01 + b21 * a11 + b22 * a21;
+    out[8] = b20 * a02 + b21 * a12 + b22 * a22;
+}
+
+/**
+ * Translate a mat3 by the given vector
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {vec2} v vector to translate by
+ */
+GLM_API void mat3_translateTo(float *GLM_RESTRICT out, mat3 a, vec2 v) {
+    GLM_ASSERT_NOALIAS(out, 9, a, 9);
+    GLM_ASSERT_NOALIAS(out, 9, v, 2);
+    float a00 = a[0], a01 = a[1], a02 = a[2],
+        a10 = a[3], a11 = a[4], a12 = a[5],
+        a20 = a[6], a21 = a[7], a22 = a[8],
+        x = v[0], y = v[1];
+
+    out[0] = a00;
+    out[1] = a01;
+    out[2] = a02;
+
+    out[3] = a10;
+    out[4] = a11;
+    out[5] = a12;
+
+    out[6] = x * a00 + y * a10 + a20;
+    out[7] = x * a01 + y * a11 + a21;
+    out[8] = x * a02 + y * a12 + a22;
+}
+
+/**
+ * Rotates a mat3 by the given angle
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {Number} rad the angle to rotate the matrix by
+ */
+GLM_API void mat3_rotateTo(float *GLM_RESTRICT out, mat3 a, float rad) {
+    GLM_ASSERT_NOALIAS(out, 9, a, 9);
+    float a00 = a[0], a01 = a[1], a02 = a[2],
+        a10 = a[3], a11 = a[4], a12 = a[5],
+        a20 = a[6], a21 = a[7], a22 = a[8],
+        s, c;
+
+    glm_rotation_sincos(rad, &s, &c);
+
+    out[0] = c * a00 + s * a10;
+    out[1] = c * a01 + s * a11;
+    out[2] = c * a02 + s * a12;
+
+    out[3] = c * a10 - s * a00;
+    out[4] = c * a11 - s * a01;
+    out[5] = c * a12 - s * a02;
+
+    out[6] = a20;
+    out[7] = a21;
+    out[8] = a22;
+}
+
+/**
+ * Scales the mat3 by the dimensions in the given vec2
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {vec2} v the vec2 to scale the matrix by
+ **/
+GLM_API void mat3_scaleTo(float *GLM_RESTRICT out, mat3 a, vec2 v) {
+    GLM_ASSERT_NOALIAS(out, 9, a, 9);
+    GLM_ASSERT_NOALIAS(out, 9, v, 2);
+    float x = v[0], y = v[1];
+
+    out[0] = x * a[0];
+    out[1] = x * a[1];
+    out[2] = x * a[2];
+
+    out[3] = y * a[3];
+    out[4] = y * a[4];
+    out[5] = y * a[5];
+
+    out[6] = a[6];
+    out[7] = a[7];
+    out[8] = a[8];
+}
+
+/**
+ * Adds two mat3's
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {mat3} b the second operand
+ */
+GLM_API void mat3_addTo(float *GLM_RESTRICT out, mat3 a, mat3 b) {
+    GLM_ASSERT_NOALIAS(out, 9, a, 9);
+    GLM_ASSERT_NOALIAS(out, 9, b, 9);
+    out[0] = a[0] + b[0];
+    out[1] = a[1] + b[1];
+    out[2] = a[2] + b[2];
+    out[3] = a[3] + b[3];
+    out[4] = a[4] + b[4];
+    out[5] = a[5] + b[5];
+    out[6] = a[6] + b[6];
+    out[7] = a[7] + b[7];
+    out[8] = a[8] + b[8];
+}
+
+/**
+ * Subtracts matrix b from matrix a
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {mat3} b the second operand
+ */
+GLM_API void mat3_subtractTo(float *GLM_RESTRICT out, mat3 a, mat3 b) {
+    GLM_ASSERT_NOALIAS(out, 9, a, 9);
+    GLM_ASSERT_NOALIAS(out, 9, b, 9);
+    out[0] = a[0] - b[0];
+    out[1] = a[1] - b[1];
+    out[2] = a[2] - b[2];
+    out[3] = a[3] - b[3];
+    out[4] = a[4] - b[4];
+    out[5] = a[5] - b[5];
+    out[6] = a[6] - b[6];
+    out[7] = a[7] - b[7];
+    out[8] = a[8] - b[8];
+}
+
+/**
+ * Multiply each element of the matrix by a scalar.
+ *
+ * @param {mat3} out the receiving matrix, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {Number} b amount to scale the matrix's elements by
+ */
+GLM_API void mat3_multiplyScalarTo(float *GLM_RESTRICT out, mat3 a, float b) {
+    GLM_ASSERT_NOALIAS(out, 9, a, 9);
+    out[0] = a[0] * b;
+    out[1] = a[1] * b;
+    out[2] = a[2] * b;
+    out[3] = a[3] * b;
+    out[4] = a[4] * b;
+    out[5] = a[5] * b;
+    out[6] = a[6] * b;
+    out[7] = a[7] * b;
+    out[8] = a[8] * b;
+}
+
+/**
+ * Adds two mat3's after multiplying each element of the second operand by a scalar value.
+ *
+ * @param {mat3} out the receiving vector, must not overlap the other arguments
+ * @param {mat3} a the source matrix
+ * @param {mat3} b the second operand
+ * @param {Number} scale the amount to scale b's elements by before adding
+ */
+GLM_API void mat3_multiplyScalarAndAddTo(float *GLM_RESTRICT out, mat3 a, mat3 b, float scale) {
+    GLM_ASSERT_NOALIAS(out, 9, a, 9);
+    GLM_ASSERT_NOALIAS(out, 9, b, 9);
+    out[0] = a[0] + (b[0] * scale);
+    out[1] = a[1] + (b[1] * scale);
+    out[2] = a[2] + (b[2] * scale);
+    out[3] = a[3] + (b[3] * scale);
+    out[4] = a[4] + (b[4] * scale);
+    out[5] = a[5] + (b[5] * scale);
+    out[6] = a[6] + (b[6] * scale);
+    out[7] = a[7] + (b[7] * scale);
+    out[8] = a[8] + (b[8] * scale);
+}
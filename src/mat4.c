@@ -1,10 +1,12 @@
-#include "mat2.h"
+#include "mat4.h"
 #include "epsilon.h"
+#include "simd.h"
+#include "noalias.h"
 #include <math.h>
 #include <float.h>
 #include <stdio.h>
 
-void mat4_dump(mat4 dst) {
+GLM_API void mat4_dump(mat4 dst) {
     if (!dst) {
         fprintf(stderr, "mat4_dump(): undefined matrix\n");
         return;
@@ -19,7 +21,7 @@ void mat4_dump(mat4 dst) {
     fprintf(stderr, "\n");
 }
 
-void mat4_identity(mat4 dst) {
+GLM_API void mat4_identity(mat4 dst) {
     dst[0] = 1;
     dst[1] = 0;
     dst[2] = 0;
@@ -38,7 +40,10 @@ void mat4_identity(mat4 dst) {
     dst[15] = 1;
 }
 
-void mat4_copy(mat4 dst, mat4 src) {
+GLM_API void mat4_copy(mat4 dst, mat4 src) {
+#if defined(GLM_SSE4)
+    glm_mat4_copy_sse4(dst, src);
+#else
     dst[0] = src[0];
     dst[1] = src[1];
     dst[2] = src[2];
@@ -55,9 +60,10 @@ void mat4_copy(mat4 dst, mat4 src) {
     dst[13] = src[13];
     dst[14] = src[14];
     dst[15] = src[15];
+#endif
 }
 
-void mat4_set(mat4 dst, float m00, float m01, float m02, float m03, float m10, float m11, float m12, float m13, float m20, float m21, float m22, float m23, float m30, float m31, float m32, float m33) {
+GLM_API void mat4_set(mat4 dst, float m00, float m01, float m02, float m03, float m10, float m11, float m12, float m13, float m20, float m21, float m22, float m23, float m30, float m31, float m32, float m33) {
     dst[0] = m00;
     dst[1] = m01;
     dst[2] = m02;
@@ -76,7 +82,11 @@ void mat4_set(mat4 dst, float m00, float m01, float m02, float m03, float m10, f
     dst[15] = m33;
 }
 
-void mat4_transpose(mat4 dst) {
+GLM_API void mat4_transpose(mat4 dst) {
+#if defined(GLM_SSE4)
+    glm_mat4_transpose_sse4(dst, dst);
+#else
+    GLM_DISPATCH_RETURN(mat4_transpose, dst, dst);
     float a01 = dst[1], a02 = dst[2], a03 = dst[3];
     float a12 = dst[6], a13 = dst[7];
     float a23 = dst[11];
@@ -93,9 +103,14 @@ void mat4_transpose(mat4 dst) {
     dst[12] = a03;
     dst[13] = a13;
     dst[14] = a23;
+#endif
 }
 
-void mat4_invert(mat4 dst) {
+GLM_API void mat4_invert(mat4 dst) {
+#if defined(GLM_SSE4)
+    glm_mat4_invert_sse4(dst, dst);
+#else
+    GLM_DISPATCH_RETURN(mat4_invert, dst, dst);
     float a00 = dst[0], a01 = dst[1], a02 = dst[2], a03 = dst[3];
     float a10 = dst[4], a11 = dst[5], a12 = dst[6], a13 = dst[7];
     float a20 = dst[8], a21 = dst[9], a22 = dst[10], a23 = dst[11];
@@ -137,9 +152,66 @@ void mat4_invert(mat4 dst) {
     dst[13] = (a00 * b09 - a01 * b07 + a02 * b06) * det;
     dst[14] = (a31 * b01 - a30 * b03 - a32 * b00) * det;
     dst[15] = (a20 * b03 - a21 * b01 + a22 * b00) * det;
+#endif
 }
 
-void mat4_adjoint(mat4 dst) {
+GLM_API void mat4_invertAffine(mat4 dst) {
+    float a00 = dst[0], a01 = dst[1], a02 = dst[2];
+    float a10 = dst[4], a11 = dst[5], a12 = dst[6];
+    float a20 = dst[8], a21 = dst[9], a22 = dst[10];
+    float tx = dst[12], ty = dst[13], tz = dst[14];
+
+    float b01 = a22 * a11 - a12 * a21;
+    float b11 = -a22 * a10 + a12 * a20;
+    float b21 = a21 * a10 - a11 * a20;
+
+    // Determinant of the upper 3x3, the projective row does not contribute
+    float det = a00 * b01 + a01 * b11 + a02 * b21;
+
+    if (!det) {
+        return;
+    }
+    det = 1.0 / det;
+
+    dst[0] = b01 * det;
+    dst[1] = (-a22 * a01 + a02 * a21) * det;
+    dst[2] = (a12 * a01 - a02 * a11) * det;
+    dst[3] = 0;
+    dst[4] = b11 * det;
+    dst[5] = (a22 * a00 - a02 * a20) * det;
+    dst[6] = (-a12 * a00 + a02 * a10) * det;
+    dst[7] = 0;
+    dst[8] = b21 * det;
+    dst[9] = (-a21 * a00 + a01 * a20) * det;
+    dst[10] = (a11 * a00 - a01 * a10) * det;
+    dst[11] = 0;
+
+    // Translation of the inverse is -inverse(upper 3x3) * t
+    dst[12] = -(dst[0] * tx + dst[4] * ty + dst[8] * tz);
+    dst[13] = -(dst[1] * tx + dst[5] * ty + dst[9] * tz);
+    dst[14] = -(dst[2] * tx + dst[6] * ty + dst[10] * tz);
+    dst[15] = 1;
+}
+
+GLM_API void mat4_invertRigid(mat4 dst) {
+    float a01 = dst[1], a02 = dst[2], a12 = dst[6];
+    float tx = dst[12], ty = dst[13], tz = dst[14];
+
+    dst[1] = dst[4];
+    dst[2] = dst[8];
+    dst[6] = dst[9];
+    dst[4] = a01;
+    dst[8] = a02;
+    dst[9] = a12;
+    dst[3] = dst[7] = dst[11] = 0;
+
+    dst[12] = -(dst[0] * tx + dst[4] * ty + dst[8] * tz);
+    dst[13] = -(dst[1] * tx + dst[5] * ty + dst[9] * tz);
+    dst[14] = -(dst[2] * tx + dst[6] * ty + dst[10] * tz);
+    dst[15] = 1;
+}
+
+GLM_API void mat4_adjoint(mat4 dst) {
     float a00 = dst[0], a01 = dst[1], a02 = dst[2], a03 = dst[3];
     float a10 = dst[4], a11 = dst[5], a12 = dst[6], a13 = dst[7];
     float a20 = dst[8], a21 = dst[9], a22 = dst[10], a23 = dst[11];
@@ -163,7 +235,7 @@ void mat4_adjoint(mat4 dst) {
     dst[15] =  (a00 * (a11 * a22 - a12 * a21) - a10 * (a01 * a22 - a02 * a21) + a20 * (a01 * a12 - a02 * a11));
 }
 
-float mat4_determinant(mat4 dst) {
+GLM_API float mat4_determinant(mat4 dst) {
     float a00 = dst[0], a01 = dst[1], a02 = dst[2], a03 = dst[3];
     float a10 = dst[4], a11 = dst[5], a12 = dst[6], a13 = dst[7];
     float a20 = dst[8], a21 = dst[9], a22 = dst[10], a23 = dst[11];
@@ -185,7 +257,13 @@ float mat4_determinant(mat4 dst) {
     return b00 * b11 - b01 * b10 + b02 * b09 + b03 * b08 - b04 * b07 + b05 * b06;
 }
 
-void mat4_multiply(mat4 dst, mat4 b) {
+GLM_API void mat4_multiply(mat4 dst, mat4 b) {
+#if defined(GLM_AVX2)
+    glm_mat4_multiply_avx2(dst, dst, b);
+#elif defined(GLM_SSE4)
+    glm_mat4_multiply_sse4(dst, dst, b);
+#else
+    GLM_DISPATCH_RETURN(mat4_multiply, dst, dst, b);
     float a00 = dst[0], a01 = dst[1], a02 = dst[2], a03 = dst[3];
     float a10 = dst[4], a11 = dst[5], a12 = dst[6], a13 = dst[7];
     float a20 = dst[8], a21 = dst[9], a22 = dst[10], a23 = dst[11];
@@ -215,9 +293,74 @@ void mat4_multiply(mat4 dst, mat4 b) {
     dst[13] = b0*a01 + b1*a11 + b2*a21 + b3*a31;
     dst[14] = b0*a02 + b1*a12 + b2*a22 + b3*a32;
     dst[15] = b0*a03 + b1*a13 + b2*a23 + b3*a33;
+#endif
+}
+
+GLM_API void mat4_multiplyAffine(mat4 dst, mat4 b) {
+#if defined(GLM_AVX2)
+    glm_mat4_multiplyAffine_avx2(dst, dst, b);
+#elif defined(GLM_SSE4)
+    glm_mat4_multiplyAffine_sse4(dst, dst, b);
+#else
+    GLM_DISPATCH_RETURN(mat4_multiplyAffine, dst, dst, b);
+    float a00 = dst[0], a01 = dst[1], a02 = dst[2];
+    float a10 = dst[4], a11 = dst[5], a12 = dst[6];
+    float a20 = dst[8], a21 = dst[9], a22 = dst[10];
+    float a30 = dst[12], a31 = dst[13], a32 = dst[14];
+
+    float b0 = b[0], b1 = b[1], b2 = b[2];
+    dst[0] = b0*a00 + b1*a10 + b2*a20;
+    dst[1] = b0*a01 + b1*a11 + b2*a21;
+    dst[2] = b0*a02 + b1*a12 + b2*a22;
+    dst[3] = 0;
+
+    b0 = b[4]; b1 = b[5]; b2 = b[6];
+    dst[4] = b0*a00 + b1*a10 + b2*a20;
+    dst[5] = b0*a01 + b1*a11 + b2*a21;
+    dst[6] = b0*a02 + b1*a12 + b2*a22;
+    dst[7] = 0;
+
+    b0 = b[8]; b1 = b[9]; b2 = b[10];
+    dst[8] = b0*a00 + b1*a10 + b2*a20;
+    dst[9] = b0*a01 + b1*a11 + b2*a21;
+    dst[10] = b0*a02 + b1*a12 + b2*a22;
+    dst[11] = 0;
+
+    b0 = b[12]; b1 = b[13]; b2 = b[14];
+    dst[12] = b0*a00 + b1*a10 + b2*a20 + a30;
+    dst[13] = b0*a01 + b1*a11 + b2*a21 + a31;
+    dst[14] = b0*a02 + b1*a12 + b2*a22 + a32;
+    dst[15] = 1;
+#endif
 }
 
-void mat4_translate(mat4 dst, vec3 v) {
+GLM_API mat4_kind mat4_classify(mat4 a) {
+    float a00 = a[0], a01 = a[1], a02 = a[2];
+    float a10 = a[4], a11 = a[5], a12 = a[6];
+    float a20 = a[8], a21 = a[9], a22 = a[10];
+
+    if (a[3] != 0 || a[7] != 0 || a[11] != 0 || a[15] != 1) {
+        return MAT4_GENERAL;
+    }
+    if (a00 == 1 && a01 == 0 && a02 == 0 &&
+        a10 == 0 && a11 == 1 && a12 == 0 &&
+        a20 == 0 && a21 == 0 && a22 == 1) {
+        return a[12] == 0 && a[13] == 0 && a[14] == 0 ? MAT4_IDENTITY : MAT4_TRANSLATION;
+    }
+
+    // Columns must be unit length and perpendicular to each other
+    if (fabsf(a00*a00 + a01*a01 + a02*a02 - 1) < EPSILON &&
+        fabsf(a10*a10 + a11*a11 + a12*a12 - 1) < EPSILON &&
+        fabsf(a20*a20 + a21*a21 + a22*a22 - 1) < EPSILON &&
+        fabsf(a00*a10 + a01*a11 + a02*a12) < EPSILON &&
+        fabsf(a00*a20 + a01*a21 + a02*a22) < EPSILON &&
+        fabsf(a10*a20 + a11*a21 + a12*a22) < EPSILON) {
+        return MAT4_RIGID;
+    }
+    return MAT4_AFFINE;
+}
+
+GLM_API void mat4_translate(mat4 dst, vec3 v) {
     float x = v[0], y = v[1], z = v[2];
     dst[12] = dst[0] * x + dst[4] * y + dst[8] * z + dst[12];
     dst[13] = dst[1] * x + dst[5] * y + dst[9] * z + dst[13];
@@ -225,14 +368,14 @@ void mat4_translate(mat4 dst, vec3 v) {
     dst[15] = dst[3] * x + dst[7] * y + dst[11] * z + dst[15];
 }
 
-void mat4_translatef(mat4 dst, float x, float y, float z) {
+GLM_API void mat4_translatef(mat4 dst, float x, float y, float z) {
     dst[12] = dst[0] * x + dst[4] * y + dst[8] * z + dst[12];
     dst[13] = dst[1] * x + dst[5] * y + dst[9] * z + dst[13];
     dst[14] = dst[2] * x + dst[6] * y + dst[10] * z + dst[14];
     dst[15] = dst[3] * x + dst[7] * y + dst[11] * z + dst[15];
 }
 
-void mat4_scale(mat4 dst, vec3 v) {
+GLM_API void mat4_scale(mat4 dst, vec3 v) {
     float x = v[0], y = v[1], z = v[2];
 
     dst[0] = dst[0] * x;
@@ -253,7 +396,7 @@ void mat4_scale(mat4 dst, vec3 v) {
     dst[15] = dst[15];
 }
 
-void mat4_rotate(mat4 dst, float rad, vec3 axis) {
+GLM_API void mat4_rotate(mat4 dst, float rad, vec3 axis) {
     float x = axis[0], y = axis[1], z = axis[2];
     float len = sqrtf(x * x + y * y + z * z);
     float s, c, t;
@@ -271,8 +414,7 @@ void mat4_rotate(mat4 dst, float rad, vec3 axis) {
     y *= len;
     z *= len;
 
-    s = sinf(rad);
-    c = cosf(rad);
+    glm_rotation_sincos(rad, &s, &c);
     t = 1 - c;
 
     a00 = dst[0]; a01 = dst[1]; a02 = dst[2]; a03 = dst[3];
@@ -299,9 +441,9 @@ void mat4_rotate(mat4 dst, float rad, vec3 axis) {
     dst[11] = a03 * b20 + a13 * b21 + a23 * b22;
 }
 
-void mat4_rotateX(mat4 dst, float rad) {
-    float s = sinf(rad);
-    float c = cosf(rad);
+GLM_API void mat4_rotateX(mat4 dst, float rad) {
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
     float a10 = dst[4];
     float a11 = dst[5];
     float a12 = dst[6];
@@ -322,9 +464,9 @@ void mat4_rotateX(mat4 dst, float rad) {
     dst[11] = a23 * c - a13 * s;
 }
 
-void mat4_rotateY(mat4 dst, float rad) {
-    float s = sinf(rad);
-    float c = cosf(rad);
+GLM_API void mat4_rotateY(mat4 dst, float rad) {
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
     float a00 = dst[0];
     float a01 = dst[1];
     float a02 = dst[2];
@@ -345,9 +487,9 @@ void mat4_rotateY(mat4 dst, float rad) {
     dst[11] = a03 * s + a23 * c;
 }
 
-void mat4_rotateZ(mat4 dst, float rad) {
-    float s = sinf(rad);
-    float c = cosf(rad);
+GLM_API void mat4_rotateZ(mat4 dst, float rad) {
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
     float a00 = dst[0];
     float a01 = dst[1];
     float a02 = dst[2];
@@ -368,7 +510,7 @@ void mat4_rotateZ(mat4 dst, float rad) {
     dst[7] = a13 * c - a03 * s;
 }
 
-void mat4_fromTranslation(mat4 dst, vec3 v) {
+GLM_API void mat4_fromTranslation(mat4 dst, vec3 v) {
     dst[0] = 1;
     dst[1] = 0;
     dst[2] = 0;
@@ -387,7 +529,7 @@ void mat4_fromTranslation(mat4 dst, vec3 v) {
     dst[15] = 1;
 }
 
-void mat4_fromScaling(mat4 dst, vec3 v) {
+GLM_API void mat4_fromScaling(mat4 dst, vec3 v) {
     dst[0] = v[0];
     dst[1] = 0;
     dst[2] = 0;
@@ -406,7 +548,7 @@ void mat4_fromScaling(mat4 dst, vec3 v) {
     dst[15] = 1;
 }
 
-void mat4_fromRotation(mat4 dst, float rad, vec3 axis) {
+GLM_API void mat4_fromRotation(mat4 dst, float rad, vec3 axis) {
     float x = axis[0], y = axis[1], z = axis[2];
     float len = sqrtf(x * x + y * y + z * z);
     float s, c, t;
@@ -418,8 +560,7 @@ void mat4_fromRotation(mat4 dst, float rad, vec3 axis) {
     y *= len;
     z *= len;
 
-    s = sinf(rad);
-    c = cosf(rad);
+    glm_rotation_sincos(rad, &s, &c);
     t = 1 - c;
 
     // Perform rotation-specific matrix multiplication
@@ -441,9 +582,9 @@ void mat4_fromRotation(mat4 dst, float rad, vec3 axis) {
     dst[15] = 1;
 }
 
-void mat4_fromXRotation(mat4 dst, float rad) {
-    float s = sinf(rad);
-    float c = cosf(rad);
+GLM_API void mat4_fromXRotation(mat4 dst, float rad) {
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
 
     // Perform axis-specific matrix multiplication
     dst[0] = 1;
@@ -464,9 +605,9 @@ void mat4_fromXRotation(mat4 dst, float rad) {
     dst[15] = 1;
 }
 
-void mat4_fromYRotation(mat4 dst, float rad) {
-    float s = sinf(rad);
-    float c = cosf(rad);
+GLM_API void mat4_fromYRotation(mat4 dst, float rad) {
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
 
     // Perform axis-specific matrix multiplication
     dst[0] = c;
@@ -487,9 +628,9 @@ void mat4_fromYRotation(mat4 dst, float rad) {
     dst[15] = 1;
 }
 
-void mat4_fromZRotation(mat4 dst, float rad) {
-    float s = sinf(rad);
-    float c = cosf(rad);
+GLM_API void mat4_fromZRotation(mat4 dst, float rad) {
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
 
     // Perform axis-specific matrix multiplication
     dst[0]  = c;
@@ -510,7 +651,7 @@ void mat4_fromZRotation(mat4 dst, float rad) {
     dst[15] = 1;
 }
 
-void mat4_fromRotationTranslation(mat4 dst, quat q, vec3 v) {
+GLM_API void mat4_fromRotationTranslation(mat4 dst, quat q, vec3 v) {
     // Quaternion math
     float x = q[0], y = q[1], z = q[2], w = q[3];
     float x2 = x + x;
@@ -545,13 +686,13 @@ void mat4_fromRotationTranslation(mat4 dst, quat q, vec3 v) {
     dst[15] = 1;
 }
 
-void mat4_getTranslation(vec3 dst, mat4 mat) {
+GLM_API void mat4_getTranslation(vec3 dst, mat4 mat) {
     dst[0] = mat[12];
     dst[1] = mat[13];
     dst[2] = mat[14];
 }
 
-void mat4_getScaling(vec3 dst, mat4 mat) {
+GLM_API void mat4_getScaling(vec3 dst, mat4 mat) {
     float m11 = mat[0];
     float m12 = mat[1];
     float m13 = mat[2];
@@ -567,7 +708,7 @@ void mat4_getScaling(vec3 dst, mat4 mat) {
     dst[2] = sqrtf(m31 * m31 + m32 * m32 + m33 * m33);
 }
 
-void mat4_getRotation(quat dst, mat4 mat) {
+GLM_API void mat4_getRotation(quat dst, mat4 mat) {
     // Algorithm taken from http://www.euclideanspace.com/maths/geometry/rotations/conversions/matrixToQuaternion/index.htm
     float trace = mat[0] + mat[5] + mat[10];
     float S = 0;
@@ -602,7 +743,7 @@ void mat4_getRotation(quat dst, mat4 mat) {
     }
 }
 
-void mat4_fromRotationTranslationScale(mat4 dst, quat q, vec3 v, vec3 s) {
+GLM_API void mat4_fromRotationTranslationScale(mat4 dst, quat q, vec3 v, vec3 s) {
     // Quaternion math
     float x = q[0], y = q[1], z = q[2], w = q[3];
     float x2 = x + x;
@@ -640,7 +781,7 @@ void mat4_fromRotationTranslationScale(mat4 dst, quat q, vec3 v, vec3 s) {
     dst[15] = 1;
 }
 
-void mat4_fromRotationTranslationScaleOrigin(mat4 dst, quat q, vec3 v, vec3 s, vec3 o) {
+GLM_API void mat4_fromRotationTranslationScaleOrigin(mat4 dst, quat q, vec3 v, vec3 s, vec3 o) {
     // Quaternion math
     float x = q[0], y = q[1], z = q[2], w = q[3];
     float x2 = x + x;
@@ -693,7 +834,109 @@ void mat4_fromRotationTranslationScaleOrigin(mat4 dst, quat q, vec3 v, vec3 s, v
     dst[15] = 1;
 }
 
-void mat4_fromQuat(mat4 dst, quat q) {
+GLM_API void mat4_fromEulerTranslationScale(mat4 dst, vec3 euler, vec3 v, vec3 s) {
+    float sx, cx, sy, cy, sz, cz;
+#if defined(GLM_FAST_TRIG) && defined(GLM_SSE4)
+    float sv[4], cv[4];
+    __m128 vs, vc;
+
+    glm_sincos_ps(_mm_mul_ps(_mm_setr_ps(euler[0], euler[1], euler[2], 0), _mm_set1_ps(GLM_HALF_DEG_TO_RAD)), &vs, &vc);
+    _mm_storeu_ps(sv, vs);
+    _mm_storeu_ps(cv, vc);
+    sx = sv[0]; sy = sv[1]; sz = sv[2];
+    cx = cv[0]; cy = cv[1]; cz = cv[2];
+#else
+    glm_rotation_sincos(euler[0] * GLM_HALF_DEG_TO_RAD, &sx, &cx);
+    glm_rotation_sincos(euler[1] * GLM_HALF_DEG_TO_RAD, &sy, &cy);
+    glm_rotation_sincos(euler[2] * GLM_HALF_DEG_TO_RAD, &sz, &cz);
+#endif
+
+    // quat_fromEuler
+    float x = sx * cy * cz - cx * sy * sz;
+    float y = cx * sy * cz + sx * cy * sz;
+    float z = cx * cy * sz - sx * sy * cz;
+    float w = cx * cy * cz + sx * sy * sz;
+
+    // mat4_fromRotationTranslationScale
+    float x2 = x + x;
+    float y2 = y + y;
+    float z2 = z + z;
+
+    float xx = x * x2;
+    float xy = x * y2;
+    float xz = x * z2;
+    float yy = y * y2;
+    float yz = y * z2;
+    float zz = z * z2;
+    float wx = w * x2;
+    float wy = w * y2;
+    float wz = w * z2;
+    float s0 = s[0];
+    float s1 = s[1];
+    float s2 = s[2];
+
+    dst[0] = (1 - (yy + zz)) * s0;
+    dst[1] = (xy + wz) * s0;
+    dst[2] = (xz - wy) * s0;
+    dst[3] = 0;
+    dst[4] = (xy - wz) * s1;
+    dst[5] = (1 - (xx + zz)) * s1;
+    dst[6] = (yz + wx) * s1;
+    dst[7] = 0;
+    dst[8] = (xz + wy) * s2;
+    dst[9] = (yz - wx) * s2;
+    dst[10] = (1 - (xx + yy)) * s2;
+    dst[11] = 0;
+    dst[12] = v[0];
+    dst[13] = v[1];
+    dst[14] = v[2];
+    dst[15] = 1;
+}
+
+static inline void glm_mat4_fromRotationTranslationScale_array(float *dst, size_t stride, quat_v2 *q, vec3 *v, vec3 *s,
+        size_t count, mat4 parent, int rows) {
+    size_t i = 0;
+    int k;
+    mat4 local, m;
+
+#if defined(GLM_SSE4)
+    i = glm_mat4_fromRotationTranslationScale_array_sse4(dst, stride, q[0], v[0], s[0], count, parent, rows);
+#elif defined(GLM_DISPATCH)
+    if (glm_dispatch.mat4_fromRotationTranslationScale_array) {
+        i = glm_dispatch.mat4_fromRotationTranslationScale_array(dst, stride, q[0], v[0], s[0], count, parent, rows);
+    }
+#endif
+
+    for (; i < count; i++) {
+        float *out = (float *)((char *)dst + i * stride);
+
+        if (parent) {
+            mat4_fromRotationTranslationScale(local, q[i], v[i], s[i]);
+            mat4_multiplyTo(m, parent, local);
+        } else {
+            mat4_fromRotationTranslationScale(m, q[i], v[i], s[i]);
+        }
+        if (rows) {
+            for (k = 0; k < 4; k++) {
+                out[k] = m[4 * k];
+                out[4 + k] = m[4 * k + 1];
+                out[8 + k] = m[4 * k + 2];
+            }
+        } else {
+            mat4_copy(out, m);
+        }
+    }
+}
+
+GLM_API void mat4_fromRotationTranslationScale_array(float *dst, size_t stride, quat_v2 *q, vec3 *v, vec3 *s, size_t count, mat4 parent) {
+    glm_mat4_fromRotationTranslationScale_array(dst, stride ? stride : sizeof(mat4), q, v, s, count, parent, 0);
+}
+
+GLM_API void mat4_fromRotationTranslationScale_array3x4(float *dst, size_t stride, quat_v2 *q, vec3 *v, vec3 *s, size_t count, mat4 parent) {
+    glm_mat4_fromRotationTranslationScale_array(dst, stride ? stride : 12 * sizeof(float), q, v, s, count, parent, 1);
+}
+
+GLM_API void mat4_fromQuat(mat4 dst, quat q) {
     float x = q[0], y = q[1], z = q[2], w = q[3];
     float x2 = x + x;
     float y2 = y + y;
@@ -730,7 +973,7 @@ void mat4_fromQuat(mat4 dst, quat q) {
     dst[15] = 1;
 }
 
-void mat4_frustum(mat4 dst, float left, float right, float bottom, float top, float near, float far) {
+GLM_API void mat4_frustum(mat4 dst, float left, float right, float bottom, float top, float near, float far) {
     float rl = 1 / (right - left);
     float tb = 1 / (top - bottom);
     float nf = 1 / (near - far);
@@ -752,7 +995,7 @@ void mat4_frustum(mat4 dst, float left, float right, float bottom, float top, fl
     dst[15] = 0;
 }
 
-void mat4_perspective(mat4 dst, float fovy, float aspect, float near, float far) {
+GLM_API void mat4_perspective(mat4 dst, float fovy, float aspect, float near, float far) {
     float f = 1.0 / tanf(fovy / 2), nf;
     dst[0] = f / aspect;
     dst[1] = 0;
@@ -779,7 +1022,7 @@ void mat4_perspective(mat4 dst, float fovy, float aspect, float near, float far)
     }
 }
 
-void mat4_ortho(mat4 dst, float left, float right, float bottom, float top, float near, float far) {
+GLM_API void mat4_ortho(mat4 dst, float left, float right, float bottom, float top, float near, float far) {
     float lr = 1 / (left - right);
     float bt = 1 / (bottom - top);
     float nf = 1 / (near - far);
@@ -801,7 +1044,7 @@ void mat4_ortho(mat4 dst, float left, float right, float bottom, float top, floa
     dst[15] = 1;
 }
 
-void mat4_lookAt(mat4 dst, vec3 eye, vec3 center, vec3 up) {
+GLM_API void mat4_lookAt(mat4 dst, vec3 eye, vec3 center, vec3 up) {
     float x0, x1, x2, y0, y1, y2, z0, z1, z2, len;
     float eyex = eye[0];
     float eyey = eye[1];
@@ -823,7 +1066,7 @@ void mat4_lookAt(mat4 dst, vec3 eye, vec3 center, vec3 up) {
     z1 = eyey - centery;
     z2 = eyez - centerz;
 
-    len = 1 / sqrtf(z0 * z0 + z1 * z1 + z2 * z2);
+    len = glm_normalize_rsqrt(z0 * z0 + z1 * z1 + z2 * z2);
     z0 *= len;
     z1 *= len;
     z2 *= len;
@@ -831,14 +1074,14 @@ void mat4_lookAt(mat4 dst, vec3 eye, vec3 center, vec3 up) {
     x0 = upy * z2 - upz * z1;
     x1 = upz * z0 - upx * z2;
     x2 = upx * z1 - upy * z0;
-    len = sqrtf(x0 * x0 + x1 * x1 + x2 * x2);
-    if (!len) {
+    len = x0 * x0 + x1 * x1 + x2 * x2;
+    if (len <= GLM_NORMALIZE_MIN) {
         x0 = 0;
         x1 = 0;
         x2 = 0;
     }
     else {
-        len = 1 / len;
+        len = glm_normalize_rsqrt(len);
         x0 *= len;
         x1 *= len;
         x2 *= len;
@@ -848,13 +1091,13 @@ void mat4_lookAt(mat4 dst, vec3 eye, vec3 center, vec3 up) {
     y1 = z2 * x0 - z0 * x2;
     y2 = z0 * x1 - z1 * x0;
 
-    len = sqrtf(y0 * y0 + y1 * y1 + y2 * y2);
-    if (!len) {
+    len = y0 * y0 + y1 * y1 + y2 * y2;
+    if (len <= GLM_NORMALIZE_MIN) {
         y0 = 0;
         y1 = 0;
         y2 = 0;
     } else {
-        len = 1 / len;
+        len = glm_normalize_rsqrt(len);
         y0 *= len;
         y1 *= len;
         y2 *= len;
@@ -878,7 +1121,7 @@ void mat4_lookAt(mat4 dst, vec3 eye, vec3 center, vec3 up) {
     dst[15] = 1;
 }
 
-void mat4_targetTo(mat4 dst, vec3 eye, vec3 target, vec3 up) {
+GLM_API void mat4_targetTo(mat4 dst, vec3 eye, vec3 target, vec3 up) {
     float eyex = eye[0],
         eyey = eye[1],
         eyez = eye[2],
@@ -891,8 +1134,8 @@ void mat4_targetTo(mat4 dst, vec3 eye, vec3 target, vec3 up) {
         z2 = eyez - target[2];
 
     float len = z0*z0 + z1*z1 + z2*z2;
-    if (len > 0) {
-        len = 1 / sqrtf(len);
+    if (len > GLM_NORMALIZE_MIN) {
+        len = glm_normalize_rsqrt(len);
         z0 *= len;
         z1 *= len;
         z2 *= len;
@@ -903,8 +1146,8 @@ void mat4_targetTo(mat4 dst, vec3 eye, vec3 target, vec3 up) {
         x2 = upx * z1 - upy * z0;
 
     len = x0*x0 + x1*x1 + x2*x2;
-    if (len > 0) {
-        len = 1 / sqrtf(len);
+    if (len > GLM_NORMALIZE_MIN) {
+        len = glm_normalize_rsqrt(len);
         x0 *= len;
         x1 *= len;
         x2 *= len;
@@ -928,11 +1171,16 @@ void mat4_targetTo(mat4 dst, vec3 eye, vec3 target, vec3 up) {
     dst[15] = 1;
 };
 
-float mat4_frob(mat4 a) {
+GLM_API float mat4_frob(mat4 a) {
     return (sqrtf(powf(a[0], 2) + powf(a[1], 2) + powf(a[2], 2) + powf(a[3], 2) + powf(a[4], 2) + powf(a[5], 2) + powf(a[6], 2) + powf(a[7], 2) + powf(a[8], 2) + powf(a[9], 2) + powf(a[10], 2) + powf(a[11], 2) + powf(a[12], 2) + powf(a[13], 2) + powf(a[14], 2) + powf(a[15], 2) ));
 }
 
-void mat4_add(mat4 dst, mat4 b) {
+GLM_API void mat4_add(mat4 dst, mat4 b) {
+#if defined(GLM_AVX2)
+    glm_mat4_add_avx2(dst, dst, b);
+#elif defined(GLM_SSE4)
+    glm_mat4_add_sse4(dst, dst, b);
+#else
     dst[0] = dst[0] + b[0];
     dst[1] = dst[1] + b[1];
     dst[2] = dst[2] + b[2];
@@ -949,9 +1197,15 @@ void mat4_add(mat4 dst, mat4 b) {
     dst[13] = dst[13] + b[13];
     dst[14] = dst[14] + b[14];
     dst[15] = dst[15] + b[15];
+#endif
 }
 
-void mat4_subtract(mat4 dst, mat4 b) {
+GLM_API void mat4_subtract(mat4 dst, mat4 b) {
+#if defined(GLM_AVX2)
+    glm_mat4_subtract_avx2(dst, dst, b);
+#elif defined(GLM_SSE4)
+    glm_mat4_subtract_sse4(dst, dst, b);
+#else
     dst[0] = dst[0] - b[0];
     dst[1] = dst[1] - b[1];
     dst[2] = dst[2] - b[2];
@@ -968,9 +1222,15 @@ void mat4_subtract(mat4 dst, mat4 b) {
     dst[13] = dst[13] - b[13];
     dst[14] = dst[14] - b[14];
     dst[15] = dst[15] - b[15];
+#endif
 }
 
-void mat4_multiplyScalar(mat4 dst, float b) {
+GLM_API void mat4_multiplyScalar(mat4 dst, float b) {
+#if defined(GLM_AVX2)
+    glm_mat4_multiplyScalar_avx2(dst, dst, b);
+#elif defined(GLM_SSE4)
+    glm_mat4_multiplyScalar_sse4(dst, dst, b);
+#else
     dst[0] = dst[0] * b;
     dst[1] = dst[1] * b;
     dst[2] = dst[2] * b;
@@ -987,9 +1247,15 @@ void mat4_multiplyScalar(mat4 dst, float b) {
     dst[13] = dst[13] * b;
     dst[14] = dst[14] * b;
     dst[15] = dst[15] * b;
+#endif
 }
 
-void mat4_multiplyScalarAndAdd(mat4 dst, mat4  b, float scale) {
+GLM_API void mat4_multiplyScalarAndAdd(mat4 dst, mat4  b, float scale) {
+#if defined(GLM_AVX2)
+    glm_mat4_multiplyScalarAndAdd_avx2(dst, dst, b, scale);
+#elif defined(GLM_SSE4)
+    glm_mat4_multiplyScalarAndAdd_sse4(dst, dst, b, scale);
+#else
     dst[0] = dst[0] + (b[0] * scale);
     dst[1] = dst[1] + (b[1] * scale);
     dst[2] = dst[2] + (b[2] * scale);
@@ -1006,11 +1272,561 @@ void mat4_multiplyScalarAndAdd(mat4 dst, mat4  b, float scale) {
     dst[13] = dst[13] + (b[13] * scale);
     dst[14] = dst[14] + (b[14] * scale);
     dst[15] = dst[15] + (b[15] * scale);
+#endif
 }
 
-uint8_t mat4_equals(mat4 a, mat4 b) {
+GLM_API uint8_t mat4_equals(mat4 a, mat4 b) {
+#if defined(GLM_SSE4)
+    return glm_mat4_equals_sse4(a, b);
+#else
     return a[0] == b[0] && a[1] == b[1] && a[2] == b[2] && a[3] == b[3] &&
         a[4] == b[4] && a[5] == b[5] && a[6] == b[6] && a[7] == b[7] &&
         a[8] == b[8] && a[9] == b[9] && a[10] == b[10] && a[11] == b[11] &&
         a[12] == b[12] && a[13] == b[13] && a[14] == b[14] && a[15] == b[15];
+#endif
+}
+
+GLM_API void mat4_transposeTo(float *GLM_RESTRICT out, mat4 a) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+#if defined(GLM_SSE4)
+    glm_mat4_transpose_sse4(out, a);
+#else
+    GLM_DISPATCH_RETURN(mat4_transpose, out, a);
+    out[0] = a[0];
+    out[1] = a[4];
+    out[2] = a[8];
+    out[3] = a[12];
+    out[4] = a[1];
+    out[5] = a[5];
+    out[6] = a[9];
+    out[7] = a[13];
+    out[8] = a[2];
+    out[9] = a[6];
+    out[10] = a[10];
+    out[11] = a[14];
+    out[12] = a[3];
+    out[13] = a[7];
+    out[14] = a[11];
+    out[15] = a[15];
+#endif
+}
+
+GLM_API void mat4_invertTo(float *GLM_RESTRICT out, mat4 a) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+#if defined(GLM_SSE4)
+    if (!glm_mat4_invert_sse4(out, a)) {
+        mat4_copy(out, a);
+    }
+#else
+#if defined(GLM_DISPATCH)
+    if (glm_dispatch.mat4_invert) {
+        if (!glm_dispatch.mat4_invert(out, a)) {
+            mat4_copy(out, a);
+        }
+        return;
+    }
+#endif
+    float a00 = a[0], a01 = a[1], a02 = a[2], a03 = a[3];
+    float a10 = a[4], a11 = a[5], a12 = a[6], a13 = a[7];
+    float a20 = a[8], a21 = a[9], a22 = a[10], a23 = a[11];
+    float a30 = a[12], a31 = a[13], a32 = a[14], a33 = a[15];
+
+    float b00 = (a00 * a11) - (a01 * a10);
+    float b01 = (a00 * a12) - (a02 * a10);
+    float b02 = (a00 * a13) - (a03 * a10);
+    float b03 = (a01 * a12) - (a02 * a11);
+    float b04 = (a01 * a13) - (a03 * a11);
+    float b05 = (a02 * a13) - (a03 * a12);
+    float b06 = (a20 * a31) - (a21 * a30);
+    float b07 = (a20 * a32) - (a22 * a30);
+    float b08 = (a20 * a33) - (a23 * a30);
+    float b09 = (a21 * a32) - (a22 * a31);
+    float b10 = (a21 * a33) - (a23 * a31);
+    float b11 = (a22 * a33) - (a23 * a32);
+
+    float det = (b00 * b11) - (b01 * b10) + (b02 * b09) + (b03 * b08) - (b04 * b07) + (b05 * b06);
+
+    if (!det) {
+        mat4_copy(out, a);
+        return;
+    }
+    det = 1.0 / det;
+
+    out[0] = (a11 * b11 - a12 * b10 + a13 * b09) * det;
+    out[1] = (a02 * b10 - a01 * b11 - a03 * b09) * det;
+    out[2] = (a31 * b05 - a32 * b04 + a33 * b03) * det;
+    out[3] = (a22 * b04 - a21 * b05 - a23 * b03) * det;
+    out[4] = (a12 * b08 - a10 * b11 - a13 * b07) * det;
+    out[5] = (a00 * b11 - a02 * b08 + a03 * b07) * det;
+    out[6] = (a32 * b02 - a30 * b05 - a33 * b01) * det;
+    out[7] = (a20 * b05 - a22 * b02 + a23 * b01) * det;
+    out[8] = (a10 * b10 - a11 * b08 + a13 * b06) * det;
+    out[9] = (a01 * b08 - a00 * b10 - a03 * b06) * det;
+    out[10] = (a30 * b04 - a31 * b02 + a33 * b00) * det;
+    out[11] = (a21 * b02 - a20 * b04 - a23 * b00) * det;
+    out[12] = (a11 * b07 - a10 * b09 - a12 * b06) * det;
+    out[13] = (a00 * b09 - a01 * b07 + a02 * b06) * det;
+    out[14] = (a31 * b01 - a30 * b03 - a32 * b00) * det;
+    out[15] = (a20 * b03 - a21 * b01 + a22 * b00) * det;
+#endif
+}
+
+GLM_API void mat4_invertAffineTo(float *GLM_RESTRICT out, mat4 a) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    float a00 = a[0], a01 = a[1], a02 = a[2];
+    float a10 = a[4], a11 = a[5], a12 = a[6];
+    float a20 = a[8], a21 = a[9], a22 = a[10];
+    float tx = a[12], ty = a[13], tz = a[14];
+
+    float b01 = a22 * a11 - a12 * a21;
+    float b11 = -a22 * a10 + a12 * a20;
+    float b21 = a21 * a10 - a11 * a20;
+
+    // Determinant of the upper 3x3, the projective row does not contribute
+    float det = a00 * b01 + a01 * b11 + a02 * b21;
+
+    if (!det) {
+        mat4_copy(out, a);
+        return;
+    }
+    det = 1.0 / det;
+
+    out[0] = b01 * det;
+    out[1] = (-a22 * a01 + a02 * a21) * det;
+    out[2] = (a12 * a01 - a02 * a11) * det;
+    out[3] = 0;
+    out[4] = b11 * det;
+    out[5] = (a22 * a00 - a02 * a20) * det;
+    out[6] = (-a12 * a00 + a02 * a10) * det;
+    out[7] = 0;
+    out[8] = b21 * det;
+    out[9] = (-a21 * a00 + a01 * a20) * det;
+    out[10] = (a11 * a00 - a01 * a10) * det;
+    out[11] = 0;
+
+    // Translation of the inverse is -inverse(upper 3x3) * t
+    out[12] = -(out[0] * tx + out[4] * ty + out[8] * tz);
+    out[13] = -(out[1] * tx + out[5] * ty + out[9] * tz);
+    out[14] = -(out[2] * tx + out[6] * ty + out[10] * tz);
+    out[15] = 1;
+}
+
+GLM_API void mat4_invertRigidTo(float *GLM_RESTRICT out, mat4 a) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    float tx = a[12], ty = a[13], tz = a[14];
+
+    out[0] = a[0];
+    out[1] = a[4];
+    out[2] = a[8];
+    out[3] = 0;
+    out[4] = a[1];
+    out[5] = a[5];
+    out[6] = a[9];
+    out[7] = 0;
+    out[8] = a[2];
+    out[9] = a[6];
+    out[10] = a[10];
+    out[11] = 0;
+
+    out[12] = -(out[0] * tx + out[4] * ty + out[8] * tz);
+    out[13] = -(out[1] * tx + out[5] * ty + out[9] * tz);
+    out[14] = -(out[2] * tx + out[6] * ty + out[10] * tz);
+    out[15] = 1;
+}
+
+GLM_API void mat4_adjointTo(float *GLM_RESTRICT out, mat4 a) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    float a00 = a[0], a01 = a[1], a02 = a[2], a03 = a[3];
+    float a10 = a[4], a11 = a[5], a12 = a[6], a13 = a[7];
+    float a20 = a[8], a21 = a[9], a22 = a[10], a23 = a[11];
+    float a30 = a[12], a31 = a[13], a32 = a[14], a33 = a[15];
+
+    out[0]  =  (a11 * (a22 * a33 - a23 * a32) - a21 * (a12 * a33 - a13 * a32) + a31 * (a12 * a23 - a13 * a22));
+    out[1]  = -(a01 * (a22 * a33 - a23 * a32) - a21 * (a02 * a33 - a03 * a32) + a31 * (a02 * a23 - a03 * a22));
+    out[2]  =  (a01 * (a12 * a33 - a13 * a32) - a11 * (a02 * a33 - a03 * a32) + a31 * (a02 * a13 - a03 * a12));
+    out[3]  = -(a01 * (a12 * a23 - a13 * a22) - a11 * (a02 * a23 - a03 * a22) + a21 * (a02 * a13 - a03 * a12));
+    out[4]  = -(a10 * (a22 * a33 - a23 * a32) - a20 * (a12 * a33 - a13 * a32) + a30 * (a12 * a23 - a13 * a22));
+    out[5]  =  (a00 * (a22 * a33 - a23 * a32) - a20 * (a02 * a33 - a03 * a32) + a30 * (a02 * a23 - a03 * a22));
+    out[6]  = -(a00 * (a12 * a33 - a13 * a32) - a10 * (a02 * a33 - a03 * a32) + a30 * (a02 * a13 - a03 * a12));
+    out[7]  =  (a00 * (a12 * a23 - a13 * a22) - a10 * (a02 * a23 - a03 * a22) + a20 * (a02 * a13 - a03 * a12));
+    out[8]  =  (a10 * (a21 * a33 - a23 * a31) - a20 * (a11 * a33 - a13 * a31) + a30 * (a11 * a23 - a13 * a21));
+    out[9]  = -(a00 * (a21 * a33 - a23 * a31) - a20 * (a01 * a33 - a03 * a31) + a30 * (a01 * a23 - a03 * a21));
+    out[10] =  (a00 * (a11 * a33 - a13 * a31) - a10 * (a01 * a33 - a03 * a31) + a30 * (a01 * a13 - a03 * a11));
+    out[11] = -(a00 * (a11 * a23 - a13 * a21) - a10 * (a01 * a23 - a03 * a21) + a20 * (a01 * a13 - a03 * a11));
+    out[12] = -(a10 * (a21 * a32 - a22 * a31) - a20 * (a11 * a32 - a12 * a31) + a30 * (a11 * a22 - a12 * a21));
+    out[13] =  (a00 * (a21 * a32 - a22 * a31) - a20 * (a01 * a32 - a02 * a31) + a30 * (a01 * a22 - a02 * a21));
+    out[14] = -(a00 * (a11 * a32 - a12 * a31) - a10 * (a01 * a32 - a02 * a31) + a30 * (a01 * a12 - a02 * a11));
+    out[15] =  (a00 * (a11 * a22 - a12 * a21) - a10 * (a01 * a22 - a02 * a21) + a20 * (a01 * a12 - a02 * a11));
+}
+
+GLM_API void mat4_multiplyTo(float *GLM_RESTRICT out, mat4 a, mat4 b) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    GLM_ASSERT_NOALIAS(out, 16, b, 16);
+#if defined(GLM_AVX2)
+    glm_mat4_multiply_avx2(out, a, b);
+#elif defined(GLM_SSE4)
+    glm_mat4_multiply_sse4(out, a, b);
+#else
+    GLM_DISPATCH_RETURN(mat4_multiply, out, a, b);
+    float a00 = a[0], a01 = a[1], a02 = a[2], a03 = a[3];
+    float a10 = a[4], a11 = a[5], a12 = a[6], a13 = a[7];
+    float a20 = a[8], a21 = a[9], a22 = a[10], a23 = a[11];
+    float a30 = a[12], a31 = a[13], a32 = a[14], a33 = a[15];
+
+    // Cache only the current line of the second matrix
+    float b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3];
+    out[0] = b0*a00 + b1*a10 + b2*a20 + b3*a30;
+    out[1] = b0*a01 + b1*a11 + b2*a21 + b3*a31;
+    out[2] = b0*a02 + b1*a12 + b2*a22 + b3*a32;
+    out[3] = b0*a03 + b1*a13 + b2*a23 + b3*a33;
+
+    b0 = b[4]; b1 = b[5]; b2 = b[6]; b3 = b[7];
+    out[4] = b0*a00 + b1*a10 + b2*a20 + b3*a30;
+    out[5] = b0*a01 + b1*a11 + b2*a21 + b3*a31;
+    out[6] = b0*a02 + b1*a12 + b2*a22 + b3*a32;
+    out[7] = b0*a03 + b1*a13 + b2*a23 + b3*a33;
+
+    b0 = b[8]; b1 = b[9]; b2 = b[10]; b3 = b[11];
+    out[8] = b0*a00 + b1*a10 + b2*a20 + b3*a30;
+    out[9] = b0*a01 + b1*a11 + b2*a21 + b3*a31;
+    out[10] = b0*a02 + b1*a12 + b2*a22 + b3*a32;
+    out[11] = b0*a03 + b1*a13 + b2*a23 + b3*a33;
+
+    b0 = b[12]; b1 = b[13]; b2 = b[14]; b3 = b[15];
+    out[12] = b0*a00 + b1*a10 + b2*a20 + b3*a30;
+    out[13] = b0*a01 + b1*a11 + b2*a21 + b3*a31;
+    out[14] = b0*a02 + b1*a12 + b2*a22 + b3*a32;
+    out[15] = b0*a03 + b1*a13 + b2*a23 + b3*a33;
+#endif
+}
+
+GLM_API void mat4_multiplyAffineTo(float *GLM_RESTRICT out, mat4 a, mat4 b) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    GLM_ASSERT_NOALIAS(out, 16, b, 16);
+#if defined(GLM_AVX2)
+    glm_mat4_multiplyAffine_avx2(out, a, b);
+#elif defined(GLM_SSE4)
+    glm_mat4_multiplyAffine_sse4(out, a, b);
+#else
+    GLM_DISPATCH_RETURN(mat4_multiplyAffine, out, a, b);
+    float a00 = a[0], a01 = a[1], a02 = a[2];
+    float a10 = a[4], a11 = a[5], a12 = a[6];
+    float a20 = a[8], a21 = a[9], a22 = a[10];
+    float a30 = a[12], a31 = a[13], a32 = a[14];
+
+    float b0 = b[0], b1 = b[1], b2 = b[2];
+    out[0] = b0*a00 + b1*a10 + b2*a20;
+    out[1] = b0*a01 + b1*a11 + b2*a21;
+    out[2] = b0*a02 + b1*a12 + b2*a22;
+    out[3] = 0;
+
+    b0 = b[4]; b1 = b[5]; b2 = b[6];
+    out[4] = b0*a00 + b1*a10 + b2*a20;
+    out[5] = b0*a01 + b1*a11 + b2*a21;
+    out[6] = b0*a02 + b1*a12 + b2*a22;
+    out[7] = 0;
+
+    b0 = b[8]; b1 = b[9]; b2 = b[10];
+    out[8] = b0*a00 + b1*a10 + b2*a20;
+    out[9] = b0*a01 + b1*a11 + b2*a21;
+    out[10] = b0*a02 + b1*a12 + b2*a22;
+    out[11] = 0;
+
+    b0 = b[12]; b1 = b[13]; b2 = b[14];
+    out[12] = b0*a00 + b1*a10 + b2*a20 + a30;
+    out[13] = b0*a01 + b1*a11 + b2*a21 + a31;
+    out[14] = b0*a02 + b1*a12 + b2*a22 + a32;
+    out[15] = 1;
+#endif
+}
+
+GLM_API void mat4_translateTo(float *GLM_RESTRICT out, mat4 a, vec3 v) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    GLM_ASSERT_NOALIAS(out, 16, v, 3);
+    float x = v[0], y = v[1], z = v[2];
+    out[0] = a[0]; out[1] = a[1]; out[2] = a[2]; out[3] = a[3];
+    out[4] = a[4]; out[5] = a[5]; out[6] = a[6]; out[7] = a[7];
+    out[8] = a[8]; out[9] = a[9]; out[10] = a[10]; out[11] = a[11];
+    out[12] = a[0] * x + a[4] * y + a[8] * z + a[12];
+    out[13] = a[1] * x + a[5] * y + a[9] * z + a[13];
+    out[14] = a[2] * x + a[6] * y + a[10] * z + a[14];
+    out[15] = a[3] * x + a[7] * y + a[11] * z + a[15];
+}
+
+GLM_API void mat4_translatefTo(float *GLM_RESTRICT out, mat4 a, float x, float y, float z) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    out[0] = a[0]; out[1] = a[1]; out[2] = a[2]; out[3] = a[3];
+    out[4] = a[4]; out[5] = a[5]; out[6] = a[6]; out[7] = a[7];
+    out[8] = a[8]; out[9] = a[9]; out[10] = a[10]; out[11] = a[11];
+    out[12] = a[0] * x + a[4] * y + a[8] * z + a[12];
+    out[13] = a[1] * x + a[5] * y + a[9] * z + a[13];
+    out[14] = a[2] * x + a[6] * y + a[10] * z + a[14];
+    out[15] = a[3] * x + a[7] * y + a[11] * z + a[15];
+}
+
+GLM_API void mat4_scaleTo(float *GLM_RESTRICT out, mat4 a, vec3 v) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    GLM_ASSERT_NOALIAS(out, 16, v, 3);
+    float x = v[0], y = v[1], z = v[2];
+
+    out[0] = a[0] * x;
+    out[1] = a[1] * x;
+    out[2] = a[2] * x;
+    out[3] = a[3] * x;
+    out[4] = a[4] * y;
+    out[5] = a[5] * y;
+    out[6] = a[6] * y;
+    out[7] = a[7] * y;
+    out[8] = a[8] * z;
+    out[9] = a[9] * z;
+    out[10] = a[10] * z;
+    out[11] = a[11] * z;
+    out[12] = a[12];
+    out[13] = a[13];
+    out[14] = a[14];
+    out[15] = a[15];
+}
+
+GLM_API void mat4_rotateTo(float *GLM_RESTRICT out, mat4 a, float rad, vec3 axis) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    GLM_ASSERT_NOALIAS(out, 16, axis, 3);
+    float x = axis[0], y = axis[1], z = axis[2];
+    float len = sqrtf(x * x + y * y + z * z);
+    float s, c, t;
+    float a00, a01, a02, a03;
+    float a10, a11, a12, a13;
+    float a20, a21, a22, a23;
+    float b00, b01, b02;
+    float b10, b11, b12;
+    float b20, b21, b22;
+
+    if (len < EPSILON) {
+        mat4_copy(out, a);
+        return;
+    }
+
+    len = 1 / len;
+    x *= len;
+    y *= len;
+    z *= len;
+
+    glm_rotation_sincos(rad, &s, &c);
+    t = 1 - c;
+
+    a00 = a[0]; a01 = a[1]; a02 = a[2]; a03 = a[3];
+    a10 = a[4]; a11 = a[5]; a12 = a[6]; a13 = a[7];
+    a20 = a[8]; a21 = a[9]; a22 = a[10]; a23 = a[11];
+
+    // Construct the elements of the rotation matrix
+    b00 = x * x * t + c; b01 = y * x * t + z * s; b02 = z * x * t - y * s;
+    b10 = x * y * t - z * s; b11 = y * y * t + c; b12 = z * y * t + x * s;
+    b20 = x * z * t + y * s; b21 = y * z * t - x * s; b22 = z * z * t + c;
+
+    // Untouched columns are copied
+    out[12] = a[12]; out[13] = a[13]; out[14] = a[14]; out[15] = a[15];
+
+    // Perform rotation-specific matrix multiplication
+    out[0] = a00 * b00 + a10 * b01 + a20 * b02;
+    out[1] = a01 * b00 + a11 * b01 + a21 * b02;
+    out[2] = a02 * b00 + a12 * b01 + a22 * b02;
+    out[3] = a03 * b00 + a13 * b01 + a23 * b02;
+    out[4] = a00 * b10 + a10 * b11 + a20 * b12;
+    out[5] = a01 * b10 + a11 * b11 + a21 * b12;
+    out[6] = a02 * b10 + a12 * b11 + a22 * b12;
+    out[7] = a03 * b10 + a13 * b11 + a23 * b12;
+    out[8] = a00 * b20 + a10 * b21 + a20 * b22;
+    out[9] = a01 * b20 + a11 * b21 + a21 * b22;
+    out[10] = a02 * b20 + a12 * b21 + a22 * b22;
+    out[11] = a03 * b20 + a13 * b21 + a23 * b22;
+}
+
+GLM_API void mat4_rotateXTo(float *GLM_RESTRICT out, mat4 a, float rad) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
+    float a10 = a[4];
+    float a11 = a[5];
+    float a12 = a[6];
+    float a13 = a[7];
+    float a20 = a[8];
+    float a21 = a[9];
+    float a22 = a[10];
+    float a23 = a[11];
+
+    // Untouched columns are copied
+    out[0] = a[0]; out[1] = a[1]; out[2] = a[2]; out[3] = a[3];
+    out[12] = a[12]; out[13] = a[13]; out[14] = a[14]; out[15] = a[15];
+
+    // Perform axis-specific matrix multiplication
+    out[4] = a10 * c + a20 * s;
+    out[5] = a11 * c + a21 * s;
+    out[6] = a12 * c + a22 * s;
+    out[7] = a13 * c + a23 * s;
+    out[8] = a20 * c - a10 * s;
+    out[9] = a21 * c - a11 * s;
+    out[10] = a22 * c - a12 * s;
+    out[11] = a23 * c - a13 * s;
+}
+
+GLM_API void mat4_rotateYTo(float *GLM_RESTRICT out, mat4 a, float rad) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
+    float a00 = a[0];
+    float a01 = a[1];
+    float a02 = a[2];
+    float a03 = a[3];
+    float a20 = a[8];
+    float a21 = a[9];
+    float a22 = a[10];
+    float a23 = a[11];
+
+    // Untouched columns are copied
+    out[4] = a[4]; out[5] = a[5]; out[6] = a[6]; out[7] = a[7];
+    out[12] = a[12]; out[13] = a[13]; out[14] = a[14]; out[15] = a[15];
+
+    // Perform axis-specific matrix multiplication
+    out[0] = a00 * c - a20 * s;
+    out[1] = a01 * c - a21 * s;
+    out[2] = a02 * c - a22 * s;
+    out[3] = a03 * c - a23 * s;
+    out[8] = a00 * s + a20 * c;
+    out[9] = a01 * s + a21 * c;
+    out[10] = a02 * s + a22 * c;
+    out[11] = a03 * s + a23 * c;
+}
+
+GLM_API void mat4_rotateZTo(float *GLM_RESTRICT out, mat4 a, float rad) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
+    float a00 = a[0];
+    float a01 = a[1];
+    float a02 = a[2];
+    float a03 = a[3];
+    float a10 = a[4];
+    float a11 = a[5];
+    float a12 = a[6];
+    float a13 = a[7];
+
+    // Untouched columns are copied
+    out[8] = a[8]; out[9] = a[9]; out[10] = a[10]; out[11] = a[11];
+    out[12] = a[12]; out[13] = a[13]; out[14] = a[14]; out[15] = a[15];
+
+    // Perform axis-specific matrix multiplication
+    out[0] = a00 * c + a10 * s;
+    out[1] = a01 * c + a11 * s;
+    out[2] = a02 * c + a12 * s;
+    out[3] = a03 * c + a13 * s;
+    out[4] = a10 * c - a00 * s;
+    out[5] = a11 * c - a01 * s;
+    out[6] = a12 * c - a02 * s;
+    out[7] = a13 * c - a03 * s;
+}
+
+GLM_API void mat4_addTo(float *GLM_RESTRICT out, mat4 a, mat4 b) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    GLM_ASSERT_NOALIAS(out, 16, b, 16);
+#if defined(GLM_AVX2)
+    glm_mat4_add_avx2(out, a, b);
+#elif defined(GLM_SSE4)
+    glm_mat4_add_sse4(out, a, b);
+#else
+    out[0] = a[0] + b[0];
+    out[1] = a[1] + b[1];
+    out[2] = a[2] + b[2];
+    out[3] = a[3] + b[3];
+    out[4] = a[4] + b[4];
+    out[5] = a[5] + b[5];
+    out[6] = a[6] + b[6];
+    out[7] = a[7] + b[7];
+    out[8] = a[8] + b[8];
+    out[9] = a[9] + b[9];
+    out[10] = a[10] + b[10];
+    out[11] = a[11] + b[11];
+    out[12] = a[12] + b[12];
+    out[13] = a[13] + b[13];
+    out[14] = a[14] + b[14];
+    out[15] = a[15] + b[15];
+#endif
+}
+
+GLM_API void mat4_subtractTo(float *GLM_RESTRICT out, mat4 a, mat4 b) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    GLM_ASSERT_NOALIAS(out, 16, b, 16);
+#if defined(GLM_AVX2)
+    glm_mat4_subtract_avx2(out, a, b);
+#elif defined(GLM_SSE4)
+    glm_mat4_subtract_sse4(out, a, b);
+#else
+    out[0] = a[0] - b[0];
+    out[1] = a[1] - b[1];
+    out[2] = a[2] - b[2];
+    out[3] = a[3] - b[3];
+    out[4] = a[4] - b[4];
+    out[5] = a[5] - b[5];
+    out[6] = a[6] - b[6];
+    out[7] = a[7] - b[7];
+    out[8] = a[8] - b[8];
+    out[9] = a[9] - b[9];
+    out[10] = a[10] - b[10];
+    out[11] = a[11] - b[11];
+    out[12] = a[12] - b[12];
+    out[13] = a[13] - b[13];
+    out[14] = a[14] - b[14];
+    out[15] = a[15] - b[15];
+#endif
+}
+
+GLM_API void mat4_multiplyScalarTo(float *GLM_RESTRICT out, mat4 a, float b) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+#if defined(GLM_AVX2)
+    glm_mat4_multiplyScalar_avx2(out, a, b);
+#elif defined(GLM_SSE4)
+    glm_mat4_multiplyScalar_sse4(out, a, b);
+#else
+    out[0] = a[0] * b;
+    out[1] = a[1] * b;
+    out[2] = a[2] * b;
+    out[3] = a[3] * b;
+    out[4] = a[4] * b;
+    out[5] = a[5] * b;
+    out[6] = a[6] * b;
+    out[7] = a[7] * b;
+    out[8] = a[8] * b;
+    out[9] = a[9] * b;
+    out[10] = a[10] * b;
+    out[11] = a[11] * b;
+    out[12] = a[12] * b;
+    out[13] = a[13] * b;
+    out[14] = a[14] * b;
+    out[15] = a[15] * b;
+#endif
+}
+
+GLM_API void mat4_multiplyScalarAndAddTo(float *GLM_RESTRICT out, mat4 a, mat4 b, float scale) {
+    GLM_ASSERT_NOALIAS(out, 16, a, 16);
+    GLM_ASSERT_NOALIAS(out, 16, b, 16);
+#if defined(GLM_AVX2)
+    glm_mat4_multiplyScalarAndAdd_avx2(out, a, b, scale);
+#elif defined(GLM_SSE4)
+    glm_mat4_multiplyScalarAndAdd_sse4(out, a, b, scale);
+#else
+    out[0] = a[0] + (b[0] * scale);
+    out[1] = a[1] + (b[1] * scale);
+    out[2] = a[2] + (b[2] * scale);
+    out[3] = a[3] + (b[3] * scale);
+    out[4] = a[4] + (b[4] * scale);
+    out[5] = a[5] + (b[5] * scale);
+    out[6] = a[6] + (b[6] * scale);
+    out[7] = a[7] + (b[7] * scale);
+    out[8] = a[8] + (b[8] * scale);
+    out[9] = a[9] + (b[9] * scale);
+    out[10] = a[10] + (b[10] * scale);
+    out[11] = a[11] + (b[11] * scale);
+    out[12] = a[12] + (b[12] * scale);
+    out[13] = a[13] + (b[13] * scale);
+    out[14] = a[14] + (b[14] * scale);
+    out[15] = a[15] + (b[15] * scale);
+#endif
 }
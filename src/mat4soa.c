@@ -0,0 +1,338 @@
+#include "mat4soa.h"
+#include "simd.h"
+#include <string.h>
+
+/**
+ * Returns the count rounded up to a multiple of MAT4SOA_PADDING
+ *
+ * @param {Number} count number of matrices
+ * @returns {Number} padded number of matrices
+ */
+GLM_API size_t mat4soa_paddedCount(size_t count) {
+    return (count + MAT4SOA_PADDING - 1) & ~(size_t)(MAT4SOA_PADDING - 1);
+}
+
+/**
+ * Returns the number of floats a buffer needs to hold count matrices
+ *
+ * @param {Number} count number of matrices
+ * @returns {Number} buffer size in floats
+ */
+GLM_API size_t mat4soa_bufferSize(size_t count) {
+    return 16 * mat4soa_paddedCount(count);
+}
+
+/**
+ * Sets up a mat4soa on top of a caller provided buffer and zeroes it.
+ * The buffer must be aligned to MAT4SOA_ALIGNMENT bytes and hold at
+ * least mat4soa_bufferSize(count) floats.
+ *
+ * @param {mat4soa} dst the batch to set up
+ * @param {float[]} buffer storage for the elements
+ * @param {Number} count number of matrices
+ */
+GLM_API void mat4soa_init(mat4soa *dst, float *buffer, size_t count) {
+    size_t n = mat4soa_paddedCount(count);
+    int e;
+    for (e = 0; e < 16; e++) {
+        dst->m[e] = buffer + e * n;
+    }
+    dst->count = count;
+    memset(buffer, 0, 16 * n * sizeof(float));
+}
+
+/**
+ * Copies an array of mat4's into a mat4soa
+ *
+ * @param {mat4soa} dst the receiving batch, dst->count matrices are read
+ * @param {mat4[]} src the source matrices
+ */
+GLM_API void mat4soa_fromMat4Array(mat4soa *dst, mat4 *src) {
+    size_t i = 0, count = dst->count;
+    int e;
+
+#if defined(GLM_SSE4)
+    // Each column of 4 matrices is one 4x4 transpose away from 4 element rows
+    for (; i < (count & ~(size_t)3); i += 4) {
+        for (e = 0; e < 16; e += 4) {
+            __m128 r0 = _mm_loadu_ps(src[i] + e);
+            __m128 r1 = _mm_loadu_ps(src[i + 1] + e);
+            __m128 r2 = _mm_loadu_ps(src[i + 2] + e);
+            __m128 r3 = _mm_loadu_ps(src[i + 3] + e);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_store_ps(dst->m[e] + i, r0);
+            _mm_store_ps(dst->m[e + 1] + i, r1);
+            _mm_store_ps(dst->m[e + 2] + i, r2);
+            _mm_store_ps(dst->m[e + 3] + i, r3);
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        for (e = 0; e < 16; e++) {
+            dst->m[e][i] = src[i][e];
+        }
+    }
+}
+
+/**
+ * Copies a mat4soa into an array of mat4's
+ *
+ * @param {mat4[]} dst the receiving array, must hold src->count matrices
+ * @param {mat4soa} src the source batch
+ */
+GLM_API void mat4soa_toMat4Array(mat4 *dst, mat4soa *src) {
+    size_t i = 0, count = src->count;
+    int e;
+
+#if defined(GLM_SSE4)
+    for (; i < (count & ~(size_t)3); i += 4) {
+        for (e = 0; e < 16; e += 4) {
+            __m128 r0 = _mm_load_ps(src->m[e] + i);
+            __m128 r1 = _mm_load_ps(src->m[e + 1] + i);
+            __m128 r2 = _mm_load_ps(src->m[e + 2] + i);
+            __m128 r3 = _mm_load_ps(src->m[e + 3] + i);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(dst[i] + e, r0);
+            _mm_storeu_ps(dst[i + 1] + e, r1);
+            _mm_storeu_ps(dst[i + 2] + e, r2);
+            _mm_storeu_ps(dst[i + 3] + e, r3);
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        for (e = 0; e < 16; e++) {
+            dst[i][e] = src->m[e][i];
+        }
+    }
+}
+
+/**
+ * Multiplies every matrix of dst by the matching matrix of b,
+ * like mat4_multiply
+ *
+ * @param {mat4soa} dst the receiving batch
+ * @param {mat4soa} b the second operands
+ */
+GLM_API void mat4soa_multiply(mat4soa *dst, mat4soa *b) {
+    size_t i;
+#if defined(GLM_VF_WIDTH)
+    size_t n = mat4soa_paddedCount(dst->count);
+    int c, r;
+    for (i = 0; i < n; i += GLM_VF_WIDTH) {
+        glm_vf a[16], out[16];
+        for (c = 0; c < 16; c++) {
+            a[c] = glm_vf_load(dst->m[c] + i);
+        }
+        for (c = 0; c < 16; c += 4) {
+            glm_vf b0 = glm_vf_load(b->m[c] + i), b1 = glm_vf_load(b->m[c + 1] + i);
+            glm_vf b2 = glm_vf_load(b->m[c + 2] + i), b3 = glm_vf_load(b->m[c + 3] + i);
+            for (r = 0; r < 4; r++) {
+                glm_vf v = glm_vf_mul(b0, a[r]);
+                v = glm_vf_madd(b1, a[4 + r], v);
+                v = glm_vf_madd(b2, a[8 + r], v);
+                out[c + r] = glm_vf_madd(b3, a[12 + r], v);
+            }
+        }
+        for (c = 0; c < 16; c++) {
+            glm_vf_store(dst->m[c] + i, out[c]);
+        }
+    }
+#else
+    for (i = 0; i < dst->count; i++) {
+        float a00 = dst->m[0][i], a01 = dst->m[1][i], a02 = dst->m[2][i], a03 = dst->m[3][i];
+        float a10 = dst->m[4][i], a11 = dst->m[5][i], a12 = dst->m[6][i], a13 = dst->m[7][i];
+        float a20 = dst->m[8][i], a21 = dst->m[9][i], a22 = dst->m[10][i], a23 = dst->m[11][i];
+        float a30 = dst->m[12][i], a31 = dst->m[13][i], a32 = dst->m[14][i], a33 = dst->m[15][i];
+        int c;
+
+        for (c = 0; c < 16; c += 4) {
+            float b0 = b->m[c][i], b1 = b->m[c + 1][i], b2 = b->m[c + 2][i], b3 = b->m[c + 3][i];
+            dst->m[c][i] = b0*a00 + b1*a10 + b2*a20 + b3*a30;
+            dst->m[c + 1][i] = b0*a01 + b1*a11 + b2*a21 + b3*a31;
+            dst->m[c + 2][i] = b0*a02 + b1*a12 + b2*a22 + b3*a32;
+            dst->m[c + 3][i] = b0*a03 + b1*a13 + b2*a23 + b3*a33;
+        }
+    }
+#endif
+}
+
+/**
+ * Inverts every matrix of a batch, like mat4_invert.
+ * Singular matrices are left unchanged.
+ *
+ * @param {mat4soa} dst the receiving batch
+ */
+GLM_API void mat4soa_invert(mat4soa *dst) {
+    size_t i;
+#if defined(GLM_VF_WIDTH)
+    size_t n = mat4soa_paddedCount(dst->count);
+    glm_vf one = glm_vf_set1(1), zero = glm_vf_zero();
+    for (i = 0; i < n; i += GLM_VF_WIDTH) {
+        glm_vf a00 = glm_vf_load(dst->m[0] + i), a01 = glm_vf_load(dst->m[1] + i);
+        glm_vf a02 = glm_vf_load(dst->m[2] + i), a03 = glm_vf_load(dst->m[3] + i);
+        glm_vf a10 = glm_vf_load(dst->m[4] + i), a11 = glm_vf_load(dst->m[5] + i);
+        glm_vf a12 = glm_vf_load(dst->m[6] + i), a13 = glm_vf_load(dst->m[7] + i);
+        glm_vf a20 = glm_vf_load(dst->m[8] + i), a21 = glm_vf_load(dst->m[9] + i);
+        glm_vf a22 = glm_vf_load(dst->m[10] + i), a23 = glm_vf_load(dst->m[11] + i);
+        glm_vf a30 = glm_vf_load(dst->m[12] + i), a31 = glm_vf_load(dst->m[13] + i);
+        glm_vf a32 = glm_vf_load(dst->m[14] + i), a33 = glm_vf_load(dst->m[15] + i);
+
+        glm_vf b00 = glm_vf_sub(glm_vf_mul(a00, a11), glm_vf_mul(a01, a10));
+        glm_vf b01 = glm_vf_sub(glm_vf_mul(a00, a12), glm_vf_mul(a02, a10));
+        glm_vf b02 = glm_vf_sub(glm_vf_mul(a00, a13), glm_vf_mul(a03, a10));
+        glm_vf b03 = glm_vf_sub(glm_vf_mul(a01, a12), glm_vf_mul(a02, a11));
+        glm_vf b04 = glm_vf_sub(glm_vf_mul(a01, a13), glm_vf_mul(a03, a11));
+        glm_vf b05 = glm_vf_sub(glm_vf_mul(a02, a13), glm_vf_mul(a03, a12));
+        glm_vf b06 = glm_vf_sub(glm_vf_mul(a20, a31), glm_vf_mul(a21, a30));
+        glm_vf b07 = glm_vf_sub(glm_vf_mul(a20, a32), glm_vf_mul(a22, a30));
+        glm_vf b08 = glm_vf_sub(glm_vf_mul(a20, a33), glm_vf_mul(a23, a30));
+        glm_vf b09 = glm_vf_sub(glm_vf_mul(a21, a32), glm_vf_mul(a22, a31));
+        glm_vf b10 = glm_vf_sub(glm_vf_mul(a21, a33), glm_vf_mul(a23, a31));
+        glm_vf b11 = glm_vf_sub(glm_vf_mul(a22, a33), glm_vf_mul(a23, a32));
+
+        glm_vf det = glm_vf_sub(glm_vf_mul(b00, b11), glm_vf_mul(b01, b10));
+        det = glm_vf_add(det, glm_vf_mul(b02, b09));
+        det = glm_vf_add(det, glm_vf_mul(b03, b08));
+        det = glm_vf_sub(det, glm_vf_mul(b04, b07));
+        det = glm_vf_add(det, glm_vf_mul(b05, b06));
+
+        // Singular lanes get a zero mask and keep their original elements
+        glm_vf keep = glm_vf_cmpeq(det, zero);
+        if (glm_vf_movemask(keep) == (1 << GLM_VF_WIDTH) - 1) {
+            continue;
+        }
+        det = glm_vf_div(one, glm_vf_blend(det, one, keep));
+
+#define GLM_MAT4SOA_STORE(e, v, a) \
+        glm_vf_store(dst->m[e] + i, glm_vf_blend(glm_vf_mul((v), det), (a), keep))
+
+        GLM_MAT4SOA_STORE(0, glm_vf_add(glm_vf_sub(glm_vf_mul(a11, b11), glm_vf_mul(a12, b10)), glm_vf_mul(a13, b09)), a00);
+        GLM_MAT4SOA_STORE(1, glm_vf_sub(glm_vf_sub(glm_vf_mul(a02, b10), glm_vf_mul(a01, b11)), glm_vf_mul(a03, b09)), a01);
+        GLM_MAT4SOA_STORE(2, glm_vf_add(glm_vf_sub(glm_vf_mul(a31, b05), glm_vf_mul(a32, b04)), glm_vf_mul(a33, b03)), a02);
+        GLM_MAT4SOA_STORE(3, glm_vf_sub(glm_vf_sub(glm_vf_mul(a22, b04), glm_vf_mul(a21, b05)), glm_vf_mul(a23, b03)), a03);
+        GLM_MAT4SOA_STORE(4, glm_vf_sub(glm_vf_sub(glm_vf_mul(a12, b08), glm_vf_mul(a10, b11)), glm_vf_mul(a13, b07)), a10);
+        GLM_MAT4SOA_STORE(5, glm_vf_add(glm_vf_sub(glm_vf_mul(a00, b11), glm_vf_mul(a02, b08)), glm_vf_mul(a03, b07)), a11);
+        GLM_MAT4SOA_STORE(6, glm_vf_sub(glm_vf_sub(glm_vf_mul(a32, b02), glm_vf_mul(a30, b05)), glm_vf_mul(a33, b01)), a12);
+        GLM_MAT4SOA_STORE(7, glm_vf_add(glm_vf_sub(glm_vf_mul(a20, b05), glm_vf_mul(a22, b02)), glm_vf_mul(a23, b01)), a13);
+        GLM_MAT4SOA_STORE(8, glm_vf_add(glm_vf_sub(glm_vf_mul(a10, b10), glm_vf_mul(a11, b08)), glm_vf_mul(a13, b06)), a20);
+        GLM_MAT4SOA_STORE(9, glm_vf_sub(glm_vf_sub(glm_vf_mul(a01, b08), glm_vf_mul(a00, b10)), glm_vf_mul(a03, b06)), a21);
+        GLM_MAT4SOA_STORE(10, glm_vf_add(glm_vf_sub(glm_vf_mul(a30, b04), glm_vf_mul(a31, b02)), glm_vf_mul(a33, b00)), a22);
+        GLM_MAT4SOA_STORE(11, glm_vf_sub(glm_vf_sub(glm_vf_mul(a21, b02), glm_vf_mul(a20, b04)), glm_vf_mul(a23, b00)), a23);
+        GLM_MAT4SOA_STORE(12, glm_vf_sub(glm_vf_sub(glm_vf_mul(a11, b07), glm_vf_mul(a10, b09)), glm_vf_mul(a12, b06)), a30);
+        GLM_MAT4SOA_STORE(13, glm_vf_add(glm_vf_sub(glm_vf_mul(a00, b09), glm_vf_mul(a01, b07)), glm_vf_mul(a02, b06)), a31);
+        GLM_MAT4SOA_STORE(14, glm_vf_sub(glm_vf_sub(glm_vf_mul(a31, b01), glm_vf_mul(a30, b03)), glm_vf_mul(a32, b00)), a32);
+        GLM_MAT4SOA_STORE(15, glm_vf_add(glm_vf_sub(glm_vf_mul(a20, b03), glm_vf_mul(a21, b01)), glm_vf_mul(a22, b00)), a33);
+
+#undef GLM_MAT4SOA_STORE
+    }
+#else
+    for (i = 0; i < dst->count; i++) {
+        float a00 = dst->m[0][i], a01 = dst->m[1][i], a02 = dst->m[2][i], a03 = dst->m[3][i];
+        float a10 = dst->m[4][i], a11 = dst->m[5][i], a12 = dst->m[6][i], a13 = dst->m[7][i];
+        float a20 = dst->m[8][i], a21 = dst->m[9][i], a22 = dst->m[10][i], a23 = dst->m[11][i];
+        float a30 = dst->m[12][i], a31 = dst->m[13][i], a32 = dst->m[14][i], a33 = dst->m[15][i];
+
+        float b00 = a00 * a11 - a01 * a10;
+        float b01 = a00 * a12 - a02 * a10;
+        float b02 = a00 * a13 - a03 * a10;
+        float b03 = a01 * a12 - a02 * a11;
+        float b04 = a01 * a13 - a03 * a11;
+        float b05 = a02 * a13 - a03 * a12;
+        float b06 = a20 * a31 - a21 * a30;
+        float b07 = a20 * a32 - a22 * a30;
+        float b08 = a20 * a33 - a23 * a30;
+        float b09 = a21 * a32 - a22 * a31;
+        float b10 = a21 * a33 - a23 * a31;
+        float b11 = a22 * a33 - a23 * a32;
+
+        float det = b00 * b11 - b01 * b10 + b02 * b09 + b03 * b08 - b04 * b07 + b05 * b06;
+
+        if (!det) {
+            continue;
+        }
+        det = 1.0 / det;
+
+        dst->m[0][i] = (a11 * b11 - a12 * b10 + a13 * b09) * det;
+        dst->m[1][i] = (a02 * b10 - a01 * b11 - a03 * b09) * det;
+        dst->m[2][i] = (a31 * b05 - a32 * b04 + a33 * b03) * det;
+        dst->m[3][i] = (a22 * b04 - a21 * b05 - a23 * b03) * det;
+        dst->m[4][i] = (a12 * b08 - a10 * b11 - a13 * b07) * det;
+        dst->m[5][i] = (a00 * b11 - a02 * b08 + a03 * b07) * det;
+        dst->m[6][i] = (a32 * b02 - a30 * b05 - a33 * b01) * det;
+        dst->m[7][i] = (a20 * b05 - a22 * b02 + a23 * b01) * det;
+        dst->m[8][i] = (a10 * b10 - a11 * b08 + a13 * b06) * det;
+        dst->m[9][i] = (a01 * b08 - a00 * b10 - a03 * b06) * det;
+        dst->m[10][i] = (a30 * b04 - a31 * b02 + a33 * b00) * det;
+        dst->m[11][i] = (a21 * b02 - a20 * b04 - a23 * b00) * det;
+        dst->m[12][i] = (a11 * b07 - a10 * b09 - a12 * b06) * det;
+        dst->m[13][i] = (a00 * b09 - a01 * b07 + a02 * b06) * det;
+        dst->m[14][i] = (a31 * b01 - a30 * b03 - a32 * b00) * det;
+        dst->m[15][i] = (a20 * b03 - a21 * b01 + a22 * b00) * det;
+    }
+#endif
+}
+
+/**
+ * Calculates the determinant of every matrix of a batch
+ *
+ * @param {float[]} dst receives the determinants, must be aligned to
+ *                  MAT4SOA_ALIGNMENT bytes and hold mat4soa_paddedCount(a->count) floats
+ * @param {mat4soa} a the source batch
+ */
+GLM_API void mat4soa_determinant(float *dst, mat4soa *a) {
+    size_t i;
+#if defined(GLM_VF_WIDTH)
+    size_t n = mat4soa_paddedCount(a->count);
+    for (i = 0; i < n; i += GLM_VF_WIDTH) {
+        glm_vf a00 = glm_vf_load(a->m[0] + i), a01 = glm_vf_load(a->m[1] + i);
+        glm_vf a02 = glm_vf_load(a->m[2] + i), a03 = glm_vf_load(a->m[3] + i);
+        glm_vf a10 = glm_vf_load(a->m[4] + i), a11 = glm_vf_load(a->m[5] + i);
+        glm_vf a12 = glm_vf_load(a->m[6] + i), a13 = glm_vf_load(a->m[7] + i);
+        glm_vf a20 = glm_vf_load(a->m[8] + i), a21 = glm_vf_load(a->m[9] + i);
+        glm_vf a22 = glm_vf_load(a->m[10] + i), a23 = glm_vf_load(a->m[11] + i);
+        glm_vf a30 = glm_vf_load(a->m[12] + i), a31 = glm_vf_load(a->m[13] + i);
+        glm_vf a32 = glm_vf_load(a->m[14] + i), a33 = glm_vf_load(a->m[15] + i);
+
+        glm_vf b00 = glm_vf_sub(glm_vf_mul(a00, a11), glm_vf_mul(a01, a10));
+        glm_vf b01 = glm_vf_sub(glm_vf_mul(a00, a12), glm_vf_mul(a02, a10));
+        glm_vf b02 = glm_vf_sub(glm_vf_mul(a00, a13), glm_vf_mul(a03, a10));
+        glm_vf b03 = glm_vf_sub(glm_vf_mul(a01, a12), glm_vf_mul(a02, a11));
+        glm_vf b04 = glm_vf_sub(glm_vf_mul(a01, a13), glm_vf_mul(a03, a11));
+        glm_vf b05 = glm_vf_sub(glm_vf_mul(a02, a13), glm_vf_mul(a03, a12));
+        glm_vf b06 = glm_vf_sub(glm_vf_mul(a20, a31), glm_vf_mul(a21, a30));
+        glm_vf b07 = glm_vf_sub(glm_vf_mul(a20, a32), glm_vf_mul(a22, a30));
+        glm_vf b08 = glm_vf_sub(glm_vf_mul(a20, a33), glm_vf_mul(a23, a30));
+        glm_vf b09 = glm_vf_sub(glm_vf_mul(a21, a32), glm_vf_mul(a22, a31));
+        glm_vf b10 = glm_vf_sub(glm_vf_mul(a21, a33), glm_vf_mul(a23, a31));
+        glm_vf b11 = glm_vf_sub(glm_vf_mul(a22, a33), glm_vf_mul(a23, a32));
+
+        glm_vf det = glm_vf_sub(glm_vf_mul(b00, b11), glm_vf_mul(b01, b10));
+        det = glm_vf_add(det, glm_vf_mul(b02, b09));
+        det = glm_vf_add(det, glm_vf_mul(b03, b08));
+        det = glm_vf_sub(det, glm_vf_mul(b04, b07));
+        glm_vf_store(dst + i, glm_vf_add(det, glm_vf_mul(b05, b06)));
+    }
+#else
+    for (i = 0; i < a->count; i++) {
+        float a00 = a->m[0][i], a01 = a->m[1][i], a02 = a->m[2][i], a03 = a->m[3][i];
+        float a10 = a->m[4][i], a11 = a->m[5][i], a12 = a->m[6][i], a13 = a->m[7][i];
+        float a20 = a->m[8][i], a21 = a->m[9][i], a22 = a->m[10][i], a23 = a->m[11][i];
+        float a30 = a->m[12][i], a31 = a->m[13][i], a32 = a->m[14][i], a33 = a->m[15][i];
+
+        float b00 = a00 * a11 - a01 * a10;
+        float b01 = a00 * a12 - a02 * a10;
+        float b02 = a00 * a13 - a03 * a10;
+        float b03 = a01 * a12 - a02 * a11;
+        float b04 = a01 * a13 - a03 * a11;
+        float b05 = a02 * a13 - a03 * a12;
+        float b06 = a20 * a31 - a21 * a30;
+        float b07 = a20 * a32 - a22 * a30;
+        float b08 = a20 * a33 - a23 * a30;
+        float b09 = a21 * a32 - a22 * a31;
+        float b10 = a21 * a33 - a23 * a31;
+        float b11 = a22 * a33 - a23 * a32;
+
+        dst[i] = b00 * b11 - b01 * b10 + b02 * b09 + b03 * b08 - b04 * b07 + b05 * b06;
+    }
+#endif
+}
@@ -0,0 +1,22 @@
+#ifndef NOALIAS_H
+#define NOALIAS_H
+
+#include <assert.h>
+#include <stdint.h>
+
+/*
+ * Checks in debug builds that the n floats at out and the m floats at in
+ * do not overlap, as required by the GLM_RESTRICT out parameters.
+ * Compiles to nothing when NDEBUG is defined.
+ */
+#define GLM_ASSERT_NOALIAS(out, n, in, m) \
+    assert((const float *)(out) + (n) <= (const float *)(in) || \
+           (const float *)(in) + (m) <= (const float *)(out))
+
+/*
+ * Checks in debug builds that p is aligned to n bytes, as required by the
+ * functions of aligned.h
+ */
+#define GLM_ASSERT_ALIGNED(p, n) assert(((uintptr_t)(p) & ((n) - 1)) == 0)
+
+#endif
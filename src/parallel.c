@@ -0,0 +1,234 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "parallel.h"
+#include "vec3.h"
+#include "mat4.h"
+#include <stdint.h>
+
+#ifdef GLM_PARALLEL_PTHREADS
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#endif
+
+static size_t default_chunk = PARALLEL_DEFAULT_CHUNK;
+
+// Round up to a multiple of 8, saturating instead of wrapping to 0
+static size_t round_chunk(size_t chunk) {
+    return chunk > SIZE_MAX - 7 ? SIZE_MAX & ~(size_t)7 : (chunk + 7) & ~(size_t)7;
+}
+
+#ifdef GLM_PARALLEL_PTHREADS
+
+// State of the batch being processed, guarded by lock except for next
+static struct {
+    parallel_fn fn;
+    void *ctx;
+    size_t count;
+    size_t chunk;
+    atomic_size_t next;
+    size_t active;          // workers that have not finished the batch yet
+    unsigned long generation;
+} job;
+
+static pthread_t workers[PARALLEL_MAX_THREADS - 1];
+static size_t worker_count = 0;
+static unsigned long spawn_generation = 0;
+static int quit = 0;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t submit_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+static _Thread_local int in_pool = 0;
+
+static void run_chunks(void) {
+    size_t begin;
+    while ((begin = atomic_fetch_add(&job.next, job.chunk)) < job.count) {
+        size_t end = job.count - begin < job.chunk ? job.count : begin + job.chunk;
+        job.fn(job.ctx, begin, end);
+    }
+}
+
+static void *worker_main(void *arg) {
+    unsigned long seen;
+    (void)arg;
+
+    in_pool = 1;
+    pthread_mutex_lock(&lock);
+    // A batch may already have been submitted by the time this thread runs
+    seen = spawn_generation;
+    for (;;) {
+        while (job.generation == seen && !quit) {
+            pthread_cond_wait(&work_cond, &lock);
+        }
+        if (quit) {
+            break;
+        }
+        seen = job.generation;
+        pthread_mutex_unlock(&lock);
+
+        run_chunks();
+
+        pthread_mutex_lock(&lock);
+        if (--job.active == 0) {
+            pthread_cond_signal(&done_cond);
+        }
+    }
+    pthread_mutex_unlock(&lock);
+    return NULL;
+}
+
+size_t parallel_init(size_t threads) {
+    if (threads == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? (size_t)online : 1;
+    }
+    if (threads > PARALLEL_MAX_THREADS) {
+        threads = PARALLEL_MAX_THREADS;
+    }
+
+    parallel_shutdown();
+
+    pthread_mutex_lock(&submit_lock);
+    quit = 0;
+    spawn_generation = job.generation;
+    while (worker_count < threads - 1) {
+        if (pthread_create(&workers[worker_count], NULL, worker_main, NULL)) {
+            break;
+        }
+        worker_count++;
+    }
+    pthread_mutex_unlock(&submit_lock);
+    return worker_count + 1;
+}
+
+void parallel_shutdown(void) {
+    size_t i;
+
+    pthread_mutex_lock(&submit_lock);
+    pthread_mutex_lock(&lock);
+    quit = 1;
+    pthread_cond_broadcast(&work_cond);
+    pthread_mutex_unlock(&lock);
+    for (i = 0; i < worker_count; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    worker_count = 0;
+    pthread_mutex_unlock(&submit_lock);
+}
+
+size_t parallel_threadCount(void) {
+    return worker_count + 1;
+}
+
+void parallel_for(size_t count, size_t chunk, parallel_fn fn, void *ctx) {
+    chunk = round_chunk(chunk ? chunk : default_chunk);
+
+    // Not worth waking anybody up, or called from inside a chunk
+    if (count <= chunk || in_pool || worker_count == 0) {
+        fn(ctx, 0, count);
+        return;
+    }
+
+    pthread_mutex_lock(&submit_lock);
+    pthread_mutex_lock(&lock);
+    job.fn = fn;
+    job.ctx = ctx;
+    job.count = count;
+    job.chunk = chunk;
+    atomic_store(&job.next, 0);
+    job.active = worker_count;
+    job.generation++;
+    pthread_cond_broadcast(&work_cond);
+    pthread_mutex_unlock(&lock);
+
+    in_pool = 1;
+    run_chunks();
+    in_pool = 0;
+
+    pthread_mutex_lock(&lock);
+    while (job.active) {
+        pthread_cond_wait(&done_cond, &lock);
+    }
+    pthread_mutex_unlock(&lock);
+    pthread_mutex_unlock(&submit_lock);
+}
+
+#else
+
+size_t parallel_init(size_t threads) {
+    (void)threads;
+    return 1;
+}
+
+void parallel_shutdown(void) {
+}
+
+size_t parallel_threadCount(void) {
+    return 1;
+}
+
+void parallel_for(size_t count, size_t chunk, parallel_fn fn, void *ctx) {
+    (void)chunk;
+    fn(ctx, 0, count);
+}
+
+#endif
+
+void parallel_setChunkSize(size_t chunk) {
+    default_chunk = chunk ? round_chunk(chunk) : PARALLEL_DEFAULT_CHUNK;
+}
+
+typedef struct {
+    vec3 *dst;
+    vec3 *src;
+    float *m;
+} transform_ctx;
+
+static void transformMat4_chunk(void *ctx, size_t begin, size_t end) {
+    transform_ctx *c = ctx;
+    vec3_transformMat4_array(c->dst + begin, c->src + begin, end - begin, c->m);
+}
+
+static void transformMat3_chunk(void *ctx, size_t begin, size_t end) {
+    transform_ctx *c = ctx;
+    vec3_transformMat3_array(c->dst + begin, c->src + begin, end - begin, c->m);
+}
+
+static void transformQuat_chunk(void *ctx, size_t begin, size_t end) {
+    transform_ctx *c = ctx;
+    vec3_transformQuat_array(c->dst + begin, c->src + begin, end - begin, c->m);
+}
+
+void parallel_vec3_transformMat4(vec3 *dst, vec3 *src, size_t count, mat4 m) {
+    transform_ctx c = { dst, src, m };
+    parallel_for(count, 0, transformMat4_chunk, &c);
+}
+
+void parallel_vec3_transformMat3(vec3 *dst, vec3 *src, size_t count, mat3 m) {
+    transform_ctx c = { dst, src, m };
+    parallel_for(count, 0, transformMat3_chunk, &c);
+}
+
+void parallel_vec3_transformQuat(vec3 *dst, vec3 *src, size_t count, quat q) {
+    transform_ctx c = { dst, src, q };
+    parallel_for(count, 0, transformQuat_chunk, &c);
+}
+
+typedef struct {
+    mat4 *dst;
+    mat4 *b;
+} multiply_ctx;
+
+static void multiply_chunk(void *ctx, size_t begin, size_t end) {
+    multiply_ctx *c = ctx;
+    size_t i;
+    for (i = begin; i < end; i++) {
+        mat4_multiply(c->dst[i], c->b[i]);
+    }
+}
+
+void parallel_mat4_multiply(mat4 *dst, mat4 *b, size_t count) {
+    multiply_ctx c = { dst, b };
+    parallel_for(count, 0, multiply_chunk, &c);
+}
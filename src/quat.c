@@ -1,13 +1,25 @@
 #include "quat.h"
 #include "epsilon.h"
+#include "noalias.h"
+#include "simd.h"
 #include <math.h>
 
+/* Weight of one end of quat_slerpFast, xm1 is the cosine of the angle between the quats minus 1 */
+static inline float glm_quat_slerpFastWeight(float xm1, float t) {
+    float tt = t * t, acc = 1;
+    int k;
+    for (k = 8; k-- > 0;) {
+        acc = (glm_slerp_u[k] * tt - glm_slerp_v[k]) * xm1 * acc + 1;
+    }
+    return t * acc;
+}
+
 /**
  * Set a quat to the identity quaternion
  *
  * @param {quat} out the receiving quaternion
  */
-void quat_identity(quat dst) {
+GLM_API void quat_identity(quat dst) {
     dst[0] = 0;
     dst[1] = 0;
     dst[2] = 0;
@@ -22,13 +34,14 @@ void quat_identity(quat dst) {
  * @param {vec3} axis the axis around which to rotate
  * @param {Number} rad the angle in radians
  **/
-void quat_setAxisAngle(quat dst, vec3 axis, float rad) {
+GLM_API void quat_setAxisAngle(quat dst, vec3 axis, float rad) {
     rad = rad * 0.5;
-    float s = sinf(rad);
+    float s, c;
+    glm_rotation_sincos(rad, &s, &c);
     dst[0] = s * axis[0];
     dst[1] = s * axis[1];
     dst[2] = s * axis[2];
-    dst[3] = cosf(rad);
+    dst[3] = c;
 }
 
 /**
@@ -44,7 +57,7 @@ void quat_setAxisAngle(quat dst, vec3 axis, float rad) {
  * @param  {quat} q     Quaternion to be decomposed
  * @return {Number}     Angle, in radians, of the rotation
  */
-float quat_getAxisAngle(vec3 out_axis, quat q) {
+GLM_API float quat_getAxisAngle(vec3 out_axis, quat q) {
     float rad = acosf(q[3]) * 2.0;
     float s = sinf(rad / 2.0);
     if (s > EPSILON) {
@@ -67,7 +80,7 @@ float quat_getAxisAngle(vec3 out_axis, quat q) {
  * @param {quat} out the receiving quaternion
  * @param {quat} b the second operand
  */
-void quat_multiply(quat dst, quat b) {
+GLM_API void quat_multiply(quat dst, quat b) {
     float ax = dst[0], ay = dst[1], az = dst[2], aw = dst[3];
     float bx = b[0], by = b[1], bz = b[2], bw = b[3];
 
@@ -83,11 +96,12 @@ void quat_multiply(quat dst, quat b) {
  * @param {quat} out quat receiving operation result
  * @param {number} rad angle (in radians) to rotate
  */
-void quat_rotateX(quat dst, float rad) {
+GLM_API void quat_rotateX(quat dst, float rad) {
     rad *= 0.5;
 
     float ax = dst[0], ay = dst[1], az = dst[2], aw = dst[3];
-    float bx = sinf(rad), bw = cosf(rad);
+    float bx, bw;
+    glm_rotation_sincos(rad, &bx, &bw);
 
     dst[0] = ax * bw + aw * bx;
     dst[1] = ay * bw + az * bx;
@@ -101,11 +115,12 @@ void quat_rotateX(quat dst, float rad) {
  * @param {quat} out quat receiving operation result
  * @param {number} rad angle (in radians) to rotate
  */
-void quat_rotateY(quat dst, float rad) {
+GLM_API void quat_rotateY(quat dst, float rad) {
     rad *= 0.5;
 
     float ax = dst[0], ay = dst[1], az = dst[2], aw = dst[3];
-    float by = sinf(rad), bw = cosf(rad);
+    float by, bw;
+    glm_rotation_sincos(rad, &by, &bw);
 
     dst[0] = ax * bw - az * by;
     dst[1] = ay * bw + aw * by;
@@ -119,11 +134,12 @@ void quat_rotateY(quat dst, float rad) {
  * @param {quat} out quat receiving operation result
  * @param {number} rad angle (in radians) to rotate
  */
-void quat_rotateZ(quat dst, float rad) {
+GLM_API void quat_rotateZ(quat dst, float rad) {
     rad *= 0.5;
 
     float ax = dst[0], ay = dst[1], az = dst[2], aw = dst[3];
-    float bz = sinf(rad), bw = cosf(rad);
+    float bz, bw;
+    glm_rotation_sincos(rad, &bz, &bw);
 
     dst[0] = ax * bw + ay * bz;
     dst[1] = ay * bw - ax * bz;
@@ -138,7 +154,7 @@ void quat_rotateZ(quat dst, float rad) {
  *
  * @param {quat} out the receiving quaternion
  */
-void quat_calculateW(quat dst) {
+GLM_API void quat_calculateW(quat dst) {
     float x = dst[0], y = dst[1], z = dst[2];
 
     dst[0] = x;
@@ -154,7 +170,7 @@ void quat_calculateW(quat dst) {
  * @param {quat} b the second operand
  * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
  */
-void quat_slerp(quat dst, quat b, float t) {
+GLM_API void quat_slerp(quat dst, quat b, float t) {
     // benchmarks:
     //    http://jsperf.com/quaternion-slerp-implementations
     float ax = dst[0], ay = dst[1], az = dst[2], aw = dst[3];
@@ -193,12 +209,74 @@ void quat_slerp(quat dst, quat b, float t) {
     dst[3] = scale0 * aw + scale1 * bw;
 }
 
+/**
+ * Performs a normalized linear interpolation between two quat along the
+ * shortest path. Much cheaper than quat_slerp but does not move at a
+ * constant angular speed: the rotation is off by up to 0.14 radians
+ * (8 degrees) when the inputs are 180 degrees apart, less when they are
+ * closer.
+ *
+ * @param {quat} out the receiving quaternion
+ * @param {quat} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_nlerp(quat dst, quat b, float t) {
+    float ax = dst[0], ay = dst[1], az = dst[2], aw = dst[3];
+    float bx = b[0], by = b[1], bz = b[2], bw = b[3];
+    float scale0 = 1 - t, scale1 = t, len;
+
+    // take the shortest path
+    if (ax * bx + ay * by + az * bz + aw * bw < 0) {
+        scale1 = -t;
+    }
+    ax = scale0 * ax + scale1 * bx;
+    ay = scale0 * ay + scale1 * by;
+    az = scale0 * az + scale1 * bz;
+    aw = scale0 * aw + scale1 * bw;
+    len = ax*ax + ay*ay + az*az + aw*aw;
+    if (len > 0) {
+        len = 1 / sqrtf(len);
+    }
+    dst[0] = ax * len;
+    dst[1] = ay * len;
+    dst[2] = az * len;
+    dst[3] = aw * len;
+}
+
+/**
+ * Performs a spherical linear interpolation between two unit quat with a
+ * polynomial instead of trigonometric functions. For t in [0-1] the
+ * rotation is within 6e-5 radians (0.004 degrees) of quat_slerp and the
+ * length within 3e-5 of 1.
+ *
+ * @param {quat} out the receiving quaternion
+ * @param {quat} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_slerpFast(quat dst, quat b, float t) {
+    float ax = dst[0], ay = dst[1], az = dst[2], aw = dst[3];
+    float bx = b[0], by = b[1], bz = b[2], bw = b[3];
+    float cosom = ax * bx + ay * by + az * bz + aw * bw;
+    float scale0, scale1;
+
+    scale0 = glm_quat_slerpFastWeight(fabsf(cosom) - 1, 1 - t);
+    scale1 = glm_quat_slerpFastWeight(fabsf(cosom) - 1, t);
+    // adjust signs (if necessary)
+    if (cosom < 0) {
+        scale1 = -scale1;
+    }
+    dst[0] = scale0 * ax + scale1 * bx;
+    dst[1] = scale0 * ay + scale1 * by;
+    dst[2] = scale0 * az + scale1 * bz;
+    dst[3] = scale0 * aw + scale1 * bw;
+}
+
 /**
  * Calculates the inverse of a quat
  *
  * @param {quat} out the receiving quaternion
  */
-void quat_invert(quat dst) {
+GLM_API void quat_invert(quat dst) {
     float a0 = dst[0], a1 = dst[1], a2 = dst[2], a3 = dst[3];
     float dot = a0*a0 + a1*a1 + a2*a2 + a3*a3;
     float invDot = dot ? 1.0/dot : 0;
@@ -218,7 +296,7 @@ void quat_invert(quat dst) {
  * @param {quat} out the receiving quaternion
  * @param {quat} a quat to calculate conjugate of
  */
-void quat_conjugate(quat dst) {
+GLM_API void quat_conjugate(quat dst) {
     dst[0] = -dst[0];
     dst[1] = -dst[1];
     dst[2] = -dst[2];
@@ -234,7 +312,7 @@ void quat_conjugate(quat dst) {
  * @param {quat} out the receiving quaternion
  * @param {mat3} m rotation matrix
  */
-void quat_fromMat3(quat dst, mat3 m) {
+GLM_API void quat_fromMat3(quat dst, mat3 m) {
     // Algorithm in Ken Shoemake's article in 1987 SIGGRAPH course notes
     // article "Quaternion Calculus and Fast Animation".
     float fTrace = m[0] + m[4] + m[8];
@@ -276,21 +354,394 @@ void quat_fromMat3(quat dst, mat3 m) {
  * @param {y} Angle to rotate around Y axis in degrees.
  * @param {z} Angle to rotate around Z axis in degrees.
  */
-void quat_fromEuler(quat dst, float x, float y, float z) {
+GLM_API void quat_fromEuler(quat dst, float x, float y, float z) {
     float halfToRad = 0.5 * M_PI / 180.0;
     x *= halfToRad;
     y *= halfToRad;
     z *= halfToRad;
 
-    float sx = sinf(x);
-    float cx = cosf(x);
-    float sy = sinf(y);
-    float cy = cosf(y);
-    float sz = sinf(z);
-    float cz = cosf(z);
+    float sx, cx, sy, cy, sz, cz;
+    glm_rotation_sincos(x, &sx, &cx);
+    glm_rotation_sincos(y, &sy, &cy);
+    glm_rotation_sincos(z, &sz, &cz);
 
     dst[0] = sx * cy * cz - cx * sy * sz;
     dst[1] = cx * sy * cz + sx * cy * sz;
     dst[2] = cx * cy * sz - sx * sy * cz;
     dst[3] = cx * cy * cz + sx * sy * sz;
 }
+
+/**
+ * Copies an array of version 1 (16 float) quaternions into
+ * an array of packed version 2 (4 float) quaternions.
+ *
+ * @param {quat_v2[]} dst the receiving array
+ * @param {quat_v1[]} src the quaternions to pack
+ * @param {Number} count number of quaternions
+ */
+GLM_API void quat_packArray(quat_v2 *dst, quat_v1 *src, size_t count) {
+    size_t i;
+    // Walk forwards so an in-place pack of a quat_v1 buffer works
+    for (i = 0; i < count; i++) {
+        dst[i][0] = src[i][0];
+        dst[i][1] = src[i][1];
+        dst[i][2] = src[i][2];
+        dst[i][3] = src[i][3];
+    }
+}
+
+/**
+ * Copies an array of packed version 2 (4 float) quaternions into
+ * an array of version 1 (16 float) quaternions.
+ * Components 4 to 15 of the receiving quaternions are left untouched.
+ *
+ * @param {quat_v1[]} dst the receiving array
+ * @param {quat_v2[]} src the quaternions to unpack
+ * @param {Number} count number of quaternions
+ */
+GLM_API void quat_unpackArray(quat_v1 *dst, quat_v2 *src, size_t count) {
+    size_t i;
+    // Walk backwards so an in-place unpack of a buffer sized for quat_v1 works
+    for (i = count; i-- > 0;) {
+        dst[i][3] = src[i][3];
+        dst[i][2] = src[i][2];
+        dst[i][1] = src[i][1];
+        dst[i][0] = src[i][0];
+    }
+}
+
+/**
+ * Interpolates every quat of an array towards the matching quat of a
+ * second array with quat_nlerp, eg. to blend two poses.
+ *
+ * @param {quat_v2[]} dst the receiving array
+ * @param {quat_v2[]} b the second operands, may be the same array as dst
+ * @param {Number} count number of quaternions
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_nlerp_array(quat_v2 *dst, quat_v2 *b, size_t count, float t) {
+    size_t i = 0;
+
+#if defined(GLM_AVX2)
+    i = glm_quat_nlerp_array_avx2(dst[0], b[0], count, t);
+#elif defined(GLM_SSE4)
+    i = glm_quat_nlerp_array_sse4(dst[0], b[0], count, t);
+#elif defined(GLM_DISPATCH)
+    if (glm_dispatch.quat_nlerp_array) {
+        i = glm_dispatch.quat_nlerp_array(dst[0], b[0], count, t);
+    }
+#endif
+
+    for (; i < count; i++) {
+        quat_nlerp(dst[i], b[i], t);
+    }
+}
+
+/**
+ * Interpolates every quat of an array towards the matching quat of a
+ * second array with quat_slerpFast, eg. to blend two poses.
+ *
+ * @param {quat_v2[]} dst the receiving array
+ * @param {quat_v2[]} b the second operands, may be the same array as dst
+ * @param {Number} count number of quaternions
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_slerpFast_array(quat_v2 *dst, quat_v2 *b, size_t count, float t) {
+    size_t i = 0;
+
+#if defined(GLM_AVX2)
+    i = glm_quat_slerpFast_array_avx2(dst[0], b[0], count, t);
+#elif defined(GLM_SSE4)
+    i = glm_quat_slerpFast_array_sse4(dst[0], b[0], count, t);
+#elif defined(GLM_DISPATCH)
+    if (glm_dispatch.quat_slerpFast_array) {
+        i = glm_dispatch.quat_slerpFast_array(dst[0], b[0], count, t);
+    }
+#endif
+
+    for (; i < count; i++) {
+        quat_slerpFast(dst[i], b[i], t);
+    }
+}
+
+/**
+ * Creates an array of quaternions from euler angles like quat_fromEuler,
+ * computing the sines and cosines of 4 or 8 angles at once with the fast
+ * sincos (absolute error below 1e-7) whatever GLM_FAST_TRIG is set to.
+ *
+ * @param {quat_v2[]} dst the receiving array
+ * @param {vec3[]} euler angles around the X, Y and Z axis in degrees
+ * @param {Number} count number of quaternions
+ */
+GLM_API void quat_fromEuler_array(quat_v2 *dst, vec3 *euler, size_t count) {
+    size_t i = 0;
+
+#if defined(GLM_AVX2)
+    i = glm_quat_fromEuler_array_avx2(dst[0], euler[0], count);
+#elif defined(GLM_SSE4)
+    i = glm_quat_fromEuler_array_sse4(dst[0], euler[0], count);
+#elif defined(GLM_DISPATCH)
+    if (glm_dispatch.quat_fromEuler_array) {
+        i = glm_dispatch.quat_fromEuler_array(dst[0], euler[0], count);
+    }
+#endif
+
+    for (; i < count; i++) {
+        float sx, cx, sy, cy, sz, cz;
+        glm_sincos(euler[i][0] * GLM_HALF_DEG_TO_RAD, &sx, &cx);
+        glm_sincos(euler[i][1] * GLM_HALF_DEG_TO_RAD, &sy, &cy);
+        glm_sincos(euler[i][2] * GLM_HALF_DEG_TO_RAD, &sz, &cz);
+
+        dst[i][0] = sx * cy * cz - cx * sy * sz;
+        dst[i][1] = cx * sy * cz + sx * cy * sz;
+        dst[i][2] = cx * cy * sz - sx * sy * cz;
+        dst[i][3] = cx * cy * cz + sx * sy * sz;
+    }
+}
+
+/**
+ * Multiplies two quat's
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {quat} b the second operand
+ */
+GLM_API void quat_multiplyTo(float *GLM_RESTRICT out, quat a, quat b) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    float ax = a[0], ay = a[1], az = a[2], aw = a[3];
+    float bx = b[0], by = b[1], bz = b[2], bw = b[3];
+
+    out[0] = ax * bw + aw * bx + ay * bz - az * by;
+    out[1] = ay * bw + aw * by + az * bx - ax * bz;
+    out[2] = az * bw + aw * bz + ax * by - ay * bx;
+    out[3] = aw * bw - ax * bx - ay * by - az * bz;
+}
+
+/**
+ * Rotates a quaternion by the given angle about the X axis
+ *
+ * @param {quat} out quat receiving operation result, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {number} rad angle (in radians) to rotate
+ */
+GLM_API void quat_rotateXTo(float *GLM_RESTRICT out, quat a, float rad) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    rad *= 0.5;
+
+    float ax = a[0], ay = a[1], az = a[2], aw = a[3];
+    float bx, bw;
+    glm_rotation_sincos(rad, &bx, &bw);
+
+    out[0] = ax * bw + aw * bx;
+    out[1] = ay * bw + az * bx;
+    out[2] = az * bw - ay * bx;
+    out[3] = aw * bw - ax * bx;
+}
+
+/**
+ * Rotates a quaternion by the given angle about the Y axis
+ *
+ * @param {quat} out quat receiving operation result, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {number} rad angle (in radians) to rotate
+ */
+GLM_API void quat_rotateYTo(float *GLM_RESTRICT out, quat a, float rad) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    rad *= 0.5;
+
+    float ax = a[0], ay = a[1], az = a[2], aw = a[3];
+    float by, bw;
+    glm_rotation_sincos(rad, &by, &bw);
+
+    out[0] = ax * bw - az * by;
+    out[1] = ay * bw + aw * by;
+    out[2] = az * bw + ax * by;
+    out[3] = aw * bw - ay * by;
+}
+
+/**
+ * Rotates a quaternion by the given angle about the Z axis
+ *
+ * @param {quat} out quat receiving operation result, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {number} rad angle (in radians) to rotate
+ */
+GLM_API void quat_rotateZTo(float *GLM_RESTRICT out, quat a, float rad) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    rad *= 0.5;
+
+    float ax = a[0], ay = a[1], az = a[2], aw = a[3];
+    float bz, bw;
+    glm_rotation_sincos(rad, &bz, &bw);
+
+    out[0] = ax * bw + ay * bz;
+    out[1] = ay * bw - ax * bz;
+    out[2] = az * bw + aw * bz;
+    out[3] = aw * bw - az * bz;
+}
+
+/**
+ * Calculates the W component of a quat from the X, Y, and Z components.
+ * Assumes that quaternion is 1 unit in length.
+ * Any existing W component will be ignored.
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ */
+GLM_API void quat_calculateWTo(float *GLM_RESTRICT out, quat a) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    float x = a[0], y = a[1], z = a[2];
+
+    out[0] = x;
+    out[1] = y;
+    out[2] = z;
+    out[3] = sqrtf(fabs(1.0 - x * x - y * y - z * z));
+}
+
+/**
+ * Performs a spherical linear interpolation between two quat
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {quat} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_slerpTo(float *GLM_RESTRICT out, quat a, quat b, float t) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    // benchmarks:
+    //    http://jsperf.com/quaternion-slerp-implementations
+    float ax = a[0], ay = a[1], az = a[2], aw = a[3];
+    float bx = b[0], by = b[1], bz = b[2], bw = b[3];
+
+    float omega, cosom, sinom, scale0, scale1;
+
+    // calc cosine
+    cosom = ax * bx + ay * by + az * bz + aw * bw;
+    // adjust signs (if necessary)
+    if ( cosom < 0.0 ) {
+        cosom = -cosom;
+        bx = - bx;
+        by = - by;
+        bz = - bz;
+        bw = - bw;
+    }
+    // calculate coefficients
+    if ( (1.0 - cosom) > EPSILON ) {
+        // standard case (slerp)
+        omega  = acosf(cosom);
+        sinom  = sinf(omega);
+        scale0 = sinf((1.0 - t) * omega) / sinom;
+        scale1 = sinf(t * omega) / sinom;
+    }
+    else {
+        // "from" and "to" quaternions are very close
+        //  ... so we can do a linear interpolation
+        scale0 = 1.0 - t;
+        scale1 = t;
+    }
+    // calculate final values
+    out[0] = scale0 * ax + scale1 * bx;
+    out[1] = scale0 * ay + scale1 * by;
+    out[2] = scale0 * az + scale1 * bz;
+    out[3] = scale0 * aw + scale1 * bw;
+}
+
+/**
+ * Performs a normalized linear interpolation between two quat, see quat_nlerp
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {quat} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_nlerpTo(float *GLM_RESTRICT out, quat a, quat b, float t) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    float ax = a[0], ay = a[1], az = a[2], aw = a[3];
+    float bx = b[0], by = b[1], bz = b[2], bw = b[3];
+    float scale0 = 1 - t, scale1 = t, len;
+
+    // take the shortest path
+    if (ax * bx + ay * by + az * bz + aw * bw < 0) {
+        scale1 = -t;
+    }
+    ax = scale0 * ax + scale1 * bx;
+    ay = scale0 * ay + scale1 * by;
+    az = scale0 * az + scale1 * bz;
+    aw = scale0 * aw + scale1 * bw;
+    len = ax*ax + ay*ay + az*az + aw*aw;
+    if (len > 0) {
+        len = 1 / sqrtf(len);
+    }
+    out[0] = ax * len;
+    out[1] = ay * len;
+    out[2] = az * len;
+    out[3] = aw * len;
+}
+
+/**
+ * Performs an approximate spherical linear interpolation between two
+ * unit quat, see quat_slerpFast
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {quat} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void quat_slerpFastTo(float *GLM_RESTRICT out, quat a, quat b, float t) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    float ax = a[0], ay = a[1], az = a[2], aw = a[3];
+    float bx = b[0], by = b[1], bz = b[2], bw = b[3];
+    float cosom = ax * bx + ay * by + az * bz + aw * bw;
+    float scale0, scale1;
+
+    scale0 = glm_quat_slerpFastWeight(fabsf(cosom) - 1, 1 - t);
+    scale1 = glm_quat_slerpFastWeight(fabsf(cosom) - 1, t);
+    // adjust signs (if necessary)
+    if (cosom < 0) {
+        scale1 = -scale1;
+    }
+    out[0] = scale0 * ax + scale1 * bx;
+    out[1] = scale0 * ay + scale1 * by;
+    out[2] = scale0 * az + scale1 * bz;
+    out[3] = scale0 * aw + scale1 * bw;
+}
+
+/**
+ * Calculates the inverse of a quat
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ */
+GLM_API void quat_invertTo(float *GLM_RESTRICT out, quat a) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    float a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3];
+    float dot = a0*a0 + a1*a1 + a2*a2 + a3*a3;
+    float invDot = dot ? 1.0/dot : 0;
+
+    // TODO: Would be faster to return [0,0,0,0] immediately if dot == 0
+
+    out[0] = -a0*invDot;
+    out[1] = -a1*invDot;
+    out[2] = -a2*invDot;
+    out[3] = a3*invDot;
+}
+
+/**
+ * Calculates the conjugate of a quat
+ * If the quaternion is normalized, this function is faster than quat.inverse and produces the same result.
+ *
+ * @param {quat} out the receiving quaternion, must not overlap the other arguments
+ * @param {quat} a the source quaternion
+ * @param {quat} a quat to calculate conjugate of
+ */
+GLM_API void quat_conjugateTo(float *GLM_RESTRICT out, quat a) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    out[0] = -a[0];
+    out[1] = -a[1];
+    out[2] = -a[2];
+    out[3] = a[3];
+}
@@ -0,0 +1,84 @@
+#include "scene.h"
+#include "vec3.h"
+#include "vec4.h"
+#include "quat.h"
+#include "mat4.h"
+#include <string.h>
+
+GLM_API void scene_init(scene *dst, int32_t *parent, quat_v2 *rotation, vec3 *translation, vec3 *scale, mat4 *world, uint8_t *dirty, size_t count) {
+    size_t i;
+
+    dst->parent = parent;
+    dst->rotation = rotation;
+    dst->translation = translation;
+    dst->scale = scale;
+    dst->world = world;
+    dst->dirty = dirty;
+    dst->count = count;
+
+    for (i = 0; i < count; i++) {
+        parent[i] = -1;
+        quat_identity(rotation[i]);
+        vec3_set(translation[i], 0, 0, 0);
+        vec3_set(scale[i], 1, 1, 1);
+        mat4_identity(world[i]);
+    }
+    memset(dirty, 1, count);
+}
+
+GLM_API void scene_setParent(scene *dst, size_t node, int32_t parent) {
+    dst->parent[node] = parent;
+    dst->dirty[node] = 1;
+}
+
+GLM_API void scene_setRotation(scene *dst, size_t node, quat q) {
+    vec4_copy(dst->rotation[node], q);
+    dst->dirty[node] = 1;
+}
+
+GLM_API void scene_setTranslation(scene *dst, size_t node, vec3 v) {
+    vec3_copy(dst->translation[node], v);
+    dst->dirty[node] = 1;
+}
+
+GLM_API void scene_setScale(scene *dst, size_t node, vec3 s) {
+    vec3_copy(dst->scale[node], s);
+    dst->dirty[node] = 1;
+}
+
+GLM_API void scene_markDirty(scene *dst, size_t node) {
+    dst->dirty[node] = 1;
+}
+
+GLM_API size_t scene_update(scene *dst) {
+    int32_t *parent = dst->parent;
+    uint8_t *dirty = dst->dirty;
+    mat4 *world = dst->world;
+    size_t i, updated = 0;
+    mat4 local;
+
+    for (i = 0; i < dst->count; i++) {
+        int32_t p = parent[i];
+
+        // Parents come first, so a dirty parent has already been recomputed
+        // and its flag is still set when its children are reached
+        if (p >= 0 && dirty[p]) {
+            dirty[i] = 1;
+        }
+        if (!dirty[i]) {
+            continue;
+        }
+
+        if (p < 0) {
+            mat4_fromRotationTranslationScale(world[i], dst->rotation[i], dst->translation[i], dst->scale[i]);
+        } else {
+            mat4_fromRotationTranslationScale(local, dst->rotation[i], dst->translation[i], dst->scale[i]);
+            mat4_copy(world[i], world[p]);
+            mat4_multiplyAffine(world[i], local);
+        }
+        updated++;
+    }
+
+    memset(dirty, 0, dst->count);
+    return updated;
+}
@@ -0,0 +1,1423 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+/*
+ * SIMD kernels shared by the sources in src/.
+ *
+ * The backend is chosen at compile time from the target flags:
+ *   GLM_SSE4 - SSE4.1 (-msse4.1)
+ *   GLM_AVX2 - AVX2 + FMA (-mavx2 -mfma), implies GLM_SSE4
+ * MSVC has no SSE4.1 switch and never defines __SSE4_1__, so GLM_SSE4 can
+ * also be defined by the build (CMake does so for GL_MATRIX_SIMD=SSE4).
+ * Define GLM_NO_SIMD to force the scalar code paths, which produce exactly
+ * the same results as the plain C implementation.
+ *
+ * With GLM_DISPATCH (GL_MATRIX_SIMD=DISPATCH) the sources are built for the
+ * baseline target and the hot kernels are reached through glm_dispatch
+ * instead, see the end of this file.
+ *
+ * All kernels use unaligned loads/stores and are written so that the
+ * destination may alias any of the sources.
+ */
+
+#if !defined(GLM_NO_SIMD)
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+#define GLM_AVX2
+#endif
+#if !defined(GLM_SSE4) && (defined(__SSE4_1__) || defined(GLM_AVX2))
+#define GLM_SSE4
+#endif
+#endif
+
+#if defined(GLM_AVX2)
+#include <immintrin.h>
+#elif defined(GLM_SSE4)
+#include <smmintrin.h>
+#endif
+#if defined(GLM_SSE4)
+#include <stdint.h>
+#endif
+#include <float.h>
+#include <math.h>
+
+/*
+ * Coefficients of the fast slerp polynomial (D. Eberly, "A Fast and
+ * Accurate Algorithm for Computing SLERP"): u = 1 / (i (2i + 1)) and
+ * v = i / (2i + 1) for i = 1..8, the last pair scaled by 1 + mu to
+ * balance the truncation error. Shared by quat.c and the kernels below.
+ */
+static const float glm_slerp_u[8] = {
+    1.0f / (1 * 3), 1.0f / (2 * 5), 1.0f / (3 * 7), 1.0f / (4 * 9),
+    1.0f / (5 * 11), 1.0f / (6 * 13), 1.0f / (7 * 15), 1.85298109240830f / (8 * 17)
+};
+static const float glm_slerp_v[8] = {
+    1.0f / 3, 2.0f / 5, 3.0f / 7, 4.0f / 9,
+    5.0f / 11, 6.0f / 13, 7.0f / 15, 1.85298109240830f * 8 / 17
+};
+
+/*
+ * Fast sincos: x is reduced to y in [-pi/4, pi/4] by the nearest multiple
+ * j of pi/2 (Cody-Waite, pi/2 split in three parts; the first two have
+ * 8 significant bits, so j * GLM_PIO2_1 and j * GLM_PIO2_2 are exact up to
+ * |j| = 2^16), then sin and cos of y come from minimax
+ * polynomials (Cephes sinf/cosf) and are swapped and negated by the
+ * quadrant j & 3. Shared by the rotation builders and the kernels below.
+ */
+#define GLM_2_OVER_PI 0.636619772367581343f
+#define GLM_PIO2_1 1.5703125f
+#define GLM_PIO2_2 4.825592041015625e-4f
+#define GLM_PIO2_3 1.2675908465098473e-6f
+#define GLM_SIN_C1 -1.6666654611e-1f
+#define GLM_SIN_C2 8.3321608736e-3f
+#define GLM_SIN_C3 -1.9515295891e-4f
+#define GLM_COS_C1 4.166664568298827e-2f
+#define GLM_COS_C2 -1.388731625493765e-3f
+#define GLM_COS_C3 2.443315711809948e-5f
+/* pi / 360, half angle in radians per degree of quat_fromEuler */
+#define GLM_HALF_DEG_TO_RAD 8.72664625997164788e-3f
+
+/*
+ * sin and cos of x with an absolute error below 1e-7 (libm: 3.3e-8) for
+ * |x| up to 1e5 radians, beyond that the reduction loses precision.
+ */
+static inline void glm_sincos(float x, float *s, float *c) {
+    float r = x * GLM_2_OVER_PI;
+    int q = (int)(r + (r < 0 ? -0.5f : 0.5f));
+    float j = (float)q;
+    float y = ((x - j * GLM_PIO2_1) - j * GLM_PIO2_2) - j * GLM_PIO2_3;
+    float z = y * y;
+    float sy = y + y * z * (GLM_SIN_C1 + z * (GLM_SIN_C2 + z * GLM_SIN_C3));
+    float cy = 1 - 0.5f * z + z * z * (GLM_COS_C1 + z * (GLM_COS_C2 + z * GLM_COS_C3));
+
+    float ss = (q & 1) ? cy : sy;
+    float cc = (q & 1) ? sy : cy;
+    *s = (q & 2) ? -ss : ss;
+    *c = ((q + 1) & 2) ? -cc : cc;
+}
+
+#if defined(GLM_SSE4)
+
+#define GLM_SHUFFLE(x, y, z, w) ((x) | ((y) << 2) | ((z) << 4) | ((w) << 6))
+#define GLM_SWIZZLE(v, x, y, z, w) _mm_shuffle_ps((v), (v), GLM_SHUFFLE(x, y, z, w))
+
+static inline __m128 glm_madd_ps(__m128 a, __m128 b, __m128 c) {
+#if defined(GLM_AVX2)
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+/*
+ * 1 / sqrt(x) for x >= FLT_MIN: the rsqrt estimate (relative error at most
+ * 1.5 * 2^-12) refined by one Newton-Raphson step, which about squares the
+ * error. The result is within 2^-21 relative of the exact value.
+ */
+static inline __m128 glm_rsqrt_ps(__m128 x) {
+    __m128 y = _mm_rsqrt_ps(x);
+    __m128 h = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), x), y);
+    return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(h, y)));
+}
+
+/* Four lane glm_sincos */
+static inline void glm_sincos_ps(__m128 x, __m128 *s, __m128 *c) {
+    __m128 j = _mm_floor_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(GLM_2_OVER_PI)), _mm_set1_ps(0.5f)));
+    __m128i q = _mm_cvttps_epi32(j);
+    __m128 y = _mm_sub_ps(x, _mm_mul_ps(j, _mm_set1_ps(GLM_PIO2_1)));
+    y = _mm_sub_ps(y, _mm_mul_ps(j, _mm_set1_ps(GLM_PIO2_2)));
+    y = _mm_sub_ps(y, _mm_mul_ps(j, _mm_set1_ps(GLM_PIO2_3)));
+    __m128 z = _mm_mul_ps(y, y);
+    __m128 sp = glm_madd_ps(z, _mm_set1_ps(GLM_SIN_C3), _mm_set1_ps(GLM_SIN_C2));
+    sp = glm_madd_ps(z, sp, _mm_set1_ps(GLM_SIN_C1));
+    sp = glm_madd_ps(_mm_mul_ps(y, z), sp, y);
+    __m128 cp = glm_madd_ps(z, _mm_set1_ps(GLM_COS_C3), _mm_set1_ps(GLM_COS_C2));
+    cp = glm_madd_ps(z, cp, _mm_set1_ps(GLM_COS_C1));
+    cp = glm_madd_ps(_mm_mul_ps(z, z), cp, glm_madd_ps(z, _mm_set1_ps(-0.5f), _mm_set1_ps(1)));
+
+    __m128i one = _mm_set1_epi32(1), two = _mm_set1_epi32(2);
+    __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, one), one));
+    __m128 ssign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, two), 30));
+    __m128 csign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, one), two), 30));
+    *s = _mm_xor_ps(_mm_blendv_ps(sp, cp, swap), ssign);
+    *c = _mm_xor_ps(_mm_blendv_ps(cp, sp, swap), csign);
+}
+
+/* 2x2 block helpers for glm_mat4_invert_sse4, blocks stored as (m00, m01, m10, m11) */
+static inline __m128 glm_mat2_mul_ps(__m128 a, __m128 b) {
+    return _mm_add_ps(_mm_mul_ps(a, GLM_SWIZZLE(b, 0, 3, 0, 3)),
+                      _mm_mul_ps(GLM_SWIZZLE(a, 1, 0, 3, 2), GLM_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+/* adj(a) * b */
+static inline __m128 glm_mat2_adjMul_ps(__m128 a, __m128 b) {
+    return _mm_sub_ps(_mm_mul_ps(GLM_SWIZZLE(a, 3, 3, 0, 0), b),
+                      _mm_mul_ps(GLM_SWIZZLE(a, 1, 1, 2, 2), GLM_SWIZZLE(b, 2, 3, 0, 1)));
+}
+
+/* a * adj(b) */
+static inline __m128 glm_mat2_mulAdj_ps(__m128 a, __m128 b) {
+    return _mm_sub_ps(_mm_mul_ps(a, GLM_SWIZZLE(b, 3, 0, 3, 0)),
+                      _mm_mul_ps(GLM_SWIZZLE(a, 1, 0, 3, 2), GLM_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+static inline void glm_mat4_copy_sse4(float *dst, const float *src) {
+    __m128 c0 = _mm_loadu_ps(src);
+    __m128 c1 = _mm_loadu_ps(src + 4);
+    __m128 c2 = _mm_loadu_ps(src + 8);
+    __m128 c3 = _mm_loadu_ps(src + 12);
+    _mm_storeu_ps(dst, c0);
+    _mm_storeu_ps(dst + 4, c1);
+    _mm_storeu_ps(dst + 8, c2);
+    _mm_storeu_ps(dst + 12, c3);
+}
+
+static inline void glm_mat4_transpose_sse4(float *dst, const float *src) {
+    __m128 c0 = _mm_loadu_ps(src);
+    __m128 c1 = _mm_loadu_ps(src + 4);
+    __m128 c2 = _mm_loadu_ps(src + 8);
+    __m128 c3 = _mm_loadu_ps(src + 12);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    _mm_storeu_ps(dst, c0);
+    _mm_storeu_ps(dst + 4, c1);
+    _mm_storeu_ps(dst + 8, c2);
+    _mm_storeu_ps(dst + 12, c3);
+}
+
+static inline void glm_mat4_multiply_sse4(float *dst, const float *a, const float *b) {
+    __m128 a0 = _mm_loadu_ps(a);
+    __m128 a1 = _mm_loadu_ps(a + 4);
+    __m128 a2 = _mm_loadu_ps(a + 8);
+    __m128 a3 = _mm_loadu_ps(a + 12);
+    int i;
+
+    for (i = 0; i < 16; i += 4) {
+        __m128 r = _mm_mul_ps(a0, _mm_set1_ps(b[i]));
+        r = glm_madd_ps(a1, _mm_set1_ps(b[i + 1]), r);
+        r = glm_madd_ps(a2, _mm_set1_ps(b[i + 2]), r);
+        r = glm_madd_ps(a3, _mm_set1_ps(b[i + 3]), r);
+        _mm_storeu_ps(dst + i, r);
+    }
+}
+
+/* Affine version of glm_mat4_multiply_sse4, the w row of the result is forced to (0, 0, 0, 1) */
+static inline void glm_mat4_multiplyAffine_sse4(float *dst, const float *a, const float *b) {
+    __m128 zero = _mm_setzero_ps();
+    __m128 a0 = _mm_blend_ps(_mm_loadu_ps(a), zero, 0x8);
+    __m128 a1 = _mm_blend_ps(_mm_loadu_ps(a + 4), zero, 0x8);
+    __m128 a2 = _mm_blend_ps(_mm_loadu_ps(a + 8), zero, 0x8);
+    __m128 a3 = _mm_blend_ps(_mm_loadu_ps(a + 12), _mm_set1_ps(1), 0x8);
+    int i;
+
+    for (i = 0; i < 16; i += 4) {
+        __m128 r = _mm_mul_ps(a0, _mm_set1_ps(b[i]));
+        r = glm_madd_ps(a1, _mm_set1_ps(b[i + 1]), r);
+        r = glm_madd_ps(a2, _mm_set1_ps(b[i + 2]), r);
+        _mm_storeu_ps(dst + i, i == 12 ? _mm_add_ps(r, a3) : r);
+    }
+}
+
+/*
+ * a * b where a is a scale and translation (diagonal upper 3x3, last row
+ * (0, 0, 0, 1)): every column of b is scaled by the diagonal of a, plus
+ * its w times the translation of a.
+ */
+static inline void glm_mat4_scaleMultiply_sse4(float *dst, const float *a, const float *b) {
+    __m128 d = _mm_setr_ps(a[0], a[5], a[10], 0);
+    __m128 t = _mm_loadu_ps(a + 12);
+    int i;
+
+    for (i = 0; i < 16; i += 4) {
+        __m128 c = _mm_loadu_ps(b + i);
+        _mm_storeu_ps(dst + i, glm_madd_ps(t, GLM_SWIZZLE(c, 3, 3, 3, 3), _mm_mul_ps(d, c)));
+    }
+}
+
+/* a * b where b is a scale and translation: columns 0-2 of a are scaled, column 3 is a * (t, 1) */
+static inline void glm_mat4_multiplyScale_sse4(float *dst, const float *a, const float *b) {
+    __m128 a0 = _mm_loadu_ps(a);
+    __m128 a1 = _mm_loadu_ps(a + 4);
+    __m128 a2 = _mm_loadu_ps(a + 8);
+    __m128 a3 = _mm_loadu_ps(a + 12);
+    __m128 r0 = _mm_mul_ps(a0, _mm_set1_ps(b[0]));
+    __m128 r1 = _mm_mul_ps(a1, _mm_set1_ps(b[5]));
+    __m128 r2 = _mm_mul_ps(a2, _mm_set1_ps(b[10]));
+    __m128 r3 = glm_madd_ps(a0, _mm_set1_ps(b[12]), a3);
+    r3 = glm_madd_ps(a1, _mm_set1_ps(b[13]), r3);
+    r3 = glm_madd_ps(a2, _mm_set1_ps(b[14]), r3);
+    _mm_storeu_ps(dst, r0);
+    _mm_storeu_ps(dst + 4, r1);
+    _mm_storeu_ps(dst + 8, r2);
+    _mm_storeu_ps(dst + 12, r3);
+}
+
+/* Returns 0 and leaves dst untouched when the matrix is singular */
+static inline int glm_mat4_invert_sse4(float *dst, const float *src) {
+    __m128 c0 = _mm_loadu_ps(src);
+    __m128 c1 = _mm_loadu_ps(src + 4);
+    __m128 c2 = _mm_loadu_ps(src + 8);
+    __m128 c3 = _mm_loadu_ps(src + 12);
+
+    // Split into 2x2 blocks | A B |
+    //                       | C D |
+    __m128 A = _mm_movelh_ps(c0, c1);
+    __m128 B = _mm_movehl_ps(c1, c0);
+    __m128 C = _mm_movelh_ps(c2, c3);
+    __m128 D = _mm_movehl_ps(c3, c2);
+
+    // (|A|, |B|, |C|, |D|)
+    __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(c0, c2, GLM_SHUFFLE(0, 2, 0, 2)), _mm_shuffle_ps(c1, c3, GLM_SHUFFLE(1, 3, 1, 3))),
+        _mm_mul_ps(_mm_shuffle_ps(c0, c2, GLM_SHUFFLE(1, 3, 1, 3)), _mm_shuffle_ps(c1, c3, GLM_SHUFFLE(0, 2, 0, 2))));
+    __m128 detA = GLM_SWIZZLE(detSub, 0, 0, 0, 0);
+    __m128 detB = GLM_SWIZZLE(detSub, 1, 1, 1, 1);
+    __m128 detC = GLM_SWIZZLE(detSub, 2, 2, 2, 2);
+    __m128 detD = GLM_SWIZZLE(detSub, 3, 3, 3, 3);
+
+    __m128 DC = glm_mat2_adjMul_ps(D, C);
+    __m128 AB = glm_mat2_adjMul_ps(A, B);
+    __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), glm_mat2_mul_ps(B, DC));
+    __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), glm_mat2_mul_ps(C, AB));
+    __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), glm_mat2_mulAdj_ps(D, AB));
+    __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), glm_mat2_mulAdj_ps(A, DC));
+
+    // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+    __m128 tr = _mm_mul_ps(AB, GLM_SWIZZLE(DC, 0, 2, 1, 3));
+    __m128 det = _mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC));
+    tr = _mm_hadd_ps(tr, tr);
+    tr = _mm_hadd_ps(tr, tr);
+    det = _mm_sub_ps(det, tr);
+
+    if (_mm_cvtss_f32(det) == 0) {
+        return 0;
+    }
+    det = _mm_div_ps(_mm_setr_ps(1, -1, -1, 1), det);
+
+    X = _mm_mul_ps(X, det);
+    Y = _mm_mul_ps(Y, det);
+    Z = _mm_mul_ps(Z, det);
+    W = _mm_mul_ps(W, det);
+
+    _mm_storeu_ps(dst, _mm_shuffle_ps(X, Y, GLM_SHUFFLE(3, 1, 3, 1)));
+    _mm_storeu_ps(dst + 4, _mm_shuffle_ps(X, Y, GLM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(dst + 8, _mm_shuffle_ps(Z, W, GLM_SHUFFLE(3, 1, 3, 1)));
+    _mm_storeu_ps(dst + 12, _mm_shuffle_ps(Z, W, GLM_SHUFFLE(2, 0, 2, 0)));
+    return 1;
+}
+
+static inline void glm_mat4_add_sse4(float *dst, const float *a, const float *b) {
+    int i;
+    for (i = 0; i < 16; i += 4) {
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+}
+
+static inline void glm_mat4_subtract_sse4(float *dst, const float *a, const float *b) {
+    int i;
+    for (i = 0; i < 16; i += 4) {
+        _mm_storeu_ps(dst + i, _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+}
+
+static inline void glm_mat4_multiplyScalar_sse4(float *dst, const float *a, float s) {
+    __m128 vs = _mm_set1_ps(s);
+    int i;
+    for (i = 0; i < 16; i += 4) {
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_loadu_ps(a + i), vs));
+    }
+}
+
+static inline void glm_mat4_multiplyScalarAndAdd_sse4(float *dst, const float *a, const float *b, float s) {
+    __m128 vs = _mm_set1_ps(s);
+    int i;
+    for (i = 0; i < 16; i += 4) {
+        _mm_storeu_ps(dst + i, glm_madd_ps(_mm_loadu_ps(b + i), vs, _mm_loadu_ps(a + i)));
+    }
+}
+
+static inline int glm_mat4_equals_sse4(const float *a, const float *b) {
+    __m128 e = _mm_and_ps(_mm_cmpeq_ps(_mm_loadu_ps(a), _mm_loadu_ps(b)),
+                          _mm_cmpeq_ps(_mm_loadu_ps(a + 4), _mm_loadu_ps(b + 4)));
+    e = _mm_and_ps(e, _mm_cmpeq_ps(_mm_loadu_ps(a + 8), _mm_loadu_ps(b + 8)));
+    e = _mm_and_ps(e, _mm_cmpeq_ps(_mm_loadu_ps(a + 12), _mm_loadu_ps(b + 12)));
+    return _mm_movemask_ps(e) == 0xf;
+}
+
+/* Deinterleaves four packed vec3's into x, y and z registers */
+static inline void glm_vec3_load4_sse4(const float *src, __m128 *x, __m128 *y, __m128 *z) {
+    __m128 v0 = _mm_loadu_ps(src);      // x0 y0 z0 x1
+    __m128 v1 = _mm_loadu_ps(src + 4);  // y1 z1 x2 y2
+    __m128 v2 = _mm_loadu_ps(src + 8);  // z2 x3 y3 z3
+    __m128 t0 = _mm_shuffle_ps(v1, v2, GLM_SHUFFLE(2, 2, 1, 1));
+    __m128 t1 = _mm_shuffle_ps(v0, v1, GLM_SHUFFLE(1, 1, 0, 0));
+    __m128 t2 = _mm_shuffle_ps(v1, v2, GLM_SHUFFLE(3, 3, 2, 2));
+    __m128 t3 = _mm_shuffle_ps(v0, v1, GLM_SHUFFLE(2, 2, 1, 1));
+    *x = _mm_shuffle_ps(v0, t0, GLM_SHUFFLE(0, 3, 0, 2));
+    *y = _mm_shuffle_ps(t1, t2, GLM_SHUFFLE(0, 2, 0, 2));
+    *z = _mm_shuffle_ps(t3, v2, GLM_SHUFFLE(0, 2, 0, 3));
+}
+
+/* Interleaves x, y and z registers back into four packed vec3's */
+static inline void glm_vec3_store4_sse4(float *dst, __m128 x, __m128 y, __m128 z) {
+    __m128 a0 = _mm_shuffle_ps(x, y, GLM_SHUFFLE(0, 0, 0, 0));
+    __m128 b0 = _mm_shuffle_ps(z, x, GLM_SHUFFLE(0, 0, 1, 1));
+    __m128 a1 = _mm_shuffle_ps(y, z, GLM_SHUFFLE(1, 1, 1, 1));
+    __m128 b1 = _mm_shuffle_ps(x, y, GLM_SHUFFLE(2, 2, 2, 2));
+    __m128 a2 = _mm_shuffle_ps(z, x, GLM_SHUFFLE(2, 2, 3, 3));
+    __m128 b2 = _mm_shuffle_ps(y, z, GLM_SHUFFLE(3, 3, 3, 3));
+    _mm_storeu_ps(dst, _mm_shuffle_ps(a0, b0, GLM_SHUFFLE(0, 2, 0, 2)));
+    _mm_storeu_ps(dst + 4, _mm_shuffle_ps(a1, b1, GLM_SHUFFLE(0, 2, 0, 2)));
+    _mm_storeu_ps(dst + 8, _mm_shuffle_ps(a2, b2, GLM_SHUFFLE(0, 2, 0, 2)));
+}
+
+/*
+ * Array kernels: transform the packed vec3's of src in groups of 4 and
+ * return how many were done, the caller finishes the remaining ones.
+ * dst may be the same array as src.
+ */
+static inline size_t glm_vec3_transformMat4_array_sse4(float *dst, const float *src, size_t count, const float *m) {
+    int affine = m[3] == 0 && m[7] == 0 && m[11] == 0 && m[15] == 1;
+    size_t i = 0;
+    __m128 c0 = _mm_set1_ps(m[0]), c1 = _mm_set1_ps(m[1]), c2 = _mm_set1_ps(m[2]), c3 = _mm_set1_ps(m[3]);
+    __m128 c4 = _mm_set1_ps(m[4]), c5 = _mm_set1_ps(m[5]), c6 = _mm_set1_ps(m[6]), c7 = _mm_set1_ps(m[7]);
+    __m128 c8 = _mm_set1_ps(m[8]), c9 = _mm_set1_ps(m[9]), c10 = _mm_set1_ps(m[10]), c11 = _mm_set1_ps(m[11]);
+    __m128 c12 = _mm_set1_ps(m[12]), c13 = _mm_set1_ps(m[13]), c14 = _mm_set1_ps(m[14]), c15 = _mm_set1_ps(m[15]);
+    __m128 one = _mm_set1_ps(1), zero = _mm_setzero_ps();
+    __m128 x, y, z, rx, ry, rz, w;
+
+    for (; i < (count & ~(size_t)3); i += 4) {
+        glm_vec3_load4_sse4(src + 3 * i, &x, &y, &z);
+        rx = _mm_add_ps(glm_madd_ps(c8, z, glm_madd_ps(c4, y, _mm_mul_ps(c0, x))), c12);
+        ry = _mm_add_ps(glm_madd_ps(c9, z, glm_madd_ps(c5, y, _mm_mul_ps(c1, x))), c13);
+        rz = _mm_add_ps(glm_madd_ps(c10, z, glm_madd_ps(c6, y, _mm_mul_ps(c2, x))), c14);
+        if (!affine) {
+            w = _mm_add_ps(glm_madd_ps(c11, z, glm_madd_ps(c7, y, _mm_mul_ps(c3, x))), c15);
+            w = _mm_blendv_ps(w, one, _mm_cmpeq_ps(w, zero));
+            rx = _mm_div_ps(rx, w);
+            ry = _mm_div_ps(ry, w);
+            rz = _mm_div_ps(rz, w);
+        }
+        glm_vec3_store4_sse4(dst + 3 * i, rx, ry, rz);
+    }
+
+    return i;
+}
+
+static inline size_t glm_vec3_transformMat3_array_sse4(float *dst, const float *src, size_t count, const float *m) {
+    size_t i = 0;
+    __m128 c0 = _mm_set1_ps(m[0]), c1 = _mm_set1_ps(m[1]), c2 = _mm_set1_ps(m[2]);
+    __m128 c3 = _mm_set1_ps(m[3]), c4 = _mm_set1_ps(m[4]), c5 = _mm_set1_ps(m[5]);
+    __m128 c6 = _mm_set1_ps(m[6]), c7 = _mm_set1_ps(m[7]), c8 = _mm_set1_ps(m[8]);
+    __m128 x, y, z;
+
+    for (; i < (count & ~(size_t)3); i += 4) {
+        glm_vec3_load4_sse4(src + 3 * i, &x, &y, &z);
+        glm_vec3_store4_sse4(dst + 3 * i,
+            glm_madd_ps(z, c6, glm_madd_ps(y, c3, _mm_mul_ps(x, c0))),
+            glm_madd_ps(z, c7, glm_madd_ps(y, c4, _mm_mul_ps(x, c1))),
+            glm_madd_ps(z, c8, glm_madd_ps(y, c5, _mm_mul_ps(x, c2))));
+    }
+
+    return i;
+}
+
+static inline size_t glm_vec3_transformQuat_array_sse4(float *dst, const float *src, size_t count, const float *q) {
+    size_t i = 0;
+    __m128 vqx = _mm_set1_ps(q[0]), vqy = _mm_set1_ps(q[1]), vqz = _mm_set1_ps(q[2]);
+    __m128 w2 = _mm_set1_ps(q[3] * 2), two = _mm_set1_ps(2);
+    __m128 x, y, z, uvx, uvy, uvz, uuvx, uuvy, uuvz;
+
+    for (; i < (count & ~(size_t)3); i += 4) {
+        glm_vec3_load4_sse4(src + 3 * i, &x, &y, &z);
+        uvx = _mm_sub_ps(_mm_mul_ps(vqy, z), _mm_mul_ps(vqz, y));
+        uvy = _mm_sub_ps(_mm_mul_ps(vqz, x), _mm_mul_ps(vqx, z));
+        uvz = _mm_sub_ps(_mm_mul_ps(vqx, y), _mm_mul_ps(vqy, x));
+        uuvx = _mm_sub_ps(_mm_mul_ps(vqy, uvz), _mm_mul_ps(vqz, uvy));
+        uuvy = _mm_sub_ps(_mm_mul_ps(vqz, uvx), _mm_mul_ps(vqx, uvz));
+        uuvz = _mm_sub_ps(_mm_mul_ps(vqx, uvy), _mm_mul_ps(vqy, uvx));
+        glm_vec3_store4_sse4(dst + 3 * i,
+            glm_madd_ps(uuvx, two, glm_madd_ps(uvx, w2, x)),
+            glm_madd_ps(uuvy, two, glm_madd_ps(uvy, w2, y)),
+            glm_madd_ps(uuvz, two, glm_madd_ps(uvz, w2, z)));
+    }
+
+    return i;
+}
+
+/* Transposes four packed quats into x, y, z and w registers */
+static inline void glm_quat_load4_sse4(const float *src, __m128 *x, __m128 *y, __m128 *z, __m128 *w) {
+    __m128 q0 = _mm_loadu_ps(src), q1 = _mm_loadu_ps(src + 4);
+    __m128 q2 = _mm_loadu_ps(src + 8), q3 = _mm_loadu_ps(src + 12);
+    _MM_TRANSPOSE4_PS(q0, q1, q2, q3);
+    *x = q0;
+    *y = q1;
+    *z = q2;
+    *w = q3;
+}
+
+static inline void glm_quat_store4_sse4(float *dst, __m128 x, __m128 y, __m128 z, __m128 w) {
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+    _mm_storeu_ps(dst, x);
+    _mm_storeu_ps(dst + 4, y);
+    _mm_storeu_ps(dst + 8, z);
+    _mm_storeu_ps(dst + 12, w);
+}
+
+/*
+ * Quat blend kernels: interpolate the packed quats of dst towards the
+ * ones of b in groups of 4 and return how many were done, the caller
+ * finishes the remaining ones.
+ */
+static inline size_t glm_quat_nlerp_array_sse4(float *dst, const float *b, size_t count, float t) {
+    size_t i = 0;
+    __m128 vt = _mm_set1_ps(t), vd = _mm_set1_ps(1 - t);
+    __m128 sign = _mm_set1_ps(-0.0f), tiny = _mm_set1_ps(FLT_MIN);
+    __m128 ax, ay, az, aw, bx, by, bz, bw, s1, len;
+
+    for (; i < (count & ~(size_t)3); i += 4) {
+        glm_quat_load4_sse4(dst + 4 * i, &ax, &ay, &az, &aw);
+        glm_quat_load4_sse4(b + 4 * i, &bx, &by, &bz, &bw);
+        // Take the shortest path by giving b the sign of the dot product
+        s1 = glm_madd_ps(aw, bw, glm_madd_ps(az, bz, glm_madd_ps(ay, by, _mm_mul_ps(ax, bx))));
+        s1 = _mm_xor_ps(vt, _mm_and_ps(s1, sign));
+        ax = glm_madd_ps(bx, s1, _mm_mul_ps(ax, vd));
+        ay = glm_madd_ps(by, s1, _mm_mul_ps(ay, vd));
+        az = glm_madd_ps(bz, s1, _mm_mul_ps(az, vd));
+        aw = glm_madd_ps(bw, s1, _mm_mul_ps(aw, vd));
+        len = glm_madd_ps(aw, aw, glm_madd_ps(az, az, glm_madd_ps(ay, ay, _mm_mul_ps(ax, ax))));
+        len = _mm_max_ps(_mm_sqrt_ps(len), tiny);
+        glm_quat_store4_sse4(dst + 4 * i, _mm_div_ps(ax, len), _mm_div_ps(ay, len), _mm_div_ps(az, len), _mm_div_ps(aw, len));
+    }
+
+    return i;
+}
+
+static inline size_t glm_quat_slerpFast_array_sse4(float *dst, const float *b, size_t count, float t) {
+    size_t i = 0;
+    int k;
+    float d = 1 - t;
+    __m128 cT[8], cD[8];
+    __m128 vt = _mm_set1_ps(t), vd = _mm_set1_ps(d), one = _mm_set1_ps(1), sign = _mm_set1_ps(-0.0f);
+    __m128 ax, ay, az, aw, bx, by, bz, bw, x, s, accT, accD;
+
+    for (k = 0; k < 8; k++) {
+        cT[k] = _mm_set1_ps(glm_slerp_u[k] * (t * t) - glm_slerp_v[k]);
+        cD[k] = _mm_set1_ps(glm_slerp_u[k] * (d * d) - glm_slerp_v[k]);
+    }
+
+    for (; i < (count & ~(size_t)3); i += 4) {
+        glm_quat_load4_sse4(dst + 4 * i, &ax, &ay, &az, &aw);
+        glm_quat_load4_sse4(b + 4 * i, &bx, &by, &bz, &bw);
+        x = glm_madd_ps(aw, bw, glm_madd_ps(az, bz, glm_madd_ps(ay, by, _mm_mul_ps(ax, bx))));
+        s = _mm_and_ps(x, sign);
+        x = _mm_sub_ps(_mm_xor_ps(x, s), one);
+        accT = one;
+        accD = one;
+        for (k = 8; k-- > 0;) {
+            accT = glm_madd_ps(_mm_mul_ps(cT[k], x), accT, one);
+            accD = glm_madd_ps(_mm_mul_ps(cD[k], x), accD, one);
+        }
+        accT = _mm_xor_ps(_mm_mul_ps(vt, accT), s);
+        accD = _mm_mul_ps(vd, accD);
+        glm_quat_store4_sse4(dst + 4 * i,
+            glm_madd_ps(bx, accT, _mm_mul_ps(ax, accD)),
+            glm_madd_ps(by, accT, _mm_mul_ps(ay, accD)),
+            glm_madd_ps(bz, accT, _mm_mul_ps(az, accD)),
+            glm_madd_ps(bw, accT, _mm_mul_ps(aw, accD)));
+    }
+
+    return i;
+}
+
+/* Stores the x, y and z lanes of v without touching the float after them */
+static inline void glm_vec3_store1_sse4(float *dst, __m128 v) {
+    _mm_storel_pi((__m64 *)dst, v);
+    _mm_store_ss(dst + 2, _mm_movehl_ps(v, v));
+}
+
+/* Renormalizes the x, y and z lanes of n and stores them, a zero vector stays zero */
+static inline void glm_vec3_storeNormalized1_sse4(float *dst, __m128 n) {
+    __m128 len = _mm_max_ps(_mm_sqrt_ps(_mm_dp_ps(n, n, 0x7f)), _mm_set1_ps(FLT_MIN));
+    glm_vec3_store1_sse4(dst, _mm_div_ps(n, len));
+}
+
+/*
+ * Linear blend skinning kernel of skin_linearBlend, blends the 4 palette
+ * matrices of every vertex and transforms its position and normal with
+ * them. nor and dstNor may be NULL. Returns count.
+ */
+static inline size_t glm_skin_linearBlend_sse4(float *dstPos, float *dstNor, const float *pos, const float *nor,
+        const uint16_t *joints, const float *weights, size_t count, const float *palette) {
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        const uint16_t *j = joints + 4 * i;
+        const float *m0 = palette + 16 * j[0], *m1 = palette + 16 * j[1];
+        const float *m2 = palette + 16 * j[2], *m3 = palette + 16 * j[3];
+        __m128 w = _mm_loadu_ps(weights + 4 * i);
+        __m128 w0 = GLM_SWIZZLE(w, 0, 0, 0, 0), w1 = GLM_SWIZZLE(w, 1, 1, 1, 1);
+        __m128 w2 = GLM_SWIZZLE(w, 2, 2, 2, 2), w3 = GLM_SWIZZLE(w, 3, 3, 3, 3);
+        __m128 c0, c1, c2, c3, x, y, z;
+
+        c0 = glm_madd_ps(w3, _mm_loadu_ps(m3), glm_madd_ps(w2, _mm_loadu_ps(m2), glm_madd_ps(w1, _mm_loadu_ps(m1), _mm_mul_ps(w0, _mm_loadu_ps(m0)))));
+        c1 = glm_madd_ps(w3, _mm_loadu_ps(m3 + 4), glm_madd_ps(w2, _mm_loadu_ps(m2 + 4), glm_madd_ps(w1, _mm_loadu_ps(m1 + 4), _mm_mul_ps(w0, _mm_loadu_ps(m0 + 4)))));
+        c2 = glm_madd_ps(w3, _mm_loadu_ps(m3 + 8), glm_madd_ps(w2, _mm_loadu_ps(m2 + 8), glm_madd_ps(w1, _mm_loadu_ps(m1 + 8), _mm_mul_ps(w0, _mm_loadu_ps(m0 + 8)))));
+        c3 = glm_madd_ps(w3, _mm_loadu_ps(m3 + 12), glm_madd_ps(w2, _mm_loadu_ps(m2 + 12), glm_madd_ps(w1, _mm_loadu_ps(m1 + 12), _mm_mul_ps(w0, _mm_loadu_ps(m0 + 12)))));
+
+        x = _mm_set1_ps(pos[3 * i]);
+        y = _mm_set1_ps(pos[3 * i + 1]);
+        z = _mm_set1_ps(pos[3 * i + 2]);
+        glm_vec3_store1_sse4(dstPos + 3 * i, glm_madd_ps(c2, z, glm_madd_ps(c1, y, glm_madd_ps(c0, x, c3))));
+        if (nor) {
+            x = _mm_set1_ps(nor[3 * i]);
+            y = _mm_set1_ps(nor[3 * i + 1]);
+            z = _mm_set1_ps(nor[3 * i + 2]);
+            glm_vec3_storeNormalized1_sse4(dstNor + 3 * i, glm_madd_ps(c2, z, glm_madd_ps(c1, y, _mm_mul_ps(c0, x))));
+        }
+    }
+
+    return i;
+}
+
+/*
+ * Blends the 4 dquats of a vertex, negating the ones in the other
+ * hemisphere than the first so the blend takes the shortest path
+ */
+static inline void glm_dquat_blend4_sse4(const float *palette, const uint16_t *j, const float *weights, __m128 *real, __m128 *dual) {
+    const float *q0 = palette + 8 * j[0], *q1 = palette + 8 * j[1];
+    const float *q2 = palette + 8 * j[2], *q3 = palette + 8 * j[3];
+    __m128 r0 = _mm_loadu_ps(q0), r1 = _mm_loadu_ps(q1), r2 = _mm_loadu_ps(q2), r3 = _mm_loadu_ps(q3);
+    __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 w0 = _mm_set1_ps(weights[0]);
+    __m128 w1 = _mm_xor_ps(_mm_set1_ps(weights[1]), _mm_and_ps(_mm_dp_ps(r0, r1, 0xff), sign));
+    __m128 w2 = _mm_xor_ps(_mm_set1_ps(weights[2]), _mm_and_ps(_mm_dp_ps(r0, r2, 0xff), sign));
+    __m128 w3 = _mm_xor_ps(_mm_set1_ps(weights[3]), _mm_and_ps(_mm_dp_ps(r0, r3, 0xff), sign));
+
+    *real = glm_madd_ps(w3, r3, glm_madd_ps(w2, r2, glm_madd_ps(w1, r1, _mm_mul_ps(w0, r0))));
+    *dual = glm_madd_ps(w3, _mm_loadu_ps(q3 + 4), glm_madd_ps(w2, _mm_loadu_ps(q2 + 4),
+        glm_madd_ps(w1, _mm_loadu_ps(q1 + 4), _mm_mul_ps(w0, _mm_loadu_ps(q0 + 4)))));
+}
+
+/*
+ * Dual quaternion skinning kernel of skin_dualQuat. The dquats of 4
+ * vertices are blended one vertex at a time, then transposed so the
+ * normalization and the transform run one vertex per lane. nor and
+ * dstNor may be NULL. Returns how many vertices were done, a multiple of 4.
+ */
+static inline size_t glm_skin_dualQuat_sse4(float *dstPos, float *dstNor, const float *pos, const float *nor,
+        const uint16_t *joints, const float *weights, size_t count, const float *palette) {
+    size_t i = 0;
+    __m128 one = _mm_set1_ps(1), two = _mm_set1_ps(2), tiny = _mm_set1_ps(FLT_MIN);
+    __m128 rx, ry, rz, rw, dx, dy, dz, dw, len, tx, ty, tz, x, y, z, ux, uy, uz;
+
+    for (; i < (count & ~(size_t)3); i += 4) {
+        glm_dquat_blend4_sse4(palette, joints + 4 * i, weights + 4 * i, &rx, &dx);
+        glm_dquat_blend4_sse4(palette, joints + 4 * i + 4, weights + 4 * i + 4, &ry, &dy);
+        glm_dquat_blend4_sse4(palette, joints + 4 * i + 8, weights + 4 * i + 8, &rz, &dz);
+        glm_dquat_blend4_sse4(palette, joints + 4 * i + 12, weights + 4 * i + 12, &rw, &dw);
+        _MM_TRANSPOSE4_PS(rx, ry, rz, rw);
+        _MM_TRANSPOSE4_PS(dx, dy, dz, dw);
+
+        // Scaling both parts by the same factor is enough: the part of the
+        // dual parallel to the real one does not change the translation
+        len = glm_madd_ps(rw, rw, glm_madd_ps(rz, rz, glm_madd_ps(ry, ry, _mm_mul_ps(rx, rx))));
+        len = _mm_div_ps(one, _mm_max_ps(_mm_sqrt_ps(len), tiny));
+        rx = _mm_mul_ps(rx, len);
+        ry = _mm_mul_ps(ry, len);
+        rz = _mm_mul_ps(rz, len);
+        rw = _mm_mul_ps(rw, len);
+        dx = _mm_mul_ps(dx, len);
+        dy = _mm_mul_ps(dy, len);
+        dz = _mm_mul_ps(dz, len);
+        dw = _mm_mul_ps(dw, len);
+
+        // t = 2 * vector part of dual * conjugate(real)
+        tx = _mm_mul_ps(two, _mm_sub_ps(glm_madd_ps(ry, dz, _mm_sub_ps(_mm_mul_ps(rw, dx), _mm_mul_ps(dw, rx))), _mm_mul_ps(rz, dy)));
+        ty = _mm_mul_ps(two, _mm_sub_ps(glm_madd_ps(rz, dx, _mm_sub_ps(_mm_mul_ps(rw, dy), _mm_mul_ps(dw, ry))), _mm_mul_ps(rx, dz)));
+        tz = _mm_mul_ps(two, _mm_sub_ps(glm_madd_ps(rx, dy, _mm_sub_ps(_mm_mul_ps(rw, dz), _mm_mul_ps(dw, rz))), _mm_mul_ps(ry, dx)));
+
+        // v + 2 * real.xyz x (real.xyz x v + real.w * v)
+        glm_vec3_load4_sse4(pos + 3 * i, &x, &y, &z);
+        ux = _mm_sub_ps(glm_madd_ps(ry, z, _mm_mul_ps(rw, x)), _mm_mul_ps(rz, y));
+        uy = _mm_sub_ps(glm_madd_ps(rz, x, _mm_mul_ps(rw, y)), _mm_mul_ps(rx, z));
+        uz = _mm_sub_ps(glm_madd_ps(rx, y, _mm_mul_ps(rw, z)), _mm_mul_ps(ry, x));
+        glm_vec3_store4_sse4(dstPos + 3 * i,
+            _mm_add_ps(glm_madd_ps(two, _mm_sub_ps(_mm_mul_ps(ry, uz), _mm_mul_ps(rz, uy)), x), tx),
+            _mm_add_ps(glm_madd_ps(two, _mm_sub_ps(_mm_mul_ps(rz, ux), _mm_mul_ps(rx, uz)), y), ty),
+            _mm_add_ps(glm_madd_ps(two, _mm_sub_ps(_mm_mul_ps(rx, uy), _mm_mul_ps(ry, ux)), z), tz));
+
+        if (nor) {
+            glm_vec3_load4_sse4(nor + 3 * i, &x, &y, &z);
+            ux = _mm_sub_ps(glm_madd_ps(ry, z, _mm_mul_ps(rw, x)), _mm_mul_ps(rz, y));
+            uy = _mm_sub_ps(glm_madd_ps(rz, x, _mm_mul_ps(rw, y)), _mm_mul_ps(rx, z));
+            uz = _mm_sub_ps(glm_madd_ps(rx, y, _mm_mul_ps(rw, z)), _mm_mul_ps(ry, x));
+            glm_vec3_store4_sse4(dstNor + 3 * i,
+                glm_madd_ps(two, _mm_sub_ps(_mm_mul_ps(ry, uz), _mm_mul_ps(rz, uy)), x),
+                glm_madd_ps(two, _mm_sub_ps(_mm_mul_ps(rz, ux), _mm_mul_ps(rx, uz)), y),
+                glm_madd_ps(two, _mm_sub_ps(_mm_mul_ps(rx, uy), _mm_mul_ps(ry, ux)), z));
+        }
+    }
+
+    return i;
+}
+
+/*
+ * Transformed box kernel of aabb_transformMat4_array (Arvo), one box per
+ * iteration with a matrix column per register: every column is scaled by
+ * the min and max of its axis and the smaller and larger products are
+ * added to the translation. Returns count.
+ */
+static inline size_t glm_aabb_transformMat4_array_sse4(float *dstMin, float *dstMax, const float *min, const float *max,
+        size_t count, const float *m) {
+    size_t i;
+    __m128 c, a, b, lo, hi;
+    int k;
+
+    for (i = 0; i < count; i++) {
+        const float *mi = m + 16 * i;
+        lo = hi = _mm_loadu_ps(mi + 12);
+        for (k = 0; k < 3; k++) {
+            c = _mm_loadu_ps(mi + 4 * k);
+            a = _mm_mul_ps(c, _mm_set1_ps(min[3 * i + k]));
+            b = _mm_mul_ps(c, _mm_set1_ps(max[3 * i + k]));
+            lo = _mm_add_ps(lo, _mm_min_ps(a, b));
+            hi = _mm_add_ps(hi, _mm_max_ps(a, b));
+        }
+        glm_vec3_store1_sse4(dstMin + 3 * i, lo);
+        glm_vec3_store1_sse4(dstMax + 3 * i, hi);
+    }
+
+    return i;
+}
+
+/*
+ * Fast normalize kernels of vec3_normalizeFast_array and
+ * vec4_normalizeFast_array, in groups of 4. Vectors with a squared length
+ * below FLT_MIN are copied as is. Return how many were done.
+ */
+static inline size_t glm_vec3_normalizeFast_array_sse4(float *dst, const float *src, size_t count) {
+    size_t i = 0;
+    __m128 one = _mm_set1_ps(1), tiny = _mm_set1_ps(FLT_MIN);
+    __m128 x, y, z, len;
+
+    for (; i < (count & ~(size_t)3); i += 4) {
+        glm_vec3_load4_sse4(src + 3 * i, &x, &y, &z);
+        len = glm_madd_ps(z, z, glm_madd_ps(y, y, _mm_mul_ps(x, x)));
+        len = _mm_blendv_ps(one, glm_rsqrt_ps(len), _mm_cmpge_ps(len, tiny));
+        glm_vec3_store4_sse4(dst + 3 * i, _mm_mul_ps(x, len), _mm_mul_ps(y, len), _mm_mul_ps(z, len));
+    }
+
+    return i;
+}
+
+static inline size_t glm_vec4_normalizeFast_array_sse4(float *dst, const float *src, size_t count) {
+    size_t i = 0;
+    __m128 one = _mm_set1_ps(1), tiny = _mm_set1_ps(FLT_MIN);
+    __m128 x, y, z, w, len;
+
+    for (; i < (count & ~(size_t)3); i += 4) {
+        glm_quat_load4_sse4(src + 4 * i, &x, &y, &z, &w);
+        len = glm_madd_ps(w, w, glm_madd_ps(z, z, glm_madd_ps(y, y, _mm_mul_ps(x, x))));
+        len = _mm_blendv_ps(one, glm_rsqrt_ps(len), _mm_cmpge_ps(len, tiny));
+        glm_quat_store4_sse4(dst + 4 * i, _mm_mul_ps(x, len), _mm_mul_ps(y, len), _mm_mul_ps(z, len), _mm_mul_ps(w, len));
+    }
+
+    return i;
+}
+
+/*
+ * quat_fromEuler_array kernel, 4 quats per iteration with glm_sincos_ps.
+ * Returns how many were done.
+ */
+static inline size_t glm_quat_fromEuler_array_sse4(float *dst, const float *euler, size_t count) {
+    size_t i = 0;
+    __m128 halfToRad = _mm_set1_ps(GLM_HALF_DEG_TO_RAD);
+    __m128 x, y, z, sx, cx, sy, cy, sz, cz, cycz, sysz, sycz, cysz;
+
+    for (; i < (count & ~(size_t)3); i += 4) {
+        glm_vec3_load4_sse4(euler + 3 * i, &x, &y, &z);
+        glm_sincos_ps(_mm_mul_ps(x, halfToRad), &sx, &cx);
+        glm_sincos_ps(_mm_mul_ps(y, halfToRad), &sy, &cy);
+        glm_sincos_ps(_mm_mul_ps(z, halfToRad), &sz, &cz);
+        cycz = _mm_mul_ps(cy, cz);
+        sysz = _mm_mul_ps(sy, sz);
+        sycz = _mm_mul_ps(sy, cz);
+        cysz = _mm_mul_ps(cy, sz);
+        glm_quat_store4_sse4(dst + 4 * i,
+            _mm_sub_ps(_mm_mul_ps(sx, cycz), _mm_mul_ps(cx, sysz)),
+            glm_madd_ps(cx, sycz, _mm_mul_ps(sx, cysz)),
+            _mm_sub_ps(_mm_mul_ps(cx, cysz), _mm_mul_ps(sx, sycz)),
+            glm_madd_ps(cx, cycz, _mm_mul_ps(sx, sysz)));
+    }
+
+    return i;
+}
+
+static inline void glm_upload_ps(float *dst, __m128 v, int stream) {
+    if (stream) {
+        _mm_stream_ps(dst, v);
+    } else {
+        _mm_storeu_ps(dst, v);
+    }
+}
+
+/*
+ * mat4_fromRotationTranslationScale_array kernel, 4 instances per
+ * iteration. e[4 * c + r] holds element (c, r) of the 4 matrices, one per
+ * lane; it is transposed back into 4 columns, or into the top 3 rows when
+ * rows is set. stream is a constant at each call site, so the compiler
+ * builds one loop per store kind.
+ */
+static inline size_t glm_mat4_fromRotationTranslationScale_loop_sse4(char *dst, size_t stride, const float *q,
+        const float *v, const float *s, size_t count, const float *parent, int rows, int stream) {
+    size_t i = 0, k;
+    __m128 one = _mm_set1_ps(1), zero = _mm_setzero_ps();
+    __m128 x, y, z, w, tx, ty, tz, sx, sy, sz, e[16], r[16], *m;
+
+    for (; i < (count & ~(size_t)3); i += 4) {
+        glm_quat_load4_sse4(q + 4 * i, &x, &y, &z, &w);
+        glm_vec3_load4_sse4(v + 3 * i, &tx, &ty, &tz);
+        glm_vec3_load4_sse4(s + 3 * i, &sx, &sy, &sz);
+        {
+            __m128 x2 = _mm_add_ps(x, x), y2 = _mm_add_ps(y, y), z2 = _mm_add_ps(z, z);
+            __m128 xx = _mm_mul_ps(x, x2), xy = _mm_mul_ps(x, y2), xz = _mm_mul_ps(x, z2);
+            __m128 yy = _mm_mul_ps(y, y2), yz = _mm_mul_ps(y, z2), zz = _mm_mul_ps(z, z2);
+            __m128 wx = _mm_mul_ps(w, x2), wy = _mm_mul_ps(w, y2), wz = _mm_mul_ps(w, z2);
+
+            e[0] = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(yy, zz)), sx);
+            e[1] = _mm_mul_ps(_mm_add_ps(xy, wz), sx);
+            e[2] = _mm_mul_ps(_mm_sub_ps(xz, wy), sx);
+            e[4] = _mm_mul_ps(_mm_sub_ps(xy, wz), sy);
+            e[5] = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, zz)), sy);
+            e[6] = _mm_mul_ps(_mm_add_ps(yz, wx), sy);
+            e[8] = _mm_mul_ps(_mm_add_ps(xz, wy), sz);
+            e[9] = _mm_mul_ps(_mm_sub_ps(yz, wx), sz);
+            e[10] = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, yy)), sz);
+            e[12] = tx;
+            e[13] = ty;
+            e[14] = tz;
+            e[3] = e[7] = e[11] = zero;
+            e[15] = one;
+        }
+
+        m = e;
+        if (parent) {
+            // parent * local, the last row of local is (0, 0, 0, 1)
+            for (k = 0; k < 4; k++) {
+                __m128 p0 = _mm_set1_ps(parent[k]), p1 = _mm_set1_ps(parent[4 + k]);
+                __m128 p2 = _mm_set1_ps(parent[8 + k]), p3 = _mm_set1_ps(parent[12 + k]);
+                r[k] = glm_madd_ps(p2, e[2], glm_madd_ps(p1, e[1], _mm_mul_ps(p0, e[0])));
+                r[4 + k] = glm_madd_ps(p2, e[6], glm_madd_ps(p1, e[5], _mm_mul_ps(p0, e[4])));
+                r[8 + k] = glm_madd_ps(p2, e[10], glm_madd_ps(p1, e[9], _mm_mul_ps(p0, e[8])));
+                r[12 + k] = _mm_add_ps(glm_madd_ps(p2, e[14], glm_madd_ps(p1, e[13], _mm_mul_ps(p0, e[12]))), p3);
+            }
+            m = r;
+        }
+
+        for (k = 0; k < (rows ? 3 : 4); k++) {
+            __m128 c0, c1, c2, c3;
+            if (rows) {
+                c0 = m[k], c1 = m[4 + k], c2 = m[8 + k], c3 = m[12 + k];
+            } else {
+                c0 = m[4 * k], c1 = m[4 * k + 1], c2 = m[4 * k + 2], c3 = m[4 * k + 3];
+            }
+            _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+            glm_upload_ps((float *)(dst + i * stride) + 4 * k, c0, stream);
+            glm_upload_ps((float *)(dst + (i + 1) * stride) + 4 * k, c1, stream);
+            glm_upload_ps((float *)(dst + (i + 2) * stride) + 4 * k, c2, stream);
+            glm_upload_ps((float *)(dst + (i + 3) * stride) + 4 * k, c3, stream);
+        }
+    }
+
+    return i;
+}
+
+/*
+ * Buffers spanning more bytes than this, about the size of an L2 cache,
+ * would not stay in the cache anyway and are written with non-temporal
+ * stores; smaller ones are cheaper to write through the cache.
+ */
+#ifndef GLM_STREAM_THRESHOLD
+#define GLM_STREAM_THRESHOLD (1 << 20)
+#endif
+
+/*
+ * Non-temporal stores need 16 byte aligned addresses; they are followed
+ * by an sfence so the caller's plain stores and a later GPU upload see
+ * them in order. Returns how many instances were done.
+ */
+static inline size_t glm_mat4_fromRotationTranslationScale_array_sse4(float *dst, size_t stride, const float *q,
+        const float *v, const float *s, size_t count, const float *parent, int rows) {
+    size_t i;
+
+    if ((((uintptr_t)dst | stride) & 15) == 0 && count > GLM_STREAM_THRESHOLD / stride) {
+        i = glm_mat4_fromRotationTranslationScale_loop_sse4((char *)dst, stride, q, v, s, count, parent, rows, 1);
+        _mm_sfence();
+    } else {
+        i = glm_mat4_fromRotationTranslationScale_loop_sse4((char *)dst, stride, q, v, s, count, parent, rows, 0);
+    }
+
+    return i;
+}
+
+#endif /* GLM_SSE4 */
+
+#if defined(GLM_AVX2)
+
+static inline void glm_mat4_multiply_avx2(float *dst, const float *a, const float *b) {
+    __m256 a0 = _mm256_broadcast_ps((const __m128 *)a);
+    __m256 a1 = _mm256_broadcast_ps((const __m128 *)(a + 4));
+    __m256 a2 = _mm256_broadcast_ps((const __m128 *)(a + 8));
+    __m256 a3 = _mm256_broadcast_ps((const __m128 *)(a + 12));
+    // Two columns of b per register, each lane broadcasting one of its elements
+    __m256 b01 = _mm256_loadu_ps(b);
+    __m256 b23 = _mm256_loadu_ps(b + 8);
+
+    __m256 r01 = _mm256_mul_ps(a0, _mm256_permute_ps(b01, 0x00));
+    __m256 r23 = _mm256_mul_ps(a0, _mm256_permute_ps(b23, 0x00));
+    r01 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b01, 0x55), r01);
+    r23 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b23, 0x55), r23);
+    r01 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b01, 0xaa), r01);
+    r23 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b23, 0xaa), r23);
+    r01 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b01, 0xff), r01);
+    r23 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b23, 0xff), r23);
+
+    _mm256_storeu_ps(dst, r01);
+    _mm256_storeu_ps(dst + 8, r23);
+}
+
+/* Affine version of glm_mat4_multiply_avx2, the w row of the result is forced to (0, 0, 0, 1) */
+static inline void glm_mat4_multiplyAffine_avx2(float *dst, const float *a, const float *b) {
+    __m256 zero = _mm256_setzero_ps();
+    __m256 a0 = _mm256_blend_ps(_mm256_broadcast_ps((const __m128 *)a), zero, 0x88);
+    __m256 a1 = _mm256_blend_ps(_mm256_broadcast_ps((const __m128 *)(a + 4)), zero, 0x88);
+    __m256 a2 = _mm256_blend_ps(_mm256_broadcast_ps((const __m128 *)(a + 8)), zero, 0x88);
+    // Translation in the upper half only, for column 3 of the result
+    __m256 a3 = _mm256_blend_ps(zero, _mm256_broadcast_ps((const __m128 *)(a + 12)), 0x70);
+    __m256 b01 = _mm256_loadu_ps(b);
+    __m256 b23 = _mm256_loadu_ps(b + 8);
+
+    __m256 r01 = _mm256_mul_ps(a0, _mm256_permute_ps(b01, 0x00));
+    __m256 r23 = _mm256_fmadd_ps(a0, _mm256_permute_ps(b23, 0x00), a3);
+    r01 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b01, 0x55), r01);
+    r23 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b23, 0x55), r23);
+    r01 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b01, 0xaa), r01);
+    r23 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b23, 0xaa), r23);
+
+    _mm256_storeu_ps(dst, r01);
+    _mm256_storeu_ps(dst + 8, _mm256_blend_ps(r23, _mm256_set_ps(1, 0, 0, 0, 0, 0, 0, 0), 0x80));
+}
+
+/* Two columns per register version of glm_mat4_scaleMultiply_sse4 */
+static inline void glm_mat4_scaleMultiply_avx2(float *dst, const float *a, const float *b) {
+    __m256 d = _mm256_setr_ps(a[0], a[5], a[10], 0, a[0], a[5], a[10], 0);
+    __m256 t = _mm256_broadcast_ps((const __m128 *)(a + 12));
+    __m256 b01 = _mm256_loadu_ps(b);
+    __m256 b23 = _mm256_loadu_ps(b + 8);
+
+    _mm256_storeu_ps(dst, _mm256_fmadd_ps(t, _mm256_permute_ps(b01, 0xff), _mm256_mul_ps(d, b01)));
+    _mm256_storeu_ps(dst + 8, _mm256_fmadd_ps(t, _mm256_permute_ps(b23, 0xff), _mm256_mul_ps(d, b23)));
+}
+
+static inline void glm_mat4_add_avx2(float *dst, const float *a, const float *b) {
+    __m256 r0 = _mm256_add_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b));
+    __m256 r1 = _mm256_add_ps(_mm256_loadu_ps(a + 8), _mm256_loadu_ps(b + 8));
+    _mm256_storeu_ps(dst, r0);
+    _mm256_storeu_ps(dst + 8, r1);
+}
+
+static inline void glm_mat4_subtract_avx2(float *dst, const float *a, const float *b) {
+    __m256 r0 = _mm256_sub_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b));
+    __m256 r1 = _mm256_sub_ps(_mm256_loadu_ps(a + 8), _mm256_loadu_ps(b + 8));
+    _mm256_storeu_ps(dst, r0);
+    _mm256_storeu_ps(dst + 8, r1);
+}
+
+static inline void glm_mat4_multiplyScalar_avx2(float *dst, const float *a, float s) {
+    __m256 vs = _mm256_set1_ps(s);
+    __m256 r0 = _mm256_mul_ps(_mm256_loadu_ps(a), vs);
+    __m256 r1 = _mm256_mul_ps(_mm256_loadu_ps(a + 8), vs);
+    _mm256_storeu_ps(dst, r0);
+    _mm256_storeu_ps(dst + 8, r1);
+}
+
+static inline void glm_mat4_multiplyScalarAndAdd_avx2(float *dst, const float *a, const float *b, float s) {
+    __m256 vs = _mm256_set1_ps(s);
+    __m256 r0 = _mm256_fmadd_ps(_mm256_loadu_ps(b), vs, _mm256_loadu_ps(a));
+    __m256 r1 = _mm256_fmadd_ps(_mm256_loadu_ps(b + 8), vs, _mm256_loadu_ps(a + 8));
+    _mm256_storeu_ps(dst, r0);
+    _mm256_storeu_ps(dst + 8, r1);
+}
+
+static inline __m256 glm_load2x4_ps(const float *lo, const float *hi) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)), _mm_loadu_ps(hi), 1);
+}
+
+/* Lanes 0-3 set to lo and lanes 4-7 to hi, without going through memory like _mm256_set_ps */
+static inline __m256 glm_set2x4_ps(float lo, float hi) {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(lo)), _mm_set1_ps(hi), 1);
+}
+
+static inline void glm_store2x4_ps(float *lo, float *hi, __m256 v) {
+    _mm_storeu_ps(lo, _mm256_castps256_ps128(v));
+    _mm_storeu_ps(hi, _mm256_extractf128_ps(v, 1));
+}
+
+/*
+ * Eight packed vec3's version of glm_vec3_load4_sse4. Lanes 0-3 hold
+ * points 0-3 and lanes 4-7 hold points 4-7.
+ */
+static inline void glm_vec3_load8_avx2(const float *src, __m256 *x, __m256 *y, __m256 *z) {
+    __m256 v0 = glm_load2x4_ps(src, src + 12);
+    __m256 v1 = glm_load2x4_ps(src + 4, src + 16);
+    __m256 v2 = glm_load2x4_ps(src + 8, src + 20);
+    __m256 t0 = _mm256_shuffle_ps(v1, v2, GLM_SHUFFLE(2, 2, 1, 1));
+    __m256 t1 = _mm256_shuffle_ps(v0, v1, GLM_SHUFFLE(1, 1, 0, 0));
+    __m256 t2 = _mm256_shuffle_ps(v1, v2, GLM_SHUFFLE(3, 3, 2, 2));
+    __m256 t3 = _mm256_shuffle_ps(v0, v1, GLM_SHUFFLE(2, 2, 1, 1));
+    *x = _mm256_shuffle_ps(v0, t0, GLM_SHUFFLE(0, 3, 0, 2));
+    *y = _mm256_shuffle_ps(t1, t2, GLM_SHUFFLE(0, 2, 0, 2));
+    *z = _mm256_shuffle_ps(t3, v2, GLM_SHUFFLE(0, 2, 0, 3));
+}
+
+static inline void glm_vec3_store8_avx2(float *dst, __m256 x, __m256 y, __m256 z) {
+    __m256 a0 = _mm256_shuffle_ps(x, y, GLM_SHUFFLE(0, 0, 0, 0));
+    __m256 b0 = _mm256_shuffle_ps(z, x, GLM_SHUFFLE(0, 0, 1, 1));
+    __m256 a1 = _mm256_shuffle_ps(y, z, GLM_SHUFFLE(1, 1, 1, 1));
+    __m256 b1 = _mm256_shuffle_ps(x, y, GLM_SHUFFLE(2, 2, 2, 2));
+    __m256 a2 = _mm256_shuffle_ps(z, x, GLM_SHUFFLE(2, 2, 3, 3));
+    __m256 b2 = _mm256_shuffle_ps(y, z, GLM_SHUFFLE(3, 3, 3, 3));
+    glm_store2x4_ps(dst, dst + 12, _mm256_shuffle_ps(a0, b0, GLM_SHUFFLE(0, 2, 0, 2)));
+    glm_store2x4_ps(dst + 4, dst + 16, _mm256_shuffle_ps(a1, b1, GLM_SHUFFLE(0, 2, 0, 2)));
+    glm_store2x4_ps(dst + 8, dst + 20, _mm256_shuffle_ps(a2, b2, GLM_SHUFFLE(0, 2, 0, 2)));
+}
+
+/*
+ * Eight at a time versions of the array kernels, groups of 4 left over
+ * are handed to the SSE4.1 kernels.
+ */
+static inline size_t glm_vec3_transformMat4_array_avx2(float *dst, const float *src, size_t count, const float *m) {
+    int affine = m[3] == 0 && m[7] == 0 && m[11] == 0 && m[15] == 1;
+    size_t i = 0;
+    __m256 c0 = _mm256_set1_ps(m[0]), c1 = _mm256_set1_ps(m[1]), c2 = _mm256_set1_ps(m[2]), c3 = _mm256_set1_ps(m[3]);
+    __m256 c4 = _mm256_set1_ps(m[4]), c5 = _mm256_set1_ps(m[5]), c6 = _mm256_set1_ps(m[6]), c7 = _mm256_set1_ps(m[7]);
+    __m256 c8 = _mm256_set1_ps(m[8]), c9 = _mm256_set1_ps(m[9]), c10 = _mm256_set1_ps(m[10]), c11 = _mm256_set1_ps(m[11]);
+    __m256 c12 = _mm256_set1_ps(m[12]), c13 = _mm256_set1_ps(m[13]), c14 = _mm256_set1_ps(m[14]), c15 = _mm256_set1_ps(m[15]);
+    __m256 one = _mm256_set1_ps(1), zero = _mm256_setzero_ps();
+    __m256 x, y, z, rx, ry, rz, w;
+
+    for (; i < (count & ~(size_t)7); i += 8) {
+        glm_vec3_load8_avx2(src + 3 * i, &x, &y, &z);
+        rx = _mm256_add_ps(_mm256_fmadd_ps(c8, z, _mm256_fmadd_ps(c4, y, _mm256_mul_ps(c0, x))), c12);
+        ry = _mm256_add_ps(_mm256_fmadd_ps(c9, z, _mm256_fmadd_ps(c5, y, _mm256_mul_ps(c1, x))), c13);
+        rz = _mm256_add_ps(_mm256_fmadd_ps(c10, z, _mm256_fmadd_ps(c6, y, _mm256_mul_ps(c2, x))), c14);
+        if (!affine) {
+            w = _mm256_add_ps(_mm256_fmadd_ps(c11, z, _mm256_fmadd_ps(c7, y, _mm256_mul_ps(c3, x))), c15);
+            w = _mm256_blendv_ps(w, one, _mm256_cmp_ps(w, zero, _CMP_EQ_OQ));
+            rx = _mm256_div_ps(rx, w);
+            ry = _mm256_div_ps(ry, w);
+            rz = _mm256_div_ps(rz, w);
+        }
+        glm_vec3_store8_avx2(dst + 3 * i, rx, ry, rz);
+    }
+
+    return i + glm_vec3_transformMat4_array_sse4(dst + 3 * i, src + 3 * i, count - i, m);
+}
+
+static inline size_t glm_vec3_transformMat3_array_avx2(float *dst, const float *src, size_t count, const float *m) {
+    size_t i = 0;
+    __m256 c0 = _mm256_set1_ps(m[0]), c1 = _mm256_set1_ps(m[1]), c2 = _mm256_set1_ps(m[2]);
+    __m256 c3 = _mm256_set1_ps(m[3]), c4 = _mm256_set1_ps(m[4]), c5 = _mm256_set1_ps(m[5]);
+    __m256 c6 = _mm256_set1_ps(m[6]), c7 = _mm256_set1_ps(m[7]), c8 = _mm256_set1_ps(m[8]);
+    __m256 x, y, z;
+
+    for (; i < (count & ~(size_t)7); i += 8) {
+        glm_vec3_load8_avx2(src + 3 * i, &x, &y, &z);
+        glm_vec3_store8_avx2(dst + 3 * i,
+            _mm256_fmadd_ps(z, c6, _mm256_fmadd_ps(y, c3, _mm256_mul_ps(x, c0))),
+            _mm256_fmadd_ps(z, c7, _mm256_fmadd_ps(y, c4, _mm256_mul_ps(x, c1))),
+            _mm256_fmadd_ps(z, c8, _mm256_fmadd_ps(y, c5, _mm256_mul_ps(x, c2))));
+    }
+
+    return i + glm_vec3_transformMat3_array_sse4(dst + 3 * i, src + 3 * i, count - i, m);
+}
+
+static inline size_t glm_vec3_transformQuat_array_avx2(float *dst, const float *src, size_t count, const float *q) {
+    size_t i = 0;
+    __m256 vqx = _mm256_set1_ps(q[0]), vqy = _mm256_set1_ps(q[1]), vqz = _mm256_set1_ps(q[2]);
+    __m256 w2 = _mm256_set1_ps(q[3] * 2), two = _mm256_set1_ps(2);
+    __m256 x, y, z, uvx, uvy, uvz, uuvx, uuvy, uuvz;
+
+    for (; i < (count & ~(size_t)7); i += 8) {
+        glm_vec3_load8_avx2(src + 3 * i, &x, &y, &z);
+        uvx = _mm256_fmsub_ps(vqy, z, _mm256_mul_ps(vqz, y));
+        uvy = _mm256_fmsub_ps(vqz, x, _mm256_mul_ps(vqx, z));
+        uvz = _mm256_fmsub_ps(vqx, y, _mm256_mul_ps(vqy, x));
+        uuvx = _mm256_fmsub_ps(vqy, uvz, _mm256_mul_ps(vqz, uvy));
+        uuvy = _mm256_fmsub_ps(vqz, uvx, _mm256_mul_ps(vqx, uvz));
+        uuvz = _mm256_fmsub_ps(vqx, uvy, _mm256_mul_ps(vqy, uvx));
+        glm_vec3_store8_avx2(dst + 3 * i,
+            _mm256_fmadd_ps(uuvx, two, _mm256_fmadd_ps(uvx, w2, x)),
+            _mm256_fmadd_ps(uuvy, two, _mm256_fmadd_ps(uvy, w2, y)),
+            _mm256_fmadd_ps(uuvz, two, _mm256_fmadd_ps(uvz, w2, z)));
+    }
+
+    return i + glm_vec3_transformQuat_array_sse4(dst + 3 * i, src + 3 * i, count - i, q);
+}
+
+/* In-lane 4x4 transpose, turns eight packed quats into x, y, z and w registers and back */
+static inline void glm_quat_transpose8_avx2(__m256 *r0, __m256 *r1, __m256 *r2, __m256 *r3) {
+    __m256 t0 = _mm256_unpacklo_ps(*r0, *r1);
+    __m256 t1 = _mm256_unpacklo_ps(*r2, *r3);
+    __m256 t2 = _mm256_unpackhi_ps(*r0, *r1);
+    __m256 t3 = _mm256_unpackhi_ps(*r2, *r3);
+    *r0 = _mm256_shuffle_ps(t0, t1, GLM_SHUFFLE(0, 1, 0, 1));
+    *r1 = _mm256_shuffle_ps(t0, t1, GLM_SHUFFLE(2, 3, 2, 3));
+    *r2 = _mm256_shuffle_ps(t2, t3, GLM_SHUFFLE(0, 1, 0, 1));
+    *r3 = _mm256_shuffle_ps(t2, t3, GLM_SHUFFLE(2, 3, 2, 3));
+}
+
+/* Lanes 0-3 hold quats 0-3 and lanes 4-7 hold quats 4-7 */
+static inline void glm_quat_load8_avx2(const float *src, __m256 *x, __m256 *y, __m256 *z, __m256 *w) {
+    *x = glm_load2x4_ps(src, src + 16);
+    *y = glm_load2x4_ps(src + 4, src + 20);
+    *z = glm_load2x4_ps(src + 8, src + 24);
+    *w = glm_load2x4_ps(src + 12, src + 28);
+    glm_quat_transpose8_avx2(x, y, z, w);
+}
+
+static inline void glm_quat_store8_avx2(float *dst, __m256 x, __m256 y, __m256 z, __m256 w) {
+    glm_quat_transpose8_avx2(&x, &y, &z, &w);
+    glm_store2x4_ps(dst, dst + 16, x);
+    glm_store2x4_ps(dst + 4, dst + 20, y);
+    glm_store2x4_ps(dst + 8, dst + 24, z);
+    glm_store2x4_ps(dst + 12, dst + 28, w);
+}
+
+static inline size_t glm_quat_nlerp_array_avx2(float *dst, const float *b, size_t count, float t) {
+    size_t i = 0;
+    __m256 vt = _mm256_set1_ps(t), vd = _mm256_set1_ps(1 - t);
+    __m256 sign = _mm256_set1_ps(-0.0f), tiny = _mm256_set1_ps(FLT_MIN);
+    __m256 ax, ay, az, aw, bx, by, bz, bw, s1, len;
+
+    for (; i < (count & ~(size_t)7); i += 8) {
+        glm_quat_load8_avx2(dst + 4 * i, &ax, &ay, &az, &aw);
+        glm_quat_load8_avx2(b + 4 * i, &bx, &by, &bz, &bw);
+        s1 = _mm256_fmadd_ps(aw, bw, _mm256_fmadd_ps(az, bz, _mm256_fmadd_ps(ay, by, _mm256_mul_ps(ax, bx))));
+        s1 = _mm256_xor_ps(vt, _mm256_and_ps(s1, sign));
+        ax = _mm256_fmadd_ps(bx, s1, _mm256_mul_ps(ax, vd));
+        ay = _mm256_fmadd_ps(by, s1, _mm256_mul_ps(ay, vd));
+        az = _mm256_fmadd_ps(bz, s1, _mm256_mul_ps(az, vd));
+        aw = _mm256_fmadd_ps(bw, s1, _mm256_mul_ps(aw, vd));
+        len = _mm256_fmadd_ps(aw, aw, _mm256_fmadd_ps(az, az, _mm256_fmadd_ps(ay, ay, _mm256_mul_ps(ax, ax))));
+        len = _mm256_max_ps(_mm256_sqrt_ps(len), tiny);
+        glm_quat_store8_avx2(dst + 4 * i, _mm256_div_ps(ax, len), _mm256_div_ps(ay, len), _mm256_div_ps(az, len), _mm256_div_ps(aw, len));
+    }
+
+    return i + glm_quat_nlerp_array_sse4(dst + 4 * i, b + 4 * i, count - i, t);
+}
+
+static inline size_t glm_quat_slerpFast_array_avx2(float *dst, const float *b, size_t count, float t) {
+    size_t i = 0;
+    int k;
+    float d = 1 - t;
+    __m256 cT[8], cD[8];
+    __m256 vt = _mm256_set1_ps(t), vd = _mm256_set1_ps(d), one = _mm256_set1_ps(1), sign = _mm256_set1_ps(-0.0f);
+    __m256 ax, ay, az, aw, bx, by, bz, bw, x, s, accT, accD;
+
+    for (k = 0; k < 8; k++) {
+        cT[k] = _mm256_set1_ps(glm_slerp_u[k] * (t * t) - glm_slerp_v[k]);
+        cD[k] = _mm256_set1_ps(glm_slerp_u[k] * (d * d) - glm_slerp_v[k]);
+    }
+
+    for (; i < (count & ~(size_t)7); i += 8) {
+        glm_quat_load8_avx2(dst + 4 * i, &ax, &ay, &az, &aw);
+        glm_quat_load8_avx2(b + 4 * i, &bx, &by, &bz, &bw);
+        x = _mm256_fmadd_ps(aw, bw, _mm256_fmadd_ps(az, bz, _mm256_fmadd_ps(ay, by, _mm256_mul_ps(ax, bx))));
+        s = _mm256_and_ps(x, sign);
+        x = _mm256_sub_ps(_mm256_xor_ps(x, s), one);
+        accT = one;
+        accD = one;
+        for (k = 8; k-- > 0;) {
+            accT = _mm256_fmadd_ps(_mm256_mul_ps(cT[k], x), accT, one);
+            accD = _mm256_fmadd_ps(_mm256_mul_ps(cD[k], x), accD, one);
+        }
+        accT = _mm256_xor_ps(_mm256_mul_ps(vt, accT), s);
+        accD = _mm256_mul_ps(vd, accD);
+        glm_quat_store8_avx2(dst + 4 * i,
+            _mm256_fmadd_ps(bx, accT, _mm256_mul_ps(ax, accD)),
+            _mm256_fmadd_ps(by, accT, _mm256_mul_ps(ay, accD)),
+            _mm256_fmadd_ps(bz, accT, _mm256_mul_ps(az, accD)),
+            _mm256_fmadd_ps(bw, accT, _mm256_mul_ps(aw, accD)));
+    }
+
+    return i + glm_quat_slerpFast_array_sse4(dst + 4 * i, b + 4 * i, count - i, t);
+}
+
+/*
+ * Holds two columns of the blended matrix per register: lanes 0-3 are
+ * column 0 or 2 and lanes 4-7 column 1 or 3.
+ */
+static inline size_t glm_skin_linearBlend_avx2(float *dstPos, float *dstNor, const float *pos, const float *nor,
+        const uint16_t *joints, const float *weights, size_t count, const float *palette) {
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        const uint16_t *j = joints + 4 * i;
+        const float *m0 = palette + 16 * j[0], *m1 = palette + 16 * j[1];
+        const float *m2 = palette + 16 * j[2], *m3 = palette + 16 * j[3];
+        __m256 w0 = _mm256_set1_ps(weights[4 * i]), w1 = _mm256_set1_ps(weights[4 * i + 1]);
+        __m256 w2 = _mm256_set1_ps(weights[4 * i + 2]), w3 = _mm256_set1_ps(weights[4 * i + 3]);
+        __m256 c01, c23, r;
+
+        c01 = _mm256_fmadd_ps(w3, _mm256_loadu_ps(m3), _mm256_fmadd_ps(w2, _mm256_loadu_ps(m2), _mm256_fmadd_ps(w1, _mm256_loadu_ps(m1), _mm256_mul_ps(w0, _mm256_loadu_ps(m0)))));
+        c23 = _mm256_fmadd_ps(w3, _mm256_loadu_ps(m3 + 8), _mm256_fmadd_ps(w2, _mm256_loadu_ps(m2 + 8), _mm256_fmadd_ps(w1, _mm256_loadu_ps(m1 + 8), _mm256_mul_ps(w0, _mm256_loadu_ps(m0 + 8)))));
+
+        // (x, y) * (column 0, column 1) + (z, 1) * (column 2, column 3)
+        r = _mm256_fmadd_ps(c23, glm_set2x4_ps(pos[3 * i + 2], 1), _mm256_mul_ps(c01, glm_set2x4_ps(pos[3 * i], pos[3 * i + 1])));
+        glm_vec3_store1_sse4(dstPos + 3 * i, _mm_add_ps(_mm256_castps256_ps128(r), _mm256_extractf128_ps(r, 1)));
+        if (nor) {
+            r = _mm256_mul_ps(c01, glm_set2x4_ps(nor[3 * i], nor[3 * i + 1]));
+            glm_vec3_storeNormalized1_sse4(dstNor + 3 * i, _mm_fmadd_ps(_mm256_castps256_ps128(c23), _mm_set1_ps(nor[3 * i + 2]),
+                _mm_add_ps(_mm256_castps256_ps128(r), _mm256_extractf128_ps(r, 1))));
+        }
+    }
+
+    return i;
+}
+
+/* Eight lane glm_rsqrt_ps */
+static inline __m256 glm_rsqrt8_ps(__m256 x) {
+    __m256 y = _mm256_rsqrt_ps(x);
+    __m256 h = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), x), y);
+    return _mm256_mul_ps(y, _mm256_fnmadd_ps(h, y, _mm256_set1_ps(1.5f)));
+}
+
+static inline size_t glm_vec3_normalizeFast_array_avx2(float *dst, const float *src, size_t count) {
+    size_t i = 0;
+    __m256 one = _mm256_set1_ps(1), tiny = _mm256_set1_ps(FLT_MIN);
+    __m256 x, y, z, len;
+
+    for (; i < (count & ~(size_t)7); i += 8) {
+        glm_vec3_load8_avx2(src + 3 * i, &x, &y, &z);
+        len = _mm256_fmadd_ps(z, z, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x)));
+        len = _mm256_blendv_ps(one, glm_rsqrt8_ps(len), _mm256_cmp_ps(len, tiny, _CMP_GE_OQ));
+        glm_vec3_store8_avx2(dst + 3 * i, _mm256_mul_ps(x, len), _mm256_mul_ps(y, len), _mm256_mul_ps(z, len));
+    }
+
+    return i + glm_vec3_normalizeFast_array_sse4(dst + 3 * i, src + 3 * i, count - i);
+}
+
+static inline size_t glm_vec4_normalizeFast_array_avx2(float *dst, const float *src, size_t count) {
+    size_t i = 0;
+    __m256 one = _mm256_set1_ps(1), tiny = _mm256_set1_ps(FLT_MIN);
+    __m256 x, y, z, w, len;
+
+    for (; i < (count & ~(size_t)7); i += 8) {
+        glm_quat_load8_avx2(src + 4 * i, &x, &y, &z, &w);
+        len = _mm256_fmadd_ps(w, w, _mm256_fmadd_ps(z, z, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x))));
+        len = _mm256_blendv_ps(one, glm_rsqrt8_ps(len), _mm256_cmp_ps(len, tiny, _CMP_GE_OQ));
+        glm_quat_store8_avx2(dst + 4 * i, _mm256_mul_ps(x, len), _mm256_mul_ps(y, len), _mm256_mul_ps(z, len), _mm256_mul_ps(w, len));
+    }
+
+    return i + glm_vec4_normalizeFast_array_sse4(dst + 4 * i, src + 4 * i, count - i);
+}
+
+/* Eight lane glm_sincos */
+static inline void glm_sincos8_ps(__m256 x, __m256 *s, __m256 *c) {
+    __m256 j = _mm256_floor_ps(_mm256_fmadd_ps(x, _mm256_set1_ps(GLM_2_OVER_PI), _mm256_set1_ps(0.5f)));
+    __m256i q = _mm256_cvttps_epi32(j);
+    __m256 y = _mm256_fnmadd_ps(j, _mm256_set1_ps(GLM_PIO2_1), x);
+    y = _mm256_fnmadd_ps(j, _mm256_set1_ps(GLM_PIO2_2), y);
+    y = _mm256_fnmadd_ps(j, _mm256_set1_ps(GLM_PIO2_3), y);
+    __m256 z = _mm256_mul_ps(y, y);
+    __m256 sp = _mm256_fmadd_ps(z, _mm256_set1_ps(GLM_SIN_C3), _mm256_set1_ps(GLM_SIN_C2));
+    sp = _mm256_fmadd_ps(z, sp, _mm256_set1_ps(GLM_SIN_C1));
+    sp = _mm256_fmadd_ps(_mm256_mul_ps(y, z), sp, y);
+    __m256 cp = _mm256_fmadd_ps(z, _mm256_set1_ps(GLM_COS_C3), _mm256_set1_ps(GLM_COS_C2));
+    cp = _mm256_fmadd_ps(z, cp, _mm256_set1_ps(GLM_COS_C1));
+    cp = _mm256_fmadd_ps(_mm256_mul_ps(z, z), cp, _mm256_fmadd_ps(z, _mm256_set1_ps(-0.5f), _mm256_set1_ps(1)));
+
+    __m256i one = _mm256_set1_epi32(1), two = _mm256_set1_epi32(2);
+    __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, one), one));
+    __m256 ssign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, two), 30));
+    __m256 csign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, one), two), 30));
+    *s = _mm256_xor_ps(_mm256_blendv_ps(sp, cp, swap), ssign);
+    *c = _mm256_xor_ps(_mm256_blendv_ps(cp, sp, swap), csign);
+}
+
+static inline size_t glm_quat_fromEuler_array_avx2(float *dst, const float *euler, size_t count) {
+    size_t i = 0;
+    __m256 halfToRad = _mm256_set1_ps(GLM_HALF_DEG_TO_RAD);
+    __m256 x, y, z, sx, cx, sy, cy, sz, cz, cycz, sysz, sycz, cysz;
+
+    for (; i < (count & ~(size_t)7); i += 8) {
+        glm_vec3_load8_avx2(euler + 3 * i, &x, &y, &z);
+        glm_sincos8_ps(_mm256_mul_ps(x, halfToRad), &sx, &cx);
+        glm_sincos8_ps(_mm256_mul_ps(y, halfToRad), &sy, &cy);
+        glm_sincos8_ps(_mm256_mul_ps(z, halfToRad), &sz, &cz);
+        cycz = _mm256_mul_ps(cy, cz);
+        sysz = _mm256_mul_ps(sy, sz);
+        sycz = _mm256_mul_ps(sy, cz);
+        cysz = _mm256_mul_ps(cy, sz);
+        glm_quat_store8_avx2(dst + 4 * i,
+            _mm256_fmsub_ps(sx, cycz, _mm256_mul_ps(cx, sysz)),
+            _mm256_fmadd_ps(cx, sycz, _mm256_mul_ps(sx, cysz)),
+            _mm256_fmsub_ps(cx, cysz, _mm256_mul_ps(sx, sycz)),
+            _mm256_fmadd_ps(cx, cycz, _mm256_mul_ps(sx, sysz)));
+    }
+
+    return i + glm_quat_fromEuler_array_sse4(dst + 4 * i, euler + 3 * i, count - i);
+}
+
+#endif /* GLM_AVX2 */
+
+
+/*
+ * Native width float vector for the structure-of-arrays kernels:
+ * 8 lanes with AVX2, 4 lanes with SSE4.1. Loads and stores are aligned.
+ */
+#if defined(GLM_AVX2)
+#define GLM_VF_WIDTH 8
+typedef __m256 glm_vf;
+#define glm_vf_load _mm256_load_ps
+#define glm_vf_loadu _mm256_loadu_ps
+#define glm_vf_store _mm256_store_ps
+#define glm_vf_storeu _mm256_storeu_ps
+#define glm_vf_set1 _mm256_set1_ps
+#define glm_vf_zero _mm256_setzero_ps
+#define glm_vf_add _mm256_add_ps
+#define glm_vf_sub _mm256_sub_ps
+#define glm_vf_mul _mm256_mul_ps
+#define glm_vf_div _mm256_div_ps
+#define glm_vf_sqrt _mm256_sqrt_ps
+#define glm_vf_min _mm256_min_ps
+#define glm_vf_max _mm256_max_ps
+#define glm_vf_and _mm256_and_ps
+#define glm_vf_or _mm256_or_ps
+#define glm_vf_madd _mm256_fmadd_ps
+#define glm_vf_blend _mm256_blendv_ps
+#define glm_vf_cmpeq(a, b) _mm256_cmp_ps((a), (b), _CMP_EQ_OQ)
+#define glm_vf_cmpgt(a, b) _mm256_cmp_ps((a), (b), _CMP_GT_OQ)
+#define glm_vf_cmpge(a, b) _mm256_cmp_ps((a), (b), _CMP_GE_OQ)
+#define glm_vf_cmplt(a, b) _mm256_cmp_ps((a), (b), _CMP_LT_OQ)
+#define glm_vf_movemask _mm256_movemask_ps
+#define glm_vf_rsqrt glm_rsqrt8_ps
+#elif defined(GLM_SSE4)
+#define GLM_VF_WIDTH 4
+typedef __m128 glm_vf;
+#define glm_vf_load _mm_load_ps
+#define glm_vf_loadu _mm_loadu_ps
+#define glm_vf_store _mm_store_ps
+#define glm_vf_storeu _mm_storeu_ps
+#define glm_vf_set1 _mm_set1_ps
+#define glm_vf_zero _mm_setzero_ps
+#define glm_vf_add _mm_add_ps
+#define glm_vf_sub _mm_sub_ps
+#define glm_vf_mul _mm_mul_ps
+#define glm_vf_div _mm_div_ps
+#define glm_vf_sqrt _mm_sqrt_ps
+#define glm_vf_min _mm_min_ps
+#define glm_vf_max _mm_max_ps
+#define glm_vf_and _mm_and_ps
+#define glm_vf_or _mm_or_ps
+#define glm_vf_madd glm_madd_ps
+#define glm_vf_blend _mm_blendv_ps
+#define glm_vf_cmpeq _mm_cmpeq_ps
+#define glm_vf_cmpgt _mm_cmpgt_ps
+#define glm_vf_cmpge _mm_cmpge_ps
+#define glm_vf_cmplt _mm_cmplt_ps
+#define glm_vf_movemask _mm_movemask_ps
+#define glm_vf_rsqrt glm_rsqrt_ps
+#endif
+
+/*
+ * Scalar reciprocal square root of the Fast normalizations, x >= FLT_MIN.
+ * glm_rsqrt_ps with SSE4/AVX2, the exact 1 / sqrtf(x) otherwise.
+ */
+static inline float glm_rsqrt(float x) {
+#if defined(GLM_SSE4)
+    return _mm_cvtss_f32(glm_rsqrt_ps(_mm_set_ss(x)));
+#else
+    return 1 / sqrtf(x);
+#endif
+}
+
+/*
+ * Reciprocal length used by the regular normalizations (vec2/vec3/vec4
+ * normalize, vec3soa_normalize, mat4_lookAt and mat4_targetTo). Defining
+ * GLM_FAST_RSQRT (GL_MATRIX_FAST_RSQRT) switches all of them to glm_rsqrt;
+ * then squared lengths up to GLM_NORMALIZE_MIN are treated like zero.
+ */
+#if defined(GLM_FAST_RSQRT)
+#define GLM_NORMALIZE_MIN FLT_MIN
+#define glm_normalize_rsqrt(x) glm_rsqrt(x)
+#else
+#define GLM_NORMALIZE_MIN 0
+#define glm_normalize_rsqrt(x) (1 / sqrtf(x))
+#endif
+
+/*
+ * sin and cos of the rotation builders (mat2/mat3/mat4 rotate and
+ * fromRotation, quat_setAxisAngle, quat_rotateX/Y/Z, quat_fromEuler).
+ * Defining GLM_FAST_TRIG (GL_MATRIX_FAST_TRIG) switches them from libm
+ * to glm_sincos.
+ */
+#if defined(GLM_FAST_TRIG)
+#define glm_rotation_sincos(x, s, c) glm_sincos((x), (s), (c))
+#else
+#define glm_rotation_sincos(x, s, c) (*(s) = sinf(x), *(c) = cosf(x))
+#endif
+
+/*
+ * Runtime dispatch table. src/dispatch/sse4.c and src/dispatch/avx2.c
+ * compile the kernels above with the matching target flags and fill in
+ * their entries, src/dispatch.c picks the level at load time. A NULL entry
+ * means the caller runs its scalar code.
+ */
+#if defined(GLM_DISPATCH)
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    void (*mat4_transpose)(float *dst, const float *src);
+    int (*mat4_invert)(float *dst, const float *src);
+    void (*mat4_multiply)(float *dst, const float *a, const float *b);
+    void (*mat4_multiplyAffine)(float *dst, const float *a, const float *b);
+    void (*mat4_scaleMultiply)(float *dst, const float *a, const float *b);
+    void (*mat4_multiplyScale)(float *dst, const float *a, const float *b);
+    size_t (*vec3_transformMat4_array)(float *dst, const float *src, size_t count, const float *m);
+    size_t (*vec3_transformMat3_array)(float *dst, const float *src, size_t count, const float *m);
+    size_t (*vec3_transformQuat_array)(float *dst, const float *src, size_t count, const float *q);
+    size_t (*quat_nlerp_array)(float *dst, const float *b, size_t count, float t);
+    size_t (*quat_slerpFast_array)(float *dst, const float *b, size_t count, float t);
+    size_t (*skin_linearBlend)(float *dstPos, float *dstNor, const float *pos, const float *nor,
+        const uint16_t *joints, const float *weights, size_t count, const float *palette);
+    size_t (*skin_dualQuat)(float *dstPos, float *dstNor, const float *pos, const float *nor,
+        const uint16_t *joints, const float *weights, size_t count, const float *palette);
+    size_t (*aabb_transformMat4_array)(float *dstMin, float *dstMax, const float *min, const float *max,
+        size_t count, const float *m);
+    size_t (*vec3_normalizeFast_array)(float *dst, const float *src, size_t count);
+    size_t (*vec4_normalizeFast_array)(float *dst, const float *src, size_t count);
+    size_t (*quat_fromEuler_array)(float *dst, const float *euler, size_t count);
+    size_t (*mat4_fromRotationTranslationScale_array)(float *dst, size_t stride, const float *q,
+        const float *v, const float *s, size_t count, const float *parent, int rows);
+} glm_dispatch_table;
+
+extern glm_dispatch_table glm_dispatch;
+
+void glm_dispatch_fill_sse4(glm_dispatch_table *table);
+void glm_dispatch_fill_avx2(glm_dispatch_table *table);
+
+/* Runs the dispatched kernel and returns from the calling function if there is one */
+#define GLM_DISPATCH_RETURN(fn, ...) \
+    do { \
+        if (glm_dispatch.fn) { \
+            glm_dispatch.fn(__VA_ARGS__); \
+            return; \
+        } \
+    } while (0)
+#else
+#define GLM_DISPATCH_RETURN(fn, ...) do { } while (0)
+#endif
+
+#endif
@@ -0,0 +1,104 @@
+#include "skin.h"
+#include "dquat.h"
+#include "vec3.h"
+#include "simd.h"
+#include <math.h>
+
+GLM_API void skin_linearBlend(vec3 *dstPositions, vec3 *dstNormals, vec3 *positions, vec3 *normals, uint16_t *joints, vec4 *weights, size_t count, mat4 *palette) {
+    // Normals are skipped unless both arrays are given
+    float *dstNor = normals ? (float *)dstNormals : NULL;
+    float *nor = dstNor ? (float *)normals : NULL;
+    size_t i = 0;
+
+#if defined(GLM_AVX2)
+    i = glm_skin_linearBlend_avx2(dstPositions[0], dstNor, positions[0], nor, joints, weights[0], count, palette[0]);
+#elif defined(GLM_SSE4)
+    i = glm_skin_linearBlend_sse4(dstPositions[0], dstNor, positions[0], nor, joints, weights[0], count, palette[0]);
+#elif defined(GLM_DISPATCH)
+    if (glm_dispatch.skin_linearBlend) {
+        i = glm_dispatch.skin_linearBlend(dstPositions[0], dstNor, positions[0], nor, joints, weights[0], count, palette[0]);
+    }
+#endif
+
+    for (; i < count; i++) {
+        uint16_t *j = joints + SKIN_INFLUENCES * i;
+        float *m0 = palette[j[0]], *m1 = palette[j[1]], *m2 = palette[j[2]], *m3 = palette[j[3]];
+        float w0 = weights[i][0], w1 = weights[i][1], w2 = weights[i][2], w3 = weights[i][3];
+        float m[16], x, y, z, len;
+        int k;
+
+        for (k = 0; k < 16; k++) {
+            m[k] = w0 * m0[k] + w1 * m1[k] + w2 * m2[k] + w3 * m3[k];
+        }
+
+        x = positions[i][0];
+        y = positions[i][1];
+        z = positions[i][2];
+        dstPositions[i][0] = m[0] * x + m[4] * y + m[8] * z + m[12];
+        dstPositions[i][1] = m[1] * x + m[5] * y + m[9] * z + m[13];
+        dstPositions[i][2] = m[2] * x + m[6] * y + m[10] * z + m[14];
+
+        if (nor) {
+            x = m[0] * normals[i][0] + m[4] * normals[i][1] + m[8] * normals[i][2];
+            y = m[1] * normals[i][0] + m[5] * normals[i][1] + m[9] * normals[i][2];
+            z = m[2] * normals[i][0] + m[6] * normals[i][1] + m[10] * normals[i][2];
+            len = x*x + y*y + z*z;
+            if (len > 0) {
+                len = 1 / sqrtf(len);
+            }
+            dstNormals[i][0] = x * len;
+            dstNormals[i][1] = y * len;
+            dstNormals[i][2] = z * len;
+        }
+    }
+}
+
+GLM_API void skin_dualQuat(vec3 *dstPositions, vec3 *dstNormals, vec3 *positions, vec3 *normals, uint16_t *joints, vec4 *weights, size_t count, dquat *palette) {
+    float *dstNor = normals ? (float *)dstNormals : NULL;
+    float *nor = dstNor ? (float *)normals : NULL;
+    size_t i = 0;
+
+#if defined(GLM_SSE4)
+    i = glm_skin_dualQuat_sse4(dstPositions[0], dstNor, positions[0], nor, joints, weights[0], count, palette[0]);
+#elif defined(GLM_DISPATCH)
+    if (glm_dispatch.skin_dualQuat) {
+        i = glm_dispatch.skin_dualQuat(dstPositions[0], dstNor, positions[0], nor, joints, weights[0], count, palette[0]);
+    }
+#endif
+
+    for (; i < count; i++) {
+        uint16_t *j = joints + SKIN_INFLUENCES * i;
+        float *first = palette[j[0]];
+        dquat b = { 0, 0, 0, 0, 0, 0, 0, 0 };
+        float len;
+        int k, e;
+
+        // dquat_blend without copying the palette entries
+        for (k = 0; k < SKIN_INFLUENCES; k++) {
+            float *q = palette[j[k]];
+            float w = weights[i][k];
+            if (first[0] * q[0] + first[1] * q[1] + first[2] * q[2] + first[3] * q[3] < 0) {
+                w = -w;
+            }
+            for (e = 0; e < 8; e++) {
+                b[e] += w * q[e];
+            }
+        }
+        // Scaling both parts by the same factor is enough: the part of the
+        // dual parallel to the real one does not change the translation
+        len = b[0] * b[0] + b[1] * b[1] + b[2] * b[2] + b[3] * b[3];
+        if (len > 0) {
+            len = 1 / sqrtf(len);
+        }
+        for (e = 0; e < 8; e++) {
+            b[e] *= len;
+        }
+
+        vec3_copy(dstPositions[i], positions[i]);
+        vec3_transformDquat(dstPositions[i], b);
+        if (nor) {
+            vec3_copy(dstNormals[i], normals[i]);
+            vec3_transformQuat(dstNormals[i], b);
+        }
+    }
+}
@@ -0,0 +1,376 @@
+#include "tmat4.h"
+#include "mat4.h"
+#include "vec3.h"
+#include "simd.h"
+
+// dst = a * b for a scale and translation a, dst may alias a or b
+static inline void glm_tmat4_scaleMultiply(float *dst, float *a, float *b) {
+#if defined(GLM_AVX2)
+    glm_mat4_scaleMultiply_avx2(dst, a, b);
+#elif defined(GLM_SSE4)
+    glm_mat4_scaleMultiply_sse4(dst, a, b);
+#else
+    GLM_DISPATCH_RETURN(mat4_scaleMultiply, dst, a, b);
+    float d0 = a[0], d1 = a[5], d2 = a[10];
+    float t0 = a[12], t1 = a[13], t2 = a[14];
+    int c;
+
+    for (c = 0; c < 16; c += 4) {
+        float b0 = b[c], b1 = b[c + 1], b2 = b[c + 2], b3 = b[c + 3];
+        dst[c] = d0 * b0 + t0 * b3;
+        dst[c + 1] = d1 * b1 + t1 * b3;
+        dst[c + 2] = d2 * b2 + t2 * b3;
+        dst[c + 3] = b3;
+    }
+#endif
+}
+
+// dst = a * b for a scale and translation b, dst may alias a or b
+static inline void glm_tmat4_multiplyScale(float *dst, float *a, float *b) {
+#if defined(GLM_SSE4)
+    glm_mat4_multiplyScale_sse4(dst, a, b);
+#else
+    GLM_DISPATCH_RETURN(mat4_multiplyScale, dst, a, b);
+    float s0 = b[0], s1 = b[5], s2 = b[10];
+    float x = b[12], y = b[13], z = b[14];
+    int r;
+
+    for (r = 0; r < 4; r++) {
+        float a0 = a[r], a1 = a[r + 4], a2 = a[r + 8], a3 = a[r + 12];
+        dst[r] = a0 * s0;
+        dst[r + 4] = a1 * s1;
+        dst[r + 8] = a2 * s2;
+        dst[r + 12] = a0 * x + a1 * y + a2 * z + a3;
+    }
+#endif
+}
+
+/*
+ * a = a * b for a projection a with a diagonal upper 3x3: row i of the
+ * result is a_ii * row i of b + a_i3 * row 3 of b. The SIMD mat4_multiply
+ * is as fast, so it is only used by the scalar builds.
+ */
+static inline void glm_tmat4_projectionMultiply(float *a, float *b) {
+#if defined(GLM_SSE4)
+    mat4_multiply(a, b);
+#else
+#if defined(GLM_DISPATCH)
+    if (glm_dispatch.mat4_multiply) {
+        mat4_multiply(a, b);
+        return;
+    }
+#endif
+    float d0 = a[0], d1 = a[5], d2 = a[10];
+    float t0 = a[12], t1 = a[13], t2 = a[14];
+    float p0 = a[3], p1 = a[7], p2 = a[11], p3 = a[15];
+    int c;
+
+    for (c = 0; c < 16; c += 4) {
+        float b0 = b[c], b1 = b[c + 1], b2 = b[c + 2], b3 = b[c + 3];
+        a[c] = d0 * b0 + t0 * b3;
+        a[c + 1] = d1 * b1 + t1 * b3;
+        a[c + 2] = d2 * b2 + t2 * b3;
+        a[c + 3] = p0 * b0 + p1 * b1 + p2 * b2 + p3 * b3;
+    }
+#endif
+}
+
+/**
+ * Set a tmat4 to the identity matrix
+ *
+ * @param {tmat4} out the receiving matrix
+ */
+GLM_API void tmat4_identity(tmat4 *dst) {
+    mat4_identity(dst->m);
+    dst->kind = TMAT4_TRANSLATION;
+}
+
+/**
+ * Copies a mat4 into a tmat4 and finds its kind. The last row and the
+ * zeros of a diagonal are checked exactly, orthonormality within EPSILON
+ * like mat4_classify.
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {mat4} m the matrix to copy
+ */
+GLM_API void tmat4_fromMat4(tmat4 *dst, mat4 m) {
+    int kind = TMAT4_GENERAL;
+
+    mat4_copy(dst->m, m);
+    switch (mat4_classify(dst->m)) {
+    case MAT4_IDENTITY:
+    case MAT4_TRANSLATION:
+        kind = TMAT4_TRANSLATION;
+        break;
+    case MAT4_RIGID:
+        kind = TMAT4_RIGID;
+        break;
+    case MAT4_AFFINE:
+        kind = TMAT4_AFFINE;
+        break;
+    default:
+        break;
+    }
+    if (m[1] == 0 && m[2] == 0 && m[4] == 0 && m[6] == 0 && m[8] == 0 && m[9] == 0) {
+        kind |= TMAT4_DIAGONAL;
+    }
+    dst->kind = kind;
+}
+
+/**
+ * Creates a tmat4 from a vector translation, see mat4_fromTranslation
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {vec3} v Translation vector
+ */
+GLM_API void tmat4_fromTranslation(tmat4 *dst, vec3 v) {
+    mat4_fromTranslation(dst->m, v);
+    dst->kind = TMAT4_TRANSLATION;
+}
+
+/**
+ * Creates a tmat4 from a vector scaling, see mat4_fromScaling
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {vec3} v Scaling vector
+ */
+GLM_API void tmat4_fromScaling(tmat4 *dst, vec3 v) {
+    mat4_fromScaling(dst->m, v);
+    dst->kind = TMAT4_SCALE;
+}
+
+/**
+ * Creates a tmat4 from a unit quaternion rotation, see mat4_fromQuat
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {quat} q Rotation quaternion
+ */
+GLM_API void tmat4_fromQuat(tmat4 *dst, quat q) {
+    mat4_fromQuat(dst->m, q);
+    dst->kind = TMAT4_RIGID;
+}
+
+/**
+ * Creates a tmat4 from a unit quaternion rotation and vector translation,
+ * see mat4_fromRotationTranslation
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {quat} q Rotation quaternion
+ * @param {vec3} v Translation vector
+ */
+GLM_API void tmat4_fromRotationTranslation(tmat4 *dst, quat q, vec3 v) {
+    mat4_fromRotationTranslation(dst->m, q, v);
+    dst->kind = TMAT4_RIGID;
+}
+
+/**
+ * Creates a tmat4 from a quaternion rotation, vector translation and
+ * vector scale, see mat4_fromRotationTranslationScale
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {quat} q Rotation quaternion
+ * @param {vec3} v Translation vector
+ * @param {vec3} s Scaling vector
+ */
+GLM_API void tmat4_fromRotationTranslationScale(tmat4 *dst, quat q, vec3 v, vec3 s) {
+    mat4_fromRotationTranslationScale(dst->m, q, v, s);
+    dst->kind = TMAT4_AFFINE;
+}
+
+/**
+ * Generates a perspective projection tmat4, see mat4_perspective
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {number} fovy Vertical field of view in radians
+ * @param {number} aspect Aspect ratio. typically viewport width/height
+ * @param {number} near Near bound of the frustum
+ * @param {number} far Far bound of the frustum, 0 or FLT_MAX for infinite
+ */
+GLM_API void tmat4_perspective(tmat4 *dst, float fovy, float aspect, float near, float far) {
+    mat4_perspective(dst->m, fovy, aspect, near, far);
+    dst->kind = TMAT4_DIAGONAL;
+}
+
+/**
+ * Generates an orthogonal projection tmat4, see mat4_ortho
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {number} left Left bound of the frustum
+ * @param {number} right Right bound of the frustum
+ * @param {number} bottom Bottom bound of the frustum
+ * @param {number} top Top bound of the frustum
+ * @param {number} near Near bound of the frustum
+ * @param {number} far Far bound of the frustum
+ */
+GLM_API void tmat4_ortho(tmat4 *dst, float left, float right, float bottom, float top, float near, float far) {
+    mat4_ortho(dst->m, left, right, bottom, top, near, far);
+    dst->kind = TMAT4_SCALE;
+}
+
+/**
+ * Generates a look-at view tmat4, see mat4_lookAt
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {vec3} eye Position of the viewer
+ * @param {vec3} center Point the viewer is looking at
+ * @param {vec3} up vec3 pointing up
+ */
+GLM_API void tmat4_lookAt(tmat4 *dst, vec3 eye, vec3 center, vec3 up) {
+    mat4_lookAt(dst->m, eye, center, up);
+    dst->kind = TMAT4_RIGID;
+}
+
+/**
+ * Multiplies two tmat4s, dst = dst * b, with the cheapest kernel their
+ * kinds allow:
+ * - dst a scale and translation: each row of b is scaled, 24 multiplies
+ * - b a scale and translation: each column of dst is scaled, 24 multiplies
+ * - dst a projection with a diagonal upper 3x3: 40 multiplies
+ * - both affine: mat4_multiplyAffine
+ * - otherwise mat4_multiply
+ * The result keeps the bits both operands have when b is affine, and is
+ * TMAT4_GENERAL otherwise.
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {tmat4} b the second operand, may be the same as out
+ */
+GLM_API void tmat4_multiply(tmat4 *dst, tmat4 *b) {
+    float *a = dst->m, *m = b->m;
+    int kind = dst->kind, bkind = b->kind;
+
+    dst->kind = bkind & TMAT4_AFFINE ? kind & bkind : TMAT4_GENERAL;
+    if ((kind & TMAT4_SCALE) == TMAT4_SCALE) {
+        glm_tmat4_scaleMultiply(a, a, m);
+    }
+    else if ((bkind & TMAT4_SCALE) == TMAT4_SCALE) {
+        glm_tmat4_multiplyScale(a, a, m);
+    }
+    else if (kind & TMAT4_DIAGONAL) {
+        glm_tmat4_projectionMultiply(a, m);
+    }
+    else if (kind & bkind & TMAT4_AFFINE) {
+        mat4_multiplyAffine(a, m);
+    }
+    else {
+        mat4_multiply(a, m);
+    }
+}
+
+/**
+ * Inverts a tmat4 with the cheapest kernel its kind allows: reciprocals
+ * for a scale and translation, mat4_invertRigid, mat4_invertAffine or
+ * mat4_invert. The matrix is left unchanged if it is singular.
+ *
+ * @param {tmat4} out the receiving matrix
+ */
+GLM_API void tmat4_invert(tmat4 *dst) {
+    float *a = dst->m;
+
+    if ((dst->kind & TMAT4_SCALE) == TMAT4_SCALE) {
+        if (!a[0] || !a[5] || !a[10]) {
+            return;
+        }
+        a[0] = 1 / a[0];
+        a[5] = 1 / a[5];
+        a[10] = 1 / a[10];
+        a[12] = -a[12] * a[0];
+        a[13] = -a[13] * a[5];
+        a[14] = -a[14] * a[10];
+    }
+    else if ((dst->kind & TMAT4_RIGID) == TMAT4_RIGID) {
+        mat4_invertRigid(a);
+    }
+    else if (dst->kind & TMAT4_AFFINE) {
+        mat4_invertAffine(a);
+    }
+    else {
+        // The inverse of a projective matrix is not diagonal in general
+        mat4_invert(a);
+        dst->kind = TMAT4_GENERAL;
+    }
+}
+
+/**
+ * Translate a tmat4 by the given vector, see mat4_translate. Keeps the kind.
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {vec3} v vector to translate by
+ */
+GLM_API void tmat4_translate(tmat4 *dst, vec3 v) {
+    mat4_translate(dst->m, v);
+}
+
+/**
+ * Scales the tmat4 by the dimensions in the given vec3, see mat4_scale.
+ * The matrix is no longer known to be orthonormal.
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {vec3} v the vec3 to scale the matrix by
+ */
+GLM_API void tmat4_scale(tmat4 *dst, vec3 v) {
+    mat4_scale(dst->m, v);
+    dst->kind &= ~TMAT4_ORTHONORMAL;
+}
+
+/**
+ * Rotates a tmat4 by the given angle around the given axis, see
+ * mat4_rotate. The matrix is no longer known to be diagonal.
+ *
+ * @param {tmat4} out the receiving matrix
+ * @param {Number} rad the angle to rotate the matrix by
+ * @param {vec3} axis the axis to rotate around
+ */
+GLM_API void tmat4_rotate(tmat4 *dst, float rad, vec3 axis) {
+    mat4_rotate(dst->m, rad, axis);
+    dst->kind &= ~TMAT4_DIAGONAL;
+}
+
+/**
+ * Transforms the vec3 with a tmat4. Like vec3_transformMat4, but affine
+ * matrices skip the w divide and scales only take 3 multiply-adds.
+ *
+ * @param {vec3} out the receiving vector
+ * @param {tmat4} m matrix to transform with
+ */
+GLM_API void vec3_transformTmat4(vec3 dst, tmat4 *m) {
+    float *a = m->m;
+    float x = dst[0], y = dst[1], z = dst[2];
+
+    if ((m->kind & TMAT4_SCALE) == TMAT4_SCALE) {
+        dst[0] = a[0] * x + a[12];
+        dst[1] = a[5] * y + a[13];
+        dst[2] = a[10] * z + a[14];
+    }
+    else if (m->kind & TMAT4_AFFINE) {
+        dst[0] = a[0] * x + a[4] * y + a[8] * z + a[12];
+        dst[1] = a[1] * x + a[5] * y + a[9] * z + a[13];
+        dst[2] = a[2] * x + a[6] * y + a[10] * z + a[14];
+    }
+    else {
+        vec3_transformMat4(dst, a);
+    }
+}
+
+/**
+ * Transforms an array of vec3's with a tmat4, see vec3_transformMat4_array.
+ *
+ * @param {vec3[]} dst the receiving array, may be the same array as src
+ * @param {vec3[]} src the vectors to transform
+ * @param {Number} count number of vectors
+ * @param {tmat4} m matrix to transform with
+ */
+GLM_API void vec3_transformTmat4_array(vec3 *dst, vec3 *src, size_t count, tmat4 *m) {
+    float *a = m->m;
+    size_t i;
+
+    if ((m->kind & TMAT4_SCALE) != TMAT4_SCALE) {
+        vec3_transformMat4_array(dst, src, count, a);
+        return;
+    }
+
+    for (i = 0; i < count; i++) {
+        dst[i][0] = a[0] * src[i][0] + a[12];
+        dst[i][1] = a[5] * src[i][1] + a[13];
+        dst[i][2] = a[10] * src[i][2] + a[14];
+    }
+}
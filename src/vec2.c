@@ -1,4 +1,7 @@
 #include "vec2.h"
+#include "epsilon.h"
+#include "noalias.h"
+#include "simd.h"
 #include <math.h>
 
 /**
@@ -7,7 +10,7 @@
  * @param {vec2} out the receiving vector
  * @param {vec2} a the source vector
  */
-void vec2_copy(vec2 dst, vec2 a) {
+GLM_API void vec2_copy(vec2 dst, vec2 a) {
     dst[0] = a[0];
     dst[1] = a[1];
 }
@@ -19,7 +22,7 @@ void vec2_copy(vec2 dst, vec2 a) {
  * @param {Number} x X component
  * @param {Number} y Y component
  */
-void vec2_set(vec2 dst, float x, float y) {
+GLM_API void vec2_set(vec2 dst, float x, float y) {
     dst[0] = x;
     dst[1] = y;
 }
@@ -30,7 +33,7 @@ void vec2_set(vec2 dst, float x, float y) {
  * @param {vec2} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_add(vec2 dst, vec2 b) {
+GLM_API void vec2_add(vec2 dst, vec2 b) {
     dst[0] = dst[0] + b[0];
     dst[1] = dst[1] + b[1];
 }
@@ -41,7 +44,7 @@ void vec2_add(vec2 dst, vec2 b) {
  * @param {vec2} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_subtract(vec2 dst, vec2 b) {
+GLM_API void vec2_subtract(vec2 dst, vec2 b) {
     dst[0] = dst[0] - b[0];
     dst[1] = dst[1] - b[1];
 }
@@ -52,7 +55,7 @@ void vec2_subtract(vec2 dst, vec2 b) {
  * @param {vec2} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_multiply(vec2 dst, vec2 b) {
+GLM_API void vec2_multiply(vec2 dst, vec2 b) {
     dst[0] = dst[0] * b[0];
     dst[1] = dst[1] * b[1];
 }
@@ -63,7 +66,7 @@ void vec2_multiply(vec2 dst, vec2 b) {
  * @param {vec2} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_divide(vec2 dst, vec2 b) {
+GLM_API void vec2_divide(vec2 dst, vec2 b) {
     dst[0] = dst[0] / b[0];
     dst[1] = dst[1] / b[1];
 }
@@ -73,7 +76,7 @@ void vec2_divide(vec2 dst, vec2 b) {
  *
  * @param {vec2} out the receiving vector
  */
-void vec2_ceil(vec2 dst) {
+GLM_API void vec2_ceil(vec2 dst) {
     dst[0] = ceilf(dst[0]);
     dst[1] = ceilf(dst[1]);
 }
@@ -83,7 +86,7 @@ void vec2_ceil(vec2 dst) {
  *
  * @param {vec2} out the receiving vector
  */
-void vec2_floor(vec2 dst) {
+GLM_API void vec2_floor(vec2 dst) {
     dst[0] = floorf(dst[0]);
     dst[1] = floorf(dst[1]);
 }
@@ -94,7 +97,7 @@ void vec2_floor(vec2 dst) {
  * @param {vec2} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_min(vec2 dst, vec2 b) {
+GLM_API void vec2_min(vec2 dst, vec2 b) {
     dst[0] = fmin(dst[0], b[0]);
     dst[1] = fmin(dst[1], b[1]);
 }
@@ -105,7 +108,7 @@ void vec2_min(vec2 dst, vec2 b) {
  * @param {vec2} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_max(vec2 dst, vec2 b) {
+GLM_API void vec2_max(vec2 dst, vec2 b) {
     dst[0] = fmax(dst[0], b[0]);
     dst[1] = fmax(dst[1], b[1]);
 }
@@ -115,7 +118,7 @@ void vec2_max(vec2 dst, vec2 b) {
  *
  * @param {vec2} out the receiving vector
  */
-void vec2_round(vec2 dst) {
+GLM_API void vec2_round(vec2 dst) {
     dst[0] = roundf(dst[0]);
     dst[1] = roundf(dst[1]);
 }
@@ -126,7 +129,7 @@ void vec2_round(vec2 dst) {
  * @param {vec2} out the receiving vector
  * @param {Number} b amount to scale the vector by
  */
-void vec2_scale(vec2 dst, float b) {
+GLM_API void vec2_scale(vec2 dst, float b) {
     dst[0] = dst[0] * b;
     dst[1] = dst[1] * b;
 }
@@ -138,7 +141,7 @@ void vec2_scale(vec2 dst, float b) {
  * @param {vec2} b the second operand
  * @param {Number} scale the amount to scale b by before adding
  */
-void vec2_scaleAndAdd(vec2 dst, vec2 b, float scale) {
+GLM_API void vec2_scaleAndAdd(vec2 dst, vec2 b, float scale) {
     dst[0] = dst[0] + (b[0] * scale);
     dst[1] = dst[1] + (b[1] * scale);
 }
@@ -150,7 +153,7 @@ void vec2_scaleAndAdd(vec2 dst, vec2 b, float scale) {
  * @param {vec2} b the second operand
  * @returns {Number} distance between a and b
  */
-float vec2_distance(vec2 a, vec2 b) {
+GLM_API float vec2_distance(vec2 a, vec2 b) {
     float x = b[0] - a[0], y = b[1] - a[1];
     return sqrtf(x*x + y*y);
 }
@@ -162,7 +165,7 @@ float vec2_distance(vec2 a, vec2 b) {
  * @param {vec2} b the second operand
  * @returns {Number} squared distance between a and b
  */
-float vec2_squaredDistance(vec2 a, vec2 b) {
+GLM_API float vec2_squaredDistance(vec2 a, vec2 b) {
     float x = b[0] - a[0], y = b[1] - a[1];
     return x*x + y*y;
 }
@@ -173,7 +176,7 @@ float vec2_squaredDistance(vec2 a, vec2 b) {
  * @param {vec2} a vector to calculate length of
  * @returns {Number} length of a
  */
-float vec2_length(vec2 a) {
+GLM_API float vec2_length(vec2 a) {
     float x = a[0], y = a[1];
     return sqrtf(x*x + y*y);
 }
@@ -184,7 +187,7 @@ float vec2_length(vec2 a) {
  * @param {vec2} a vector to calculate squared length of
  * @returns {Number} squared length of a
  */
-float vec2_squaredLength(vec2 a) {
+GLM_API float vec2_squaredLength(vec2 a) {
     float x = a[0], y = a[1];
     return x*x + y*y;
 }
@@ -196,7 +199,7 @@ float vec2_squaredLength(vec2 a) {
  * @param {vec2} a vector to negate
  * @returns {vec2} out
  */
-void vec2_negate(vec2 dst) {
+GLM_API void vec2_negate(vec2 dst) {
     dst[0] = -dst[0];
     dst[1] = -dst[1];
 }
@@ -206,7 +209,7 @@ void vec2_negate(vec2 dst) {
  *
  * @param {vec2} out the receiving vector
  */
-void vec2_inverse(vec2 dst) {
+GLM_API void vec2_inverse(vec2 dst) {
     dst[0] = 1.0 / dst[0];
     dst[1] = 1.0 / dst[1];
 }
@@ -216,16 +219,34 @@ void vec2_inverse(vec2 dst) {
  *
  * @param {vec2} out the receiving vector
  */
-void vec2_normalize(vec2 dst) {
+GLM_API void vec2_normalize(vec2 dst) {
     float x = dst[0], y = dst[1];
     float len = x*x + y*y;
-    if (len > 0) {
-        len = 1 / sqrtf(len);
+    if (len > GLM_NORMALIZE_MIN) {
+        len = glm_normalize_rsqrt(len);
         dst[0] = dst[0] * len;
         dst[1] = dst[1] * len;
     }
 }
 
+/**
+ * Normalize a vec2 with the fast reciprocal square root: the hardware
+ * estimate and one Newton-Raphson step with SSE4/AVX2, within 2^-21
+ * relative of vec2_normalize. Plain C builds compute it exactly.
+ * Vectors with a squared length below FLT_MIN are left as they are.
+ *
+ * @param {vec2} out the receiving vector
+ */
+GLM_API void vec2_normalizeFast(vec2 dst) {
+    float x = dst[0], y = dst[1];
+    float len = x*x + y*y;
+    if (len >= FLT_MIN) {
+        len = glm_rsqrt(len);
+        dst[0] = x * len;
+        dst[1] = y * len;
+    }
+}
+
 /**
  * Calculates the dot product of two vec2's
  *
@@ -233,7 +254,7 @@ void vec2_normalize(vec2 dst) {
  * @param {vec2} b the second operand
  * @returns {Number} dot product of a and b
  */
-float vec2_dot(vec2 a, vec2 b) {
+GLM_API float vec2_dot(vec2 a, vec2 b) {
     return a[0] * b[0] + a[1] * b[1];
 }
 
@@ -244,7 +265,7 @@ float vec2_dot(vec2 a, vec2 b) {
  * @param {vec3} out the receiving vector
  * @param {vec2} b the second operand
  */
-void vec2_cross(vec3 dst, vec2 b) {
+GLM_API void vec2_cross(vec3 dst, vec2 b) {
     float z = dst[0] * b[1] - dst[1] * b[0];
     dst[0] = dst[1] = 0;
     dst[2] = z;
@@ -257,7 +278,7 @@ void vec2_cross(vec3 dst, vec2 b) {
  * @param {vec2} b the second operand
  * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
  */
-void vec2_lerp(vec2 dst, vec2 b, float t) {
+GLM_API void vec2_lerp(vec2 dst, vec2 b, float t) {
     float ax = dst[0], ay = dst[1];
     dst[0] = ax + t * (b[0] - ax);
     dst[1] = ay + t * (b[1] - ay);
@@ -269,7 +290,7 @@ void vec2_lerp(vec2 dst, vec2 b, float t) {
  * @param {vec2} out the receiving vector
  * @param {mat2} m matrix to transform with
  */
-void vec2_transformMat2(vec2 dst, mat2 m) {
+GLM_API void vec2_transformMat2(vec2 dst, mat2 m) {
     float x = dst[0], y = dst[1];
     dst[0] = m[0] * x + m[2] * y;
     dst[1] = m[1] * x + m[3] * y;
@@ -281,7 +302,7 @@ void vec2_transformMat2(vec2 dst, mat2 m) {
  * @param {vec2} out the receiving vector
  * @param {mat2d} m matrix to transform with
  */
-void vec2_transformMat2d(vec2 dst, mat2 m) {
+GLM_API void vec2_transformMat2d(vec2 dst, mat2 m) {
     float x = dst[0], y = dst[1];
     dst[0] = m[0] * x + m[2] * y + m[4];
     dst[1] = m[1] * x + m[3] * y + m[5];
@@ -294,7 +315,7 @@ void vec2_transformMat2d(vec2 dst, mat2 m) {
  * @param {vec2} out the receiving vector
  * @param {mat3} m matrix to transform with
  */
-void vec2_transformMat3(vec2 dst, mat3 m) {
+GLM_API void vec2_transformMat3(vec2 dst, mat3 m) {
     float x = dst[0], y = dst[1];
     dst[0] = m[0] * x + m[3] * y + m[6];
     dst[1] = m[1] * x + m[4] * y + m[7];
@@ -309,7 +330,7 @@ void vec2_transformMat3(vec2 dst, mat3 m) {
  * @param {vec2} a the vector to transform
  * @param {mat4} m matrix to transform with
  */
-void vec2_transformMat4(vec2 dst, mat4 m) {
+GLM_API void vec2_transformMat4(vec2 dst, mat4 m) {
     float x = dst[0];
     float y = dst[1];
     dst[0] = m[0] * x + m[4] * y + m[12];
@@ -322,7 +343,7 @@ void vec2_transformMat4(vec2 dst, mat4 m) {
  * @param {vec2} b The origin of the rotation
  * @param {Number} c The angle of rotation
  */
-void vec2_rotate(vec2 dst, vec2 b, float c) {
+GLM_API void vec2_rotate(vec2 dst, vec2 b, float c) {
     //Translate point to the origin
     float p0 = dst[0] - b[0],
     p1 = dst[1] - b[1],
@@ -340,7 +361,7 @@ void vec2_rotate(vec2 dst, vec2 b, float c) {
  * @param {vec2} b The second operand
  * @returns {Number} The angle in radians
  */
-float vec2_angle(vec2 a, vec2 b) {
+GLM_API float vec2_angle(vec2 a, vec2 b) {
     float x1 = a[0],
         y1 = a[1],
         x2 = b[0],
@@ -377,6 +398,298 @@ float vec2_angle(vec2 a, vec2 b) {
  * @param {vec2} b The second vector.
  * @returns {Boolean} True if the vectors are equal, false otherwise.
  */
-uint8_t vec2_exactEquals(vec2 a, vec2 b) {
+GLM_API uint8_t vec2_exactEquals(vec2 a, vec2 b) {
     return a[0] == b[0] && a[1] == b[1];
 }
+
+/**
+ * Adds two vec2's
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ */
+GLM_API void vec2_addTo(float *GLM_RESTRICT out, vec2 a, vec2 b) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    GLM_ASSERT_NOALIAS(out, 2, b, 2);
+    out[0] = a[0] + b[0];
+    out[1] = a[1] + b[1];
+}
+
+/**
+ * Subtracts vector b from vector a
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ */
+GLM_API void vec2_subtractTo(float *GLM_RESTRICT out, vec2 a, vec2 b) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    GLM_ASSERT_NOALIAS(out, 2, b, 2);
+    out[0] = a[0] - b[0];
+    out[1] = a[1] - b[1];
+}
+
+/**
+ * Multiplies two vec2's
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ */
+GLM_API void vec2_multiplyTo(float *GLM_RESTRICT out, vec2 a, vec2 b) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    GLM_ASSERT_NOALIAS(out, 2, b, 2);
+    out[0] = a[0] * b[0];
+    out[1] = a[1] * b[1];
+}
+
+/**
+ * Divides two vec2's
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ */
+GLM_API void vec2_divideTo(float *GLM_RESTRICT out, vec2 a, vec2 b) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    GLM_ASSERT_NOALIAS(out, 2, b, 2);
+    out[0] = a[0] / b[0];
+    out[1] = a[1] / b[1];
+}
+
+/**
+ * ceilf the components of a vec2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ */
+GLM_API void vec2_ceilTo(float *GLM_RESTRICT out, vec2 a) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    out[0] = ceilf(a[0]);
+    out[1] = ceilf(a[1]);
+}
+
+/**
+ * floorf the components of a vec2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ */
+GLM_API void vec2_floorTo(float *GLM_RESTRICT out, vec2 a) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    out[0] = floorf(a[0]);
+    out[1] = floorf(a[1]);
+}
+
+/**
+ * Returns the minimum of two vec2's
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ */
+GLM_API void vec2_minTo(float *GLM_RESTRICT out, vec2 a, vec2 b) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    GLM_ASSERT_NOALIAS(out, 2, b, 2);
+    out[0] = fmin(a[0], b[0]);
+    out[1] = fmin(a[1], b[1]);
+}
+
+/**
+ * Returns the maximum of two vec2's
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ */
+GLM_API void vec2_maxTo(float *GLM_RESTRICT out, vec2 a, vec2 b) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    GLM_ASSERT_NOALIAS(out, 2, b, 2);
+    out[0] = fmax(a[0], b[0]);
+    out[1] = fmax(a[1], b[1]);
+}
+
+/**
+ * roundf the components of a vec2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ */
+GLM_API void vec2_roundTo(float *GLM_RESTRICT out, vec2 a) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    out[0] = roundf(a[0]);
+    out[1] = roundf(a[1]);
+}
+
+/**
+ * Scales a vec2 by a scalar number
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {Number} b amount to scale the vector by
+ */
+GLM_API void vec2_scaleTo(float *GLM_RESTRICT out, vec2 a, float b) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    out[0] = a[0] * b;
+    out[1] = a[1] * b;
+}
+
+/**
+ * Adds two vec2's after scaling the second operand by a scalar value
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ * @param {Number} scale the amount to scale b by before adding
+ */
+GLM_API void vec2_scaleAndAddTo(float *GLM_RESTRICT out, vec2 a, vec2 b, float scale) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    GLM_ASSERT_NOALIAS(out, 2, b, 2);
+    out[0] = a[0] + (b[0] * scale);
+    out[1] = a[1] + (b[1] * scale);
+}
+
+/**
+ * Negates the components of a vec2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} a vector to negate
+ * @returns {vec2} out
+ */
+GLM_API void vec2_negateTo(float *GLM_RESTRICT out, vec2 a) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    out[0] = -a[0];
+    out[1] = -a[1];
+}
+
+/**
+ * Returns the inverse of the components of a vec2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ */
+GLM_API void vec2_inverseTo(float *GLM_RESTRICT out, vec2 a) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    out[0] = 1.0 / a[0];
+    out[1] = 1.0 / a[1];
+}
+
+/**
+ * Normalize a vec2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ */
+GLM_API void vec2_normalizeTo(float *GLM_RESTRICT out, vec2 a) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    float x = a[0], y = a[1];
+    float len = x*x + y*y;
+    // A zero length vector is copied as is, like vec2_normalize leaves it
+    len = len > GLM_NORMALIZE_MIN ? glm_normalize_rsqrt(len) : 1;
+    out[0] = a[0] * len;
+    out[1] = a[1] * len;
+}
+
+/**
+ * Performs a linear interpolation between two vec2's
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void vec2_lerpTo(float *GLM_RESTRICT out, vec2 a, vec2 b, float t) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    GLM_ASSERT_NOALIAS(out, 2, b, 2);
+    float ax = a[0], ay = a[1];
+    out[0] = ax + t * (b[0] - ax);
+    out[1] = ay + t * (b[1] - ay);
+}
+
+/**
+ * Transforms the vec2 with a mat2
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {mat2} m matrix to transform with
+ */
+GLM_API void vec2_transformMat2To(float *GLM_RESTRICT out, vec2 a, mat2 m) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    GLM_ASSERT_NOALIAS(out, 2, m, 4);
+    float x = a[0], y = a[1];
+    out[0] = m[0] * x + m[2] * y;
+    out[1] = m[1] * x + m[3] * y;
+}
+
+/**
+ * Transforms the vec2 with a mat2d
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {mat2d} m matrix to transform with, 6 floats (a, b, c, d, tx, ty)
+ */
+GLM_API void vec2_transformMat2dTo(float *GLM_RESTRICT out, vec2 a, const float *m) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    GLM_ASSERT_NOALIAS(out, 2, m, 6);
+    float x = a[0], y = a[1];
+    out[0] = m[0] * x + m[2] * y + m[4];
+    out[1] = m[1] * x + m[3] * y + m[5];
+}
+
+/**
+ * Transforms the vec2 with a mat3
+ * 3rd vector component is implicitly '1'
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {mat3} m matrix to transform with
+ */
+GLM_API void vec2_transformMat3To(float *GLM_RESTRICT out, vec2 a, mat3 m) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    GLM_ASSERT_NOALIAS(out, 2, m, 9);
+    float x = a[0], y = a[1];
+    out[0] = m[0] * x + m[3] * y + m[6];
+    out[1] = m[1] * x + m[4] * y + m[7];
+}
+
+/**
+ * Transforms the vec2 with a mat4
+ * 3rd vector component is implicitly '0'
+ * 4th vector component is implicitly '1'
+ *
+ * @param {vec2} out the receiving vector, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} a the vector to transform
+ * @param {mat4} m matrix to transform with
+ */
+GLM_API void vec2_transformMat4To(float *GLM_RESTRICT out, vec2 a, mat4 m) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    GLM_ASSERT_NOALIAS(out, 2, m, 16);
+    float x = a[0];
+    float y = a[1];
+    out[0] = m[0] * x + m[4] * y + m[12];
+    out[1] = m[1] * x + m[5] * y + m[13];
+}
+
+/**
+ * Rotate a 2D vector
+ * @param {vec2} out The receiving vec2, must not overlap the other arguments
+ * @param {vec2} a the source vector
+ * @param {vec2} b The origin of the rotation
+ * @param {Number} c The angle of rotation
+ */
+GLM_API void vec2_rotateTo(float *GLM_RESTRICT out, vec2 a, vec2 b, float c) {
+    GLM_ASSERT_NOALIAS(out, 2, a, 2);
+    GLM_ASSERT_NOALIAS(out, 2, b, 2);
+    //Translate point to the origin
+    float p0 = a[0] - b[0],
+    p1 = a[1] - b[1],
+    sinC = sinf(c),
+    cosC = cosf(c);
+
+    //perform rotation and translate to correct position
+    out[0] = p0*cosC - p1*sinC + b[0];
+    out[1] = p0*sinC + p1*cosC + b[1];
+}
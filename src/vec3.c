@@ -1,4 +1,7 @@
 #include "vec3.h"
+#include "epsilon.h"
+#include "simd.h"
+#include "noalias.h"
 #include <math.h>
 
 /**
@@ -7,7 +10,7 @@
  * @param {vec3} a vector to calculate length of
  * @returns {Number} length of a
  */
-float vec3_length(vec3 a) {
+GLM_API float vec3_length(vec3 a) {
     float x = a[0];
     float y = a[1];
     float z = a[2];
@@ -20,7 +23,7 @@ float vec3_length(vec3 a) {
  * @param {vec3} out the receiving vector
  * @param {vec3} a the source vector
  */
-void vec3_copy(vec3 dst, vec3 a) {
+GLM_API void vec3_copy(vec3 dst, vec3 a) {
     dst[0] = a[0];
     dst[1] = a[1];
     dst[2] = a[2];
@@ -34,7 +37,7 @@ void vec3_copy(vec3 dst, vec3 a) {
  * @param {Number} y Y component
  * @param {Number} z Z component
  */
-void vec3_set(vec3 dst, float x, float y, float z) {
+GLM_API void vec3_set(vec3 dst, float x, float y, float z) {
     dst[0] = x;
     dst[1] = y;
     dst[2] = z;
@@ -46,7 +49,7 @@ void vec3_set(vec3 dst, float x, float y, float z) {
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_add(vec3 dst, vec3 b) {
+GLM_API void vec3_add(vec3 dst, vec3 b) {
     dst[0] = dst[0] + b[0];
     dst[1] = dst[1] + b[1];
     dst[2] = dst[2] + b[2];
@@ -58,7 +61,7 @@ void vec3_add(vec3 dst, vec3 b) {
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_subtract(vec3 dst, vec3 b) {
+GLM_API void vec3_subtract(vec3 dst, vec3 b) {
     dst[0] = dst[0] - b[0];
     dst[1] = dst[1] - b[1];
     dst[2] = dst[2] - b[2];
@@ -70,7 +73,7 @@ void vec3_subtract(vec3 dst, vec3 b) {
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_multiply(vec3 dst, vec3 b) {
+GLM_API void vec3_multiply(vec3 dst, vec3 b) {
     dst[0] = dst[0] * b[0];
     dst[1] = dst[1] * b[1];
     dst[2] = dst[2] * b[2];
@@ -82,7 +85,7 @@ void vec3_multiply(vec3 dst, vec3 b) {
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_divide(vec3 dst, vec3 b) {
+GLM_API void vec3_divide(vec3 dst, vec3 b) {
     dst[0] = dst[0] / b[0];
     dst[1] = dst[1] / b[1];
     dst[2] = dst[2] / b[2];
@@ -93,7 +96,7 @@ void vec3_divide(vec3 dst, vec3 b) {
  *
  * @param {vec3} out the receiving vector
  */
-void vec3_ceil(vec3 dst) {
+GLM_API void vec3_ceil(vec3 dst) {
     dst[0] = ceilf(dst[0]);
     dst[1] = ceilf(dst[1]);
     dst[2] = ceilf(dst[2]);
@@ -104,7 +107,7 @@ void vec3_ceil(vec3 dst) {
  *
  * @param {vec3} out the receiving vector
  */
-void vec3_floor(vec3 dst) {
+GLM_API void vec3_floor(vec3 dst) {
     dst[0] = floorf(dst[0]);
     dst[1] = floorf(dst[1]);
     dst[2] = floorf(dst[2]);
@@ -116,7 +119,7 @@ void vec3_floor(vec3 dst) {
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_min(vec3 dst, vec3 b) {
+GLM_API void vec3_min(vec3 dst, vec3 b) {
     dst[0] = fmin(dst[0], b[0]);
     dst[1] = fmin(dst[1], b[1]);
     dst[2] = fmin(dst[2], b[2]);
@@ -128,7 +131,7 @@ void vec3_min(vec3 dst, vec3 b) {
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_max(vec3 dst, vec3 b) {
+GLM_API void vec3_max(vec3 dst, vec3 b) {
     dst[0] = fmax(dst[0], b[0]);
     dst[1] = fmax(dst[1], b[1]);
     dst[2] = fmax(dst[2], b[2]);
@@ -139,7 +142,7 @@ void vec3_max(vec3 dst, vec3 b) {
  *
  * @param {vec3} out the receiving vector
  */
-void vec3_round(vec3 dst) {
+GLM_API void vec3_round(vec3 dst) {
     dst[0] = roundf(dst[0]);
     dst[1] = roundf(dst[1]);
     dst[2] = roundf(dst[2]);
@@ -151,7 +154,7 @@ void vec3_round(vec3 dst) {
  * @param {vec3} out the receiving vector
  * @param {Number} b amount to scale the vector by
  */
-void vec3_scale(vec3 dst, float b) {
+GLM_API void vec3_scale(vec3 dst, float b) {
     dst[0] = dst[0] * b;
     dst[1] = dst[1] * b;
     dst[2] = dst[2] * b;
@@ -164,7 +167,7 @@ void vec3_scale(vec3 dst, float b) {
  * @param {vec3} b the second operand
  * @param {Number} scale the amount to scale b by before adding
  */
-void vec3_scaleAndAdd(vec3 dst, vec3 b, float scale) {
+GLM_API void vec3_scaleAndAdd(vec3 dst, vec3 b, float scale) {
     dst[0] = dst[0] + (b[0] * scale);
     dst[1] = dst[1] + (b[1] * scale);
     dst[2] = dst[2] + (b[2] * scale);
@@ -177,7 +180,7 @@ void vec3_scaleAndAdd(vec3 dst, vec3 b, float scale) {
  * @param {vec3} b the second operand
  * @returns {Number} distance between a and b
  */
-float vec3_distance(vec3 a, vec3 b) {
+GLM_API float vec3_distance(vec3 a, vec3 b) {
     float x = b[0] - a[0];
     float y = b[1] - a[1];
     float z = b[2] - a[2];
@@ -191,7 +194,7 @@ float vec3_distance(vec3 a, vec3 b) {
  * @param {vec3} b the second operand
  * @returns {Number} squared distance between a and b
  */
-float vec3_squaredDistance(vec3 a, vec3 b) {
+GLM_API float vec3_squaredDistance(vec3 a, vec3 b) {
     float x = b[0] - a[0];
     float y = b[1] - a[1];
     float z = b[2] - a[2];
@@ -204,7 +207,7 @@ float vec3_squaredDistance(vec3 a, vec3 b) {
  * @param {vec3} a vector to calculate squared length of
  * @returns {Number} squared length of a
  */
-float vec3_squaredLength(vec3 a) {
+GLM_API float vec3_squaredLength(vec3 a) {
     float x = a[0];
     float y = a[1];
     float z = a[2];
@@ -216,7 +219,7 @@ float vec3_squaredLength(vec3 a) {
  *
  * @param {vec3} out the receiving vector
  */
-void vec3_negate(vec3 dst) {
+GLM_API void vec3_negate(vec3 dst) {
     dst[0] = -dst[0];
     dst[1] = -dst[1];
     dst[2] = -dst[2];
@@ -227,7 +230,7 @@ void vec3_negate(vec3 dst) {
  *
  * @param {vec3} out the receiving vector
  */
-void vec3_inverse(vec3 dst) {
+GLM_API void vec3_inverse(vec3 dst) {
     dst[0] = 1.0 / dst[0];
     dst[1] = 1.0 / dst[1];
     dst[2] = 1.0 / dst[2];
@@ -238,19 +241,38 @@ void vec3_inverse(vec3 dst) {
  *
  * @param {vec3} out the receiving vector
  */
-void vec3_normalize(vec3 dst) {
+GLM_API void vec3_normalize(vec3 dst) {
     float x = dst[0];
     float y = dst[1];
     float z = dst[2];
     float len = x*x + y*y + z*z;
-    if (len > 0) {
-        len = 1 / sqrtf(len);
+    if (len > GLM_NORMALIZE_MIN) {
+        len = glm_normalize_rsqrt(len);
         dst[0] = dst[0] * len;
         dst[1] = dst[1] * len;
         dst[2] = dst[2] * len;
     }
 }
 
+/**
+ * Normalize a vec3 with the fast reciprocal square root: the hardware
+ * estimate and one Newton-Raphson step with SSE4/AVX2, within 2^-21
+ * relative of vec3_normalize. Plain C builds compute it exactly.
+ * Vectors with a squared length below FLT_MIN are left as they are.
+ *
+ * @param {vec3} out the receiving vector
+ */
+GLM_API void vec3_normalizeFast(vec3 dst) {
+    float x = dst[0], y = dst[1], z = dst[2];
+    float len = x*x + y*y + z*z;
+    if (len >= FLT_MIN) {
+        len = glm_rsqrt(len);
+        dst[0] = x * len;
+        dst[1] = y * len;
+        dst[2] = z * len;
+    }
+}
+
 /**
  * Calculates the dot product of two vec3's
  *
@@ -258,7 +280,7 @@ void vec3_normalize(vec3 dst) {
  * @param {vec3} b the second operand
  * @returns {Number} dot product of a and b
  */
-float vec3_dot(vec3 a, vec3 b) {
+GLM_API float vec3_dot(vec3 a, vec3 b) {
     return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
 }
 
@@ -268,7 +290,7 @@ float vec3_dot(vec3 a, vec3 b) {
  * @param {vec3} out the receiving vector
  * @param {vec3} b the second operand
  */
-void vec3_cross(vec3 dst, vec3 b) {
+GLM_API void vec3_cross(vec3 dst, vec3 b) {
     float ax = dst[0], ay = dst[1], az = dst[2];
     float bx = b[0], by = b[1], bz = b[2];
 
@@ -284,7 +306,7 @@ void vec3_cross(vec3 dst, vec3 b) {
  * @param {vec3} b the second operand
  * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
  */
-void vec3_lerp(vec3 dst, vec3 b, float t) {
+GLM_API void vec3_lerp(vec3 dst, vec3 b, float t) {
     float ax = dst[0];
     float ay = dst[1];
     float az = dst[2];
@@ -302,7 +324,7 @@ void vec3_lerp(vec3 dst, vec3 b, float t) {
  * @param {vec3} d the fourth operand
  * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
  */
-void vec3_hermite(vec3 dst, vec3 b, vec3 c, vec3 d, float t) {
+GLM_API void vec3_hermite(vec3 dst, vec3 b, vec3 c, vec3 d, float t) {
     float factorTimes2 = t * t;
     float factor1 = factorTimes2 * (2 * t - 3) + 1;
     float factor2 = factorTimes2 * (t - 2) + t;
@@ -323,7 +345,7 @@ void vec3_hermite(vec3 dst, vec3 b, vec3 c, vec3 d, float t) {
  * @param {vec3} d the fourth operand
  * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
  */
-void vec3_bezier(vec3 dst, vec3 b, vec3 c, vec3 d, float t) {
+GLM_API void vec3_bezier(vec3 dst, vec3 b, vec3 c, vec3 d, float t) {
     float inverseFactor = 1 - t;
     float inverseFactorTimesTwo = inverseFactor * inverseFactor;
     float factorTimes2 = t * t;
@@ -344,10 +366,10 @@ void vec3_bezier(vec3 dst, vec3 b, vec3 c, vec3 d, float t) {
  * @param {vec3} out the receiving vector
  * @param {mat4} m matrix to transform with
  */
-void vec3_transformMat4(vec3 dst, mat4 m) {
+GLM_API void vec3_transformMat4(vec3 dst, mat4 m) {
     float x = dst[0], y = dst[1], z = dst[2];
     float w = m[3] * x + m[7] * y + m[11] * z + m[15];
-    w = w || 1.0;
+    w = w ? w : 1.0;
     dst[0] = (m[0] * x + m[4] * y + m[8] * z + m[12]) / w;
     dst[1] = (m[1] * x + m[5] * y + m[9] * z + m[13]) / w;
     dst[2] = (m[2] * x + m[6] * y + m[10] * z + m[14]) / w;
@@ -359,7 +381,7 @@ void vec3_transformMat4(vec3 dst, mat4 m) {
  * @param {vec3} out the receiving vector
  * @param {mat3} m the 3x3 matrix to transform with
  */
-void vec3_transformMat3(vec3 dst, mat3 m) {
+GLM_API void vec3_transformMat3(vec3 dst, mat3 m) {
     float x = dst[0], y = dst[1], z = dst[2];
     dst[0] = x * m[0] + y * m[3] + z * m[6];
     dst[1] = x * m[1] + y * m[4] + z * m[7];
@@ -373,7 +395,7 @@ void vec3_transformMat3(vec3 dst, mat3 m) {
  * @param {vec3} out the receiving vector
  * @param {quat} q quaternion to transform with
  */
-void vec3_transformQuat(vec3 dst, quat q) {
+GLM_API void vec3_transformQuat(vec3 dst, quat q) {
     // benchmarks: https://jsperf.com/quaternion-transform-vec3-implementations-fixed
     float qx = q[0], qy = q[1], qz = q[2], qw = q[3];
     float x = dst[0], y = dst[1], z = dst[2];
@@ -407,7 +429,7 @@ void vec3_transformQuat(vec3 dst, quat q) {
  * @param {vec3} b The origin of the rotation
  * @param {Number} c The angle of rotation
  */
-void vec3_rotateX(vec3 dst, vec3 b, float c) {
+GLM_API void vec3_rotateX(vec3 dst, vec3 b, float c) {
     float p[3], r[3];
     //Translate point to the origin
     p[0] = dst[0] - b[0];
@@ -431,7 +453,7 @@ void vec3_rotateX(vec3 dst, vec3 b, float c) {
  * @param {vec3} b The origin of the rotation
  * @param {Number} c The angle of rotation
  */
-void vec3_rotateY(vec3 dst, vec3 b, float c) {
+GLM_API void vec3_rotateY(vec3 dst, vec3 b, float c) {
     float p[3], r[3];
     //Translate point to the origin
     p[0] = dst[0] - b[0];
@@ -455,7 +477,7 @@ void vec3_rotateY(vec3 dst, vec3 b, float c) {
  * @param {vec3} b The origin of the rotation
  * @param {Number} c The angle of rotation
  */
-void vec3_rotateZ(vec3 dst, vec3 b, float c) {
+GLM_API void vec3_rotateZ(vec3 dst, vec3 b, float c) {
     float p[3], r[3];
     //Translate point to the origin
     p[0] = dst[0] - b[0];
@@ -479,7 +501,7 @@ void vec3_rotateZ(vec3 dst, vec3 b, float c) {
  * @param {vec3} b The second operand
  * @returns {Number} The angle in radians
  */
-float vec3_angle(vec3 a, vec3 b) {
+GLM_API float vec3_angle(vec3 a, vec3 b) {
     float tempA[3];
     float tempB[3];
     tempA[0] = a[0], tempA[1] = a[1], tempA[2] = a[2];
@@ -507,6 +529,595 @@ float vec3_angle(vec3 a, vec3 b) {
  * @param {vec3} b The second vector.
  * @returns {Boolean} True if the vectors are equal, false otherwise.
  */
-uint8_t vec3_equals(vec3 a, vec3 b) {
+GLM_API uint8_t vec3_equals(vec3 a, vec3 b) {
     return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
 }
+
+/**
+ * Transforms an array of vec3's with a mat4.
+ * 4th vector component is implicitly '1'
+ * Gives the same result as calling vec3_transformMat4 on every element.
+ *
+ * @param {vec3[]} dst the receiving array, may be the same array as src
+ * @param {vec3[]} src the vectors to transform
+ * @param {Number} count number of vectors in src and dst
+ * @param {mat4} m matrix to transform with
+ */
+GLM_API void vec3_transformMat4_array(vec3 *dst, vec3 *src, size_t count, mat4 m) {
+    float m0 = m[0], m1 = m[1], m2 = m[2], m3 = m[3];
+    float m4 = m[4], m5 = m[5], m6 = m[6], m7 = m[7];
+    float m8 = m[8], m9 = m[9], m10 = m[10], m11 = m[11];
+    float m12 = m[12], m13 = m[13], m14 = m[14], m15 = m[15];
+    // Affine matrices always give w == 1, so the divide can be skipped entirely
+    uint8_t affine = m3 == 0 && m7 == 0 && m11 == 0 && m15 == 1;
+    size_t i = 0;
+
+#if defined(GLM_AVX2)
+    i = glm_vec3_transformMat4_array_avx2(dst[0], src[0], count, m);
+#elif defined(GLM_SSE4)
+    i = glm_vec3_transformMat4_array_sse4(dst[0], src[0], count, m);
+#elif defined(GLM_DISPATCH)
+    if (glm_dispatch.vec3_transformMat4_array) {
+        i = glm_dispatch.vec3_transformMat4_array(dst[0], src[0], count, m);
+    }
+#endif
+
+    for (; i < count; i++) {
+        float x = src[i][0], y = src[i][1], z = src[i][2];
+        float rx = m0 * x + m4 * y + m8 * z + m12;
+        float ry = m1 * x + m5 * y + m9 * z + m13;
+        float rz = m2 * x + m6 * y + m10 * z + m14;
+        if (!affine) {
+            float w = m3 * x + m7 * y + m11 * z + m15;
+            w = w ? w : 1.0;
+            rx /= w;
+            ry /= w;
+            rz /= w;
+        }
+        dst[i][0] = rx;
+        dst[i][1] = ry;
+        dst[i][2] = rz;
+    }
+}
+
+/**
+ * Transforms an array of vec3's with a mat3.
+ * Gives the same result as calling vec3_transformMat3 on every element.
+ *
+ * @param {vec3[]} dst the receiving array, may be the same array as src
+ * @param {vec3[]} src the vectors to transform
+ * @param {Number} count number of vectors in src and dst
+ * @param {mat3} m the 3x3 matrix to transform with
+ */
+GLM_API void vec3_transformMat3_array(vec3 *dst, vec3 *src, size_t count, mat3 m) {
+    float m0 = m[0], m1 = m[1], m2 = m[2];
+    float m3 = m[3], m4 = m[4], m5 = m[5];
+    float m6 = m[6], m7 = m[7], m8 = m[8];
+    size_t i = 0;
+
+#if defined(GLM_AVX2)
+    i = glm_vec3_transformMat3_array_avx2(dst[0], src[0], count, m);
+#elif defined(GLM_SSE4)
+    i = glm_vec3_transformMat3_array_sse4(dst[0], src[0], count, m);
+#elif defined(GLM_DISPATCH)
+    if (glm_dispatch.vec3_transformMat3_array) {
+        i = glm_dispatch.vec3_transformMat3_array(dst[0], src[0], count, m);
+    }
+#endif
+
+    for (; i < count; i++) {
+        float x = src[i][0], y = src[i][1], z = src[i][2];
+        dst[i][0] = x * m0 + y * m3 + z * m6;
+        dst[i][1] = x * m1 + y * m4 + z * m7;
+        dst[i][2] = x * m2 + y * m5 + z * m8;
+    }
+}
+
+/**
+ * Transforms an array of vec3's with a quat.
+ * Gives the same result as calling vec3_transformQuat on every element.
+ *
+ * @param {vec3[]} dst the receiving array, may be the same array as src
+ * @param {vec3[]} src the vectors to transform
+ * @param {Number} count number of vectors in src and dst
+ * @param {quat} q quaternion to transform with
+ */
+GLM_API void vec3_transformQuat_array(vec3 *dst, vec3 *src, size_t count, quat q) {
+    size_t i = 0;
+
+#if defined(GLM_AVX2)
+    i = glm_vec3_transformQuat_array_avx2(dst[0], src[0], count, q);
+#elif defined(GLM_SSE4)
+    i = glm_vec3_transformQuat_array_sse4(dst[0], src[0], count, q);
+#elif defined(GLM_DISPATCH)
+    if (glm_dispatch.vec3_transformQuat_array) {
+        i = glm_dispatch.vec3_transformQuat_array(dst[0], src[0], count, q);
+    }
+#endif
+
+    for (; i < count; i++) {
+        vec3_copy(dst[i], src[i]);
+        vec3_transformQuat(dst[i], q);
+    }
+}
+
+/**
+ * Normalizes an array of vec3's with the fast reciprocal square root.
+ * Matches vec3_normalizeFast on every element within its error bound,
+ * the SIMD kernels may round differently.
+ *
+ * @param {vec3[]} dst the receiving array, may be the same array as src
+ * @param {vec3[]} src the vectors to normalize
+ * @param {Number} count number of vectors in src and dst
+ */
+GLM_API void vec3_normalizeFast_array(vec3 *dst, vec3 *src, size_t count) {
+    size_t i = 0;
+
+#if defined(GLM_AVX2)
+    i = glm_vec3_normalizeFast_array_avx2(dst[0], src[0], count);
+#elif defined(GLM_SSE4)
+    i = glm_vec3_normalizeFast_array_sse4(dst[0], src[0], count);
+#elif defined(GLM_DISPATCH)
+    if (glm_dispatch.vec3_normalizeFast_array) {
+        i = glm_dispatch.vec3_normalizeFast_array(dst[0], src[0], count);
+    }
+#endif
+
+    for (; i < count; i++) {
+        float x = src[i][0], y = src[i][1], z = src[i][2];
+        float len = x*x + y*y + z*z;
+        len = len >= FLT_MIN ? glm_rsqrt(len) : 1;
+        dst[i][0] = x * len;
+        dst[i][1] = y * len;
+        dst[i][2] = z * len;
+    }
+}
+
+/**
+ * Adds two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_addTo(float *GLM_RESTRICT out, vec3 a, vec3 b) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    out[0] = a[0] + b[0];
+    out[1] = a[1] + b[1];
+    out[2] = a[2] + b[2];
+}
+
+/**
+ * Subtracts vector b from vector a
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_subtractTo(float *GLM_RESTRICT out, vec3 a, vec3 b) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    out[0] = a[0] - b[0];
+    out[1] = a[1] - b[1];
+    out[2] = a[2] - b[2];
+}
+
+/**
+ * Multiplies two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_multiplyTo(float *GLM_RESTRICT out, vec3 a, vec3 b) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    out[0] = a[0] * b[0];
+    out[1] = a[1] * b[1];
+    out[2] = a[2] * b[2];
+}
+
+/**
+ * Divides two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_divideTo(float *GLM_RESTRICT out, vec3 a, vec3 b) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    out[0] = a[0] / b[0];
+    out[1] = a[1] / b[1];
+    out[2] = a[2] / b[2];
+}
+
+/**
+ * Math.ceil the components of a vec3
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ */
+GLM_API void vec3_ceilTo(float *GLM_RESTRICT out, vec3 a) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    out[0] = ceilf(a[0]);
+    out[1] = ceilf(a[1]);
+    out[2] = ceilf(a[2]);
+}
+
+/**
+ * Math.floor the components of a vec3
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ */
+GLM_API void vec3_floorTo(float *GLM_RESTRICT out, vec3 a) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    out[0] = floorf(a[0]);
+    out[1] = floorf(a[1]);
+    out[2] = floorf(a[2]);
+}
+
+/**
+ * Returns the minimum of two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_minTo(float *GLM_RESTRICT out, vec3 a, vec3 b) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    out[0] = fmin(a[0], b[0]);
+    out[1] = fmin(a[1], b[1]);
+    out[2] = fmin(a[2], b[2]);
+}
+
+/**
+ * Returns the maximum of two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_maxTo(float *GLM_RESTRICT out, vec3 a, vec3 b) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    out[0] = fmax(a[0], b[0]);
+    out[1] = fmax(a[1], b[1]);
+    out[2] = fmax(a[2], b[2]);
+}
+
+/**
+ * Math.round the components of a vec3
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ */
+GLM_API void vec3_roundTo(float *GLM_RESTRICT out, vec3 a) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    out[0] = roundf(a[0]);
+    out[1] = roundf(a[1]);
+    out[2] = roundf(a[2]);
+}
+
+/**
+ * Scales a vec3 by a scalar number
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {Number} b amount to scale the vector by
+ */
+GLM_API void vec3_scaleTo(float *GLM_RESTRICT out, vec3 a, float b) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    out[0] = a[0] * b;
+    out[1] = a[1] * b;
+    out[2] = a[2] * b;
+}
+
+/**
+ * Adds two vec3's after scaling the second operand by a scalar value
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ * @param {Number} scale the amount to scale b by before adding
+ */
+GLM_API void vec3_scaleAndAddTo(float *GLM_RESTRICT out, vec3 a, vec3 b, float scale) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    out[0] = a[0] + (b[0] * scale);
+    out[1] = a[1] + (b[1] * scale);
+    out[2] = a[2] + (b[2] * scale);
+}
+
+/**
+ * Negates the components of a vec3
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ */
+GLM_API void vec3_negateTo(float *GLM_RESTRICT out, vec3 a) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    out[0] = -a[0];
+    out[1] = -a[1];
+    out[2] = -a[2];
+}
+
+/**
+ * Returns the inverse of the components of a vec3
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ */
+GLM_API void vec3_inverseTo(float *GLM_RESTRICT out, vec3 a) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    out[0] = 1.0 / a[0];
+    out[1] = 1.0 / a[1];
+    out[2] = 1.0 / a[2];
+}
+
+/**
+ * Normalize a vec3
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ */
+GLM_API void vec3_normalizeTo(float *GLM_RESTRICT out, vec3 a) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    float x = a[0];
+    float y = a[1];
+    float z = a[2];
+    float len = x*x + y*y + z*z;
+    // A zero length vector is copied as is, like vec3_normalize leaves it
+    len = len > GLM_NORMALIZE_MIN ? glm_normalize_rsqrt(len) : 1;
+    out[0] = a[0] * len;
+    out[1] = a[1] * len;
+    out[2] = a[2] * len;
+}
+
+/**
+ * Computes the cross product of two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ */
+GLM_API void vec3_crossTo(float *GLM_RESTRICT out, vec3 a, vec3 b) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    float ax = a[0], ay = a[1], az = a[2];
+    float bx = b[0], by = b[1], bz = b[2];
+
+    out[0] = ay * bz - az * by;
+    out[1] = az * bx - ax * bz;
+    out[2] = ax * by - ay * bx;
+}
+
+/**
+ * Performs a linear interpolation between two vec3's
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void vec3_lerpTo(float *GLM_RESTRICT out, vec3 a, vec3 b, float t) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    float ax = a[0];
+    float ay = a[1];
+    float az = a[2];
+    out[0] = ax + t * (b[0] - ax);
+    out[1] = ay + t * (b[1] - ay);
+    out[2] = az + t * (b[2] - az);
+}
+
+/**
+ * Performs a hermite interpolation with two control points
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ * @param {vec3} c the third operand
+ * @param {vec3} d the fourth operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void vec3_hermiteTo(float *GLM_RESTRICT out, vec3 a, vec3 b, vec3 c, vec3 d, float t) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    GLM_ASSERT_NOALIAS(out, 3, c, 3);
+    GLM_ASSERT_NOALIAS(out, 3, d, 3);
+    float factorTimes2 = t * t;
+    float factor1 = factorTimes2 * (2 * t - 3) + 1;
+    float factor2 = factorTimes2 * (t - 2) + t;
+    float factor3 = factorTimes2 * (t - 1);
+    float factor4 = factorTimes2 * (3 - 2 * t);
+
+    out[0] = a[0] * factor1 + b[0] * factor2 + c[0] * factor3 + d[0] * factor4;
+    out[1] = a[1] * factor1 + b[1] * factor2 + c[1] * factor3 + d[1] * factor4;
+    out[2] = a[2] * factor1 + b[2] * factor2 + c[2] * factor3 + d[2] * factor4;
+}
+
+/**
+ * Performs a bezier interpolation with two control points
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b the second operand
+ * @param {vec3} c the third operand
+ * @param {vec3} d the fourth operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void vec3_bezierTo(float *GLM_RESTRICT out, vec3 a, vec3 b, vec3 c, vec3 d, float t) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    GLM_ASSERT_NOALIAS(out, 3, c, 3);
+    GLM_ASSERT_NOALIAS(out, 3, d, 3);
+    float inverseFactor = 1 - t;
+    float inverseFactorTimesTwo = inverseFactor * inverseFactor;
+    float factorTimes2 = t * t;
+    float factor1 = inverseFactorTimesTwo * inverseFactor;
+    float factor2 = 3 * t * inverseFactorTimesTwo;
+    float factor3 = 3 * factorTimes2 * inverseFactor;
+    float factor4 = factorTimes2 * t;
+
+    out[0] = a[0] * factor1 + b[0] * factor2 + c[0] * factor3 + d[0] * factor4;
+    out[1] = a[1] * factor1 + b[1] * factor2 + c[1] * factor3 + d[1] * factor4;
+    out[2] = a[2] * factor1 + b[2] * factor2 + c[2] * factor3 + d[2] * factor4;
+}
+
+/**
+ * Transforms the vec3 with a mat4.
+ * 4th vector component is implicitly '1'
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {mat4} m matrix to transform with
+ */
+GLM_API void vec3_transformMat4To(float *GLM_RESTRICT out, vec3 a, mat4 m) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, m, 16);
+    float x = a[0], y = a[1], z = a[2];
+    float w = m[3] * x + m[7] * y + m[11] * z + m[15];
+    w = w ? w : 1.0;
+    out[0] = (m[0] * x + m[4] * y + m[8] * z + m[12]) / w;
+    out[1] = (m[1] * x + m[5] * y + m[9] * z + m[13]) / w;
+    out[2] = (m[2] * x + m[6] * y + m[10] * z + m[14]) / w;
+}
+
+/**
+ * Transforms the vec3 with a mat3.
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {mat3} m the 3x3 matrix to transform with
+ */
+GLM_API void vec3_transformMat3To(float *GLM_RESTRICT out, vec3 a, mat3 m) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, m, 9);
+    float x = a[0], y = a[1], z = a[2];
+    out[0] = x * m[0] + y * m[3] + z * m[6];
+    out[1] = x * m[1] + y * m[4] + z * m[7];
+    out[2] = x * m[2] + y * m[5] + z * m[8];
+}
+
+/**
+ * Transforms the vec3 with a quat
+ * Can also be used for dual quaternions. (Multiply it with the real part)
+ *
+ * @param {vec3} out the receiving vector, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {quat} q quaternion to transform with
+ */
+GLM_API void vec3_transformQuatTo(float *GLM_RESTRICT out, vec3 a, quat q) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, q, 4);
+    // benchmarks: https://jsperf.com/quaternion-transform-vec3-implementations-fixed
+    float qx = q[0], qy = q[1], qz = q[2], qw = q[3];
+    float x = a[0], y = a[1], z = a[2];
+    // var qvec = [qx, qy, qz];
+    // var uv = vec3.cross([], qvec, a);
+    float uvx = qy * z - qz * y,
+        uvy = qz * x - qx * z,
+        uvz = qx * y - qy * x;
+    // var uuv = vec3.cross([], qvec, uv);
+    float uuvx = qy * uvz - qz * uvy,
+        uuvy = qz * uvx - qx * uvz,
+        uuvz = qx * uvy - qy * uvx;
+    // vec3.scale(uv, uv, 2 * w);
+    float w2 = qw * 2;
+    uvx *= w2;
+    uvy *= w2;
+    uvz *= w2;
+    // vec3.scale(uuv, uuv, 2);
+    uuvx *= 2;
+    uuvy *= 2;
+    uuvz *= 2;
+    // return vec3.add(vec3 dst, a, vec3.add(vec3 dst, uv, uuv));
+    out[0] = x + uvx + uuvx;
+    out[1] = y + uvy + uuvy;
+    out[2] = z + uvz + uuvz;
+}
+
+/**
+ * Rotate a 3D vector around the x-axis
+ * @param {vec3} out The receiving vec3, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b The origin of the rotation
+ * @param {Number} c The angle of rotation
+ */
+GLM_API void vec3_rotateXTo(float *GLM_RESTRICT out, vec3 a, vec3 b, float c) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    float p[3], r[3];
+    //Translate point to the origin
+    p[0] = a[0] - b[0];
+    p[1] = a[1] - b[1];
+    p[2] = a[2] - b[2];
+
+    //perform rotation
+    r[0] = p[0];
+    r[1] = p[1]*cosf(c) - p[2]*sinf(c);
+    r[2] = p[1]*sinf(c) + p[2]*cosf(c);
+
+    //translate to correct position
+    out[0] = r[0] + b[0];
+    out[1] = r[1] + b[1];
+    out[2] = r[2] + b[2];
+}
+
+/**
+ * Rotate a 3D vector around the y-axis
+ * @param {vec3} out The receiving vec3, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b The origin of the rotation
+ * @param {Number} c The angle of rotation
+ */
+GLM_API void vec3_rotateYTo(float *GLM_RESTRICT out, vec3 a, vec3 b, float c) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    float p[3], r[3];
+    //Translate point to the origin
+    p[0] = a[0] - b[0];
+    p[1] = a[1] - b[1];
+    p[2] = a[2] - b[2];
+
+    //perform rotation
+    r[0] = p[2]*sinf(c) + p[0]*cosf(c);
+    r[1] = p[1];
+    r[2] = p[2]*cosf(c) - p[0]*sinf(c);
+
+    //translate to correct position
+    out[0] = r[0] + b[0];
+    out[1] = r[1] + b[1];
+    out[2] = r[2] + b[2];
+}
+
+/**
+ * Rotate a 3D vector around the z-axis
+ * @param {vec3} out The receiving vec3, must not overlap the other arguments
+ * @param {vec3} a the source vector
+ * @param {vec3} b The origin of the rotation
+ * @param {Number} c The angle of rotation
+ */
+GLM_API void vec3_rotateZTo(float *GLM_RESTRICT out, vec3 a, vec3 b, float c) {
+    GLM_ASSERT_NOALIAS(out, 3, a, 3);
+    GLM_ASSERT_NOALIAS(out, 3, b, 3);
+    float p[3], r[3];
+    //Translate point to the origin
+    p[0] = a[0] - b[0];
+    p[1] = a[1] - b[1];
+    p[2] = a[2] - b[2];
+
+    //perform rotation
+    r[0] = p[0]*cosf(c) - p[1]*sinf(c);
+    r[1] = p[0]*sinf(c) + p[1]*cosf(c);
+    r[2] = p[2];
+
+    //translate to correct position
+    out[0] = r[0] + b[0];
+    out[1] = r[1] + b[1];
+    out[2] = r[2] + b[2];
+}
@@ -0,0 +1,362 @@
+#include "vec3soa.h"
+#include "vec3.h"
+#include "simd.h"
+#include <math.h>
+#include <string.h>
+
+/**
+ * Returns the count rounded up to a multiple of VEC3SOA_PADDING
+ *
+ * @param {Number} count number of vectors
+ * @returns {Number} padded number of vectors
+ */
+GLM_API size_t vec3soa_paddedCount(size_t count) {
+    return (count + VEC3SOA_PADDING - 1) & ~(size_t)(VEC3SOA_PADDING - 1);
+}
+
+/**
+ * Returns the number of floats a buffer needs to hold count vectors
+ *
+ * @param {Number} count number of vectors
+ * @returns {Number} buffer size in floats
+ */
+GLM_API size_t vec3soa_bufferSize(size_t count) {
+    return 3 * vec3soa_paddedCount(count);
+}
+
+/**
+ * Sets up a vec3soa on top of a caller provided buffer and zeroes it.
+ * The buffer must be aligned to VEC3SOA_ALIGNMENT bytes and hold at
+ * least vec3soa_bufferSize(count) floats.
+ *
+ * @param {vec3soa} dst the stream to set up
+ * @param {float[]} buffer storage for the components
+ * @param {Number} count number of vectors
+ */
+GLM_API void vec3soa_init(vec3soa *dst, float *buffer, size_t count) {
+    size_t n = vec3soa_paddedCount(count);
+    dst->x = buffer;
+    dst->y = buffer + n;
+    dst->z = buffer + 2 * n;
+    dst->count = count;
+    memset(buffer, 0, 3 * n * sizeof(float));
+}
+
+/**
+ * Copies an array of vec3's into a vec3soa
+ *
+ * @param {vec3soa} dst the receiving stream, dst->count vectors are read
+ * @param {vec3[]} src the source vectors
+ */
+GLM_API void vec3soa_fromVec3Array(vec3soa *dst, vec3 *src) {
+    size_t i = 0, count = dst->count;
+
+#if defined(GLM_AVX2)
+    for (; i < (count & ~(size_t)7); i += 8) {
+        __m256 x, y, z;
+        glm_vec3_load8_avx2(src[i], &x, &y, &z);
+        _mm256_store_ps(dst->x + i, x);
+        _mm256_store_ps(dst->y + i, y);
+        _mm256_store_ps(dst->z + i, z);
+    }
+#endif
+#if defined(GLM_SSE4)
+    for (; i < (count & ~(size_t)3); i += 4) {
+        __m128 x, y, z;
+        glm_vec3_load4_sse4(src[i], &x, &y, &z);
+        _mm_store_ps(dst->x + i, x);
+        _mm_store_ps(dst->y + i, y);
+        _mm_store_ps(dst->z + i, z);
+    }
+#endif
+    for (; i < count; i++) {
+        dst->x[i] = src[i][0];
+        dst->y[i] = src[i][1];
+        dst->z[i] = src[i][2];
+    }
+}
+
+/**
+ * Copies a vec3soa into an array of vec3's
+ *
+ * @param {vec3[]} dst the receiving array, must hold src->count vectors
+ * @param {vec3soa} src the source stream
+ */
+GLM_API void vec3soa_toVec3Array(vec3 *dst, vec3soa *src) {
+    size_t i = 0, count = src->count;
+
+#if defined(GLM_AVX2)
+    for (; i < (count & ~(size_t)7); i += 8) {
+        glm_vec3_store8_avx2(dst[i], _mm256_load_ps(src->x + i), _mm256_load_ps(src->y + i), _mm256_load_ps(src->z + i));
+    }
+#endif
+#if defined(GLM_SSE4)
+    for (; i < (count & ~(size_t)3); i += 4) {
+        glm_vec3_store4_sse4(dst[i], _mm_load_ps(src->x + i), _mm_load_ps(src->y + i), _mm_load_ps(src->z + i));
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i][0] = src->x[i];
+        dst[i][1] = src->y[i];
+        dst[i][2] = src->z[i];
+    }
+}
+
+/**
+ * Adds two streams of vec3's
+ *
+ * @param {vec3soa} dst the receiving stream
+ * @param {vec3soa} b the second operand
+ */
+GLM_API void vec3soa_add(vec3soa *dst, vec3soa *b) {
+    size_t i;
+#if defined(GLM_VF_WIDTH)
+    size_t n = vec3soa_paddedCount(dst->count);
+    for (i = 0; i < n; i += GLM_VF_WIDTH) {
+        glm_vf_store(dst->x + i, glm_vf_add(glm_vf_load(dst->x + i), glm_vf_load(b->x + i)));
+        glm_vf_store(dst->y + i, glm_vf_add(glm_vf_load(dst->y + i), glm_vf_load(b->y + i)));
+        glm_vf_store(dst->z + i, glm_vf_add(glm_vf_load(dst->z + i), glm_vf_load(b->z + i)));
+    }
+#else
+    for (i = 0; i < dst->count; i++) {
+        dst->x[i] = dst->x[i] + b->x[i];
+        dst->y[i] = dst->y[i] + b->y[i];
+        dst->z[i] = dst->z[i] + b->z[i];
+    }
+#endif
+}
+
+/**
+ * Adds two streams of vec3's after scaling the second operand by a scalar value
+ *
+ * @param {vec3soa} dst the receiving stream
+ * @param {vec3soa} b the second operand
+ * @param {Number} scale the amount to scale b by before adding
+ */
+GLM_API void vec3soa_scaleAndAdd(vec3soa *dst, vec3soa *b, float scale) {
+    size_t i;
+#if defined(GLM_VF_WIDTH)
+    size_t n = vec3soa_paddedCount(dst->count);
+    glm_vf s = glm_vf_set1(scale);
+    for (i = 0; i < n; i += GLM_VF_WIDTH) {
+        glm_vf_store(dst->x + i, glm_vf_madd(glm_vf_load(b->x + i), s, glm_vf_load(dst->x + i)));
+        glm_vf_store(dst->y + i, glm_vf_madd(glm_vf_load(b->y + i), s, glm_vf_load(dst->y + i)));
+        glm_vf_store(dst->z + i, glm_vf_madd(glm_vf_load(b->z + i), s, glm_vf_load(dst->z + i)));
+    }
+#else
+    for (i = 0; i < dst->count; i++) {
+        dst->x[i] = dst->x[i] + (b->x[i] * scale);
+        dst->y[i] = dst->y[i] + (b->y[i] * scale);
+        dst->z[i] = dst->z[i] + (b->z[i] * scale);
+    }
+#endif
+}
+
+/**
+ * Normalizes every vec3 of a stream
+ *
+ * @param {vec3soa} dst the receiving stream
+ */
+GLM_API void vec3soa_normalize(vec3soa *dst) {
+    size_t i;
+#if defined(GLM_VF_WIDTH)
+    size_t n = vec3soa_paddedCount(dst->count);
+    glm_vf one = glm_vf_set1(1), min = glm_vf_set1(GLM_NORMALIZE_MIN);
+    for (i = 0; i < n; i += GLM_VF_WIDTH) {
+        glm_vf x = glm_vf_load(dst->x + i);
+        glm_vf y = glm_vf_load(dst->y + i);
+        glm_vf z = glm_vf_load(dst->z + i);
+        glm_vf len = glm_vf_add(glm_vf_add(glm_vf_mul(x, x), glm_vf_mul(y, y)), glm_vf_mul(z, z));
+        // Zero length vectors are left untouched, like vec3_normalize
+#if defined(GLM_FAST_RSQRT)
+        glm_vf inv = glm_vf_blend(one, glm_vf_rsqrt(len), glm_vf_cmpgt(len, min));
+#else
+        glm_vf inv = glm_vf_blend(one, glm_vf_div(one, glm_vf_sqrt(len)), glm_vf_cmpgt(len, min));
+#endif
+        glm_vf_store(dst->x + i, glm_vf_mul(x, inv));
+        glm_vf_store(dst->y + i, glm_vf_mul(y, inv));
+        glm_vf_store(dst->z + i, glm_vf_mul(z, inv));
+    }
+#else
+    for (i = 0; i < dst->count; i++) {
+        float x = dst->x[i], y = dst->y[i], z = dst->z[i];
+        float len = x*x + y*y + z*z;
+        if (len > GLM_NORMALIZE_MIN) {
+            len = glm_normalize_rsqrt(len);
+            dst->x[i] = x * len;
+            dst->y[i] = y * len;
+            dst->z[i] = z * len;
+        }
+    }
+#endif
+}
+
+/**
+ * Normalizes every vec3 of a stream with the fast reciprocal square root,
+ * see vec3_normalizeFast
+ *
+ * @param {vec3soa} dst the receiving stream
+ */
+GLM_API void vec3soa_normalizeFast(vec3soa *dst) {
+    size_t i;
+#if defined(GLM_VF_WIDTH)
+    size_t n = vec3soa_paddedCount(dst->count);
+    glm_vf one = glm_vf_set1(1), tiny = glm_vf_set1(FLT_MIN);
+    for (i = 0; i < n; i += GLM_VF_WIDTH) {
+        glm_vf x = glm_vf_load(dst->x + i);
+        glm_vf y = glm_vf_load(dst->y + i);
+        glm_vf z = glm_vf_load(dst->z + i);
+        glm_vf len = glm_vf_madd(z, z, glm_vf_madd(y, y, glm_vf_mul(x, x)));
+        glm_vf inv = glm_vf_blend(one, glm_vf_rsqrt(len), glm_vf_cmpge(len, tiny));
+        glm_vf_store(dst->x + i, glm_vf_mul(x, inv));
+        glm_vf_store(dst->y + i, glm_vf_mul(y, inv));
+        glm_vf_store(dst->z + i, glm_vf_mul(z, inv));
+    }
+#else
+    for (i = 0; i < dst->count; i++) {
+        float x = dst->x[i], y = dst->y[i], z = dst->z[i];
+        float len = x*x + y*y + z*z;
+        if (len >= FLT_MIN) {
+            len = glm_rsqrt(len);
+            dst->x[i] = x * len;
+            dst->y[i] = y * len;
+            dst->z[i] = z * len;
+        }
+    }
+#endif
+}
+
+/**
+ * Calculates the dot products of two streams of vec3's
+ *
+ * @param {float[]} dst receives the dot products, must be aligned to
+ *                  VEC3SOA_ALIGNMENT bytes and hold vec3soa_paddedCount(a->count) floats
+ * @param {vec3soa} a the first operand
+ * @param {vec3soa} b the second operand
+ */
+GLM_API void vec3soa_dot(float *dst, vec3soa *a, vec3soa *b) {
+    size_t i;
+#if defined(GLM_VF_WIDTH)
+    size_t n = vec3soa_paddedCount(a->count);
+    for (i = 0; i < n; i += GLM_VF_WIDTH) {
+        glm_vf r = glm_vf_mul(glm_vf_load(a->x + i), glm_vf_load(b->x + i));
+        r = glm_vf_madd(glm_vf_load(a->y + i), glm_vf_load(b->y + i), r);
+        r = glm_vf_madd(glm_vf_load(a->z + i), glm_vf_load(b->z + i), r);
+        glm_vf_store(dst + i, r);
+    }
+#else
+    for (i = 0; i < a->count; i++) {
+        dst[i] = a->x[i] * b->x[i] + a->y[i] * b->y[i] + a->z[i] * b->z[i];
+    }
+#endif
+}
+
+/**
+ * Computes the cross products of two streams of vec3's
+ *
+ * @param {vec3soa} dst the receiving stream
+ * @param {vec3soa} b the second operand
+ */
+GLM_API void vec3soa_cross(vec3soa *dst, vec3soa *b) {
+    size_t i;
+#if defined(GLM_VF_WIDTH)
+    size_t n = vec3soa_paddedCount(dst->count);
+    for (i = 0; i < n; i += GLM_VF_WIDTH) {
+        glm_vf ax = glm_vf_load(dst->x + i), ay = glm_vf_load(dst->y + i), az = glm_vf_load(dst->z + i);
+        glm_vf bx = glm_vf_load(b->x + i), by = glm_vf_load(b->y + i), bz = glm_vf_load(b->z + i);
+        glm_vf_store(dst->x + i, glm_vf_sub(glm_vf_mul(ay, bz), glm_vf_mul(az, by)));
+        glm_vf_store(dst->y + i, glm_vf_sub(glm_vf_mul(az, bx), glm_vf_mul(ax, bz)));
+        glm_vf_store(dst->z + i, glm_vf_sub(glm_vf_mul(ax, by), glm_vf_mul(ay, bx)));
+    }
+#else
+    for (i = 0; i < dst->count; i++) {
+        float ax = dst->x[i], ay = dst->y[i], az = dst->z[i];
+        float bx = b->x[i], by = b->y[i], bz = b->z[i];
+        dst->x[i] = ay * bz - az * by;
+        dst->y[i] = az * bx - ax * bz;
+        dst->z[i] = ax * by - ay * bx;
+    }
+#endif
+}
+
+/**
+ * Performs a linear interpolation between two streams of vec3's
+ *
+ * @param {vec3soa} dst the receiving stream
+ * @param {vec3soa} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void vec3soa_lerp(vec3soa *dst, vec3soa *b, float t) {
+    size_t i;
+#if defined(GLM_VF_WIDTH)
+    size_t n = vec3soa_paddedCount(dst->count);
+    glm_vf vt = glm_vf_set1(t);
+    for (i = 0; i < n; i += GLM_VF_WIDTH) {
+        glm_vf ax = glm_vf_load(dst->x + i), ay = glm_vf_load(dst->y + i), az = glm_vf_load(dst->z + i);
+        glm_vf_store(dst->x + i, glm_vf_madd(vt, glm_vf_sub(glm_vf_load(b->x + i), ax), ax));
+        glm_vf_store(dst->y + i, glm_vf_madd(vt, glm_vf_sub(glm_vf_load(b->y + i), ay), ay));
+        glm_vf_store(dst->z + i, glm_vf_madd(vt, glm_vf_sub(glm_vf_load(b->z + i), az), az));
+    }
+#else
+    for (i = 0; i < dst->count; i++) {
+        float ax = dst->x[i], ay = dst->y[i], az = dst->z[i];
+        dst->x[i] = ax + t * (b->x[i] - ax);
+        dst->y[i] = ay + t * (b->y[i] - ay);
+        dst->z[i] = az + t * (b->z[i] - az);
+    }
+#endif
+}
+
+/**
+ * Transforms every vec3 of a stream with a mat4.
+ * 4th vector component is implicitly '1'
+ *
+ * @param {vec3soa} dst the receiving stream
+ * @param {mat4} m matrix to transform with
+ */
+GLM_API void vec3soa_transformMat4(vec3soa *dst, mat4 m) {
+    uint8_t affine = m[3] == 0 && m[7] == 0 && m[11] == 0 && m[15] == 1;
+    size_t i;
+#if defined(GLM_VF_WIDTH)
+    size_t n = vec3soa_paddedCount(dst->count);
+    glm_vf c0 = glm_vf_set1(m[0]), c1 = glm_vf_set1(m[1]), c2 = glm_vf_set1(m[2]), c3 = glm_vf_set1(m[3]);
+    glm_vf c4 = glm_vf_set1(m[4]), c5 = glm_vf_set1(m[5]), c6 = glm_vf_set1(m[6]), c7 = glm_vf_set1(m[7]);
+    glm_vf c8 = glm_vf_set1(m[8]), c9 = glm_vf_set1(m[9]), c10 = glm_vf_set1(m[10]), c11 = glm_vf_set1(m[11]);
+    glm_vf c12 = glm_vf_set1(m[12]), c13 = glm_vf_set1(m[13]), c14 = glm_vf_set1(m[14]), c15 = glm_vf_set1(m[15]);
+    glm_vf one = glm_vf_set1(1), zero = glm_vf_zero();
+
+    for (i = 0; i < n; i += GLM_VF_WIDTH) {
+        glm_vf x = glm_vf_load(dst->x + i), y = glm_vf_load(dst->y + i), z = glm_vf_load(dst->z + i);
+        glm_vf rx = glm_vf_add(glm_vf_madd(c8, z, glm_vf_madd(c4, y, glm_vf_mul(c0, x))), c12);
+        glm_vf ry = glm_vf_add(glm_vf_madd(c9, z, glm_vf_madd(c5, y, glm_vf_mul(c1, x))), c13);
+        glm_vf rz = glm_vf_add(glm_vf_madd(c10, z, glm_vf_madd(c6, y, glm_vf_mul(c2, x))), c14);
+        if (!affine) {
+            glm_vf w = glm_vf_add(glm_vf_madd(c11, z, glm_vf_madd(c7, y, glm_vf_mul(c3, x))), c15);
+            w = glm_vf_blend(w, one, glm_vf_cmpeq(w, zero));
+            rx = glm_vf_div(rx, w);
+            ry = glm_vf_div(ry, w);
+            rz = glm_vf_div(rz, w);
+        }
+        glm_vf_store(dst->x + i, rx);
+        glm_vf_store(dst->y + i, ry);
+        glm_vf_store(dst->z + i, rz);
+    }
+#else
+    for (i = 0; i < dst->count; i++) {
+        float x = dst->x[i], y = dst->y[i], z = dst->z[i];
+        float rx = m[0] * x + m[4] * y + m[8] * z + m[12];
+        float ry = m[1] * x + m[5] * y + m[9] * z + m[13];
+        float rz = m[2] * x + m[6] * y + m[10] * z + m[14];
+        if (!affine) {
+            float w = m[3] * x + m[7] * y + m[11] * z + m[15];
+            w = w ? w : 1.0;
+            rx /= w;
+            ry /= w;
+            rz /= w;
+        }
+        dst->x[i] = rx;
+        dst->y[i] = ry;
+        dst->z[i] = rz;
+    }
+#endif
+}
@@ -1,4 +1,6 @@
 #include "vec4.h"
+#include "noalias.h"
+#include "simd.h"
 #include <math.h>
 
 /**
@@ -7,7 +9,7 @@
  * @param {vec4} out the receiving vector
  * @param {vec4} a the source vector
  */
-void vec4_copy(vec4 dst, vec4 a) {
+GLM_API void vec4_copy(vec4 dst, vec4 a) {
     dst[0] = a[0];
     dst[1] = a[1];
     dst[2] = a[2];
@@ -23,7 +25,7 @@ void vec4_copy(vec4 dst, vec4 a) {
  * @param {Number} z Z component
  * @param {Number} w W component
  */
-void vec4_set(vec4 dst, float x, float y, float z, float w) {
+GLM_API void vec4_set(vec4 dst, float x, float y, float z, float w) {
     dst[0] = x;
     dst[1] = y;
     dst[2] = z;
@@ -37,7 +39,7 @@ void vec4_set(vec4 dst, float x, float y, float z, float w) {
  * @param {vec4} a the first operand
  * @param {vec4} b the second operand
  */
-void vec4_add(vec4 dst, vec4 b) {
+GLM_API void vec4_add(vec4 dst, vec4 b) {
     dst[0] = dst[0] + b[0];
     dst[1] = dst[1] + b[1];
     dst[2] = dst[2] + b[2];
@@ -51,7 +53,7 @@ void vec4_add(vec4 dst, vec4 b) {
  * @param {vec4} a the first operand
  * @param {vec4} b the second operand
  */
-void vec4_subtract(vec4 dst, vec4 b) {
+GLM_API void vec4_subtract(vec4 dst, vec4 b) {
     dst[0] = dst[0] - b[0];
     dst[1] = dst[1] - b[1];
     dst[2] = dst[2] - b[2];
@@ -65,7 +67,7 @@ void vec4_subtract(vec4 dst, vec4 b) {
  * @param {vec4} a the first operand
  * @param {vec4} b the second operand
  */
-void vec4_multiply(vec4 dst, vec4 b) {
+GLM_API void vec4_multiply(vec4 dst, vec4 b) {
     dst[0] = dst[0] * b[0];
     dst[1] = dst[1] * b[1];
     dst[2] = dst[2] * b[2];
@@ -79,7 +81,7 @@ void vec4_multiply(vec4 dst, vec4 b) {
  * @param {vec4} a the first operand
  * @param {vec4} b the second operand
  */
-void vec4_divide(vec4 dst, vec4 b) {
+GLM_API void vec4_divide(vec4 dst, vec4 b) {
     dst[0] = dst[0] / b[0];
     dst[1] = dst[1] / b[1];
     dst[2] = dst[2] / b[2];
@@ -92,7 +94,7 @@ void vec4_divide(vec4 dst, vec4 b) {
  * @param {vec4} out the receiving vector
  * @param {vec4} a vector to ceil
  */
-void vec4_ceil(vec4 dst) {
+GLM_API void vec4_ceil(vec4 dst) {
     dst[0] = ceilf(dst[0]);
     dst[1] = ceilf(dst[1]);
     dst[2] = ceilf(dst[2]);
@@ -105,7 +107,7 @@ void vec4_ceil(vec4 dst) {
  * @param {vec4} out the receiving vector
  * @param {vec4} a vector to floor
  */
-void vec4_floor(vec4 dst) {
+GLM_API void vec4_floor(vec4 dst) {
     dst[0] = floorf(dst[0]);
     dst[1] = floorf(dst[1]);
     dst[2] = floorf(dst[2]);
@@ -119,7 +121,7 @@ void vec4_floor(vec4 dst) {
  * @param {vec4} a the first operand
  * @param {vec4} b the second operand
  */
-void vec4_min(vec4 dst, vec4 b) {
+GLM_API void vec4_min(vec4 dst, vec4 b) {
     dst[0] = fmin(dst[0], b[0]);
     dst[1] = fmin(dst[1], b[1]);
     dst[2] = fmin(dst[2], b[2]);
@@ -133,7 +135,7 @@ void vec4_min(vec4 dst, vec4 b) {
  * @param {vec4} a the first operand
  * @param {vec4} b the second operand
  */
-void vec4_max(vec4 dst, vec4 b) {
+GLM_API void vec4_max(vec4 dst, vec4 b) {
     dst[0] = fmax(dst[0], b[0]);
     dst[1] = fmax(dst[1], b[1]);
     dst[2] = fmax(dst[2], b[2]);
@@ -146,7 +148,7 @@ void vec4_max(vec4 dst, vec4 b) {
  * @param {vec4} out the receiving vector
  * @param {vec4} a vector to round
  */
-void vec4_round(vec4 dst) {
+GLM_API void vec4_round(vec4 dst) {
     dst[0] = roundf(dst[0]);
     dst[1] = roundf(dst[1]);
     dst[2] = roundf(dst[2]);
@@ -160,7 +162,7 @@ void vec4_round(vec4 dst) {
  * @param {vec4} a the vector to scale
  * @param {Number} b amount to scale the vector by
  */
-void vec4_scale(vec4 dst, float b) {
+GLM_API void vec4_scale(vec4 dst, float b) {
     dst[0] = dst[0] * b;
     dst[1] = dst[1] * b;
     dst[2] = dst[2] * b;
@@ -174,7 +176,7 @@ void vec4_scale(vec4 dst, float b) {
  * @param {vec4} b the second operand
  * @param {Number} scale the amount to scale b by before adding
  */
-void vec4_scaleAndAdd(vec4 dst, vec4 b, float scale) {
+GLM_API void vec4_scaleAndAdd(vec4 dst, vec4 b, float scale) {
     dst[0] = dst[0] + (b[0] * scale);
     dst[1] = dst[1] + (b[1] * scale);
     dst[2] = dst[2] + (b[2] * scale);
@@ -188,7 +190,7 @@ void vec4_scaleAndAdd(vec4 dst, vec4 b, float scale) {
  * @param {vec4} b the second operand
  * @returns {Number} distance between a and b
  */
-float vec4_distance(vec4 a, vec4 b) {
+GLM_API float vec4_distance(vec4 a, vec4 b) {
     float x = b[0] - a[0];
     float y = b[1] - a[1];
     float z = b[2] - a[2];
@@ -203,7 +205,7 @@ float vec4_distance(vec4 a, vec4 b) {
  * @param {vec4} b the second operand
  * @returns {Number} squared distance between a and b
  */
-float vec4_squaredDistance(vec4 a, vec4 b) {
+GLM_API float vec4_squaredDistance(vec4 a, vec4 b) {
     float x = b[0] - a[0];
     float y = b[1] - a[1];
     float z = b[2] - a[2];
@@ -217,7 +219,7 @@ float vec4_squaredDistance(vec4 a, vec4 b) {
  * @param {vec4} a vector to calculate length of
  * @returns {Number} length of a
  */
-float vec4_length(vec4 a) {
+GLM_API float vec4_length(vec4 a) {
     float x = a[0];
     float y = a[1];
     float z = a[2];
@@ -231,7 +233,7 @@ float vec4_length(vec4 a) {
  * @param {vec4} a vector to calculate squared length of
  * @returns {Number} squared length of a
  */
-float vec4_squaredLength(vec4 a) {
+GLM_API float vec4_squaredLength(vec4 a) {
     float x = a[0];
     float y = a[1];
     float z = a[2];
@@ -245,7 +247,7 @@ float vec4_squaredLength(vec4 a) {
  * @param {vec4} out the receiving vector
  * @param {vec4} a vector to negate
  */
-void vec4_negate(vec4 dst) {
+GLM_API void vec4_negate(vec4 dst) {
     dst[0] = -dst[0];
     dst[1] = -dst[1];
     dst[2] = -dst[2];
@@ -258,7 +260,7 @@ void vec4_negate(vec4 dst) {
  * @param {vec4} out the receiving vector
  * @param {vec4} a vector to invert
  */
-void vec4_inverse(vec4 dst) {
+GLM_API void vec4_inverse(vec4 dst) {
     dst[0] = 1.0 / dst[0];
     dst[1] = 1.0 / dst[1];
     dst[2] = 1.0 / dst[2];
@@ -271,14 +273,14 @@ void vec4_inverse(vec4 dst) {
  * @param {vec4} out the receiving vector
  * @param {vec4} a vector to normalize
  */
-void vec4_normalize(vec4 dst) {
+GLM_API void vec4_normalize(vec4 dst) {
     float x = dst[0];
     float y = dst[1];
     float z = dst[2];
     float w = dst[3];
     float len = x*x + y*y + z*z + w*w;
-    if (len > 0) {
-        len = 1 / sqrtf(len);
+    if (len > GLM_NORMALIZE_MIN) {
+        len = glm_normalize_rsqrt(len);
         dst[0] = x * len;
         dst[1] = y * len;
         dst[2] = z * len;
@@ -286,6 +288,60 @@ void vec4_normalize(vec4 dst) {
     }
 }
 
+/**
+ * Normalize a vec4 with the fast reciprocal square root: the hardware
+ * estimate and one Newton-Raphson step with SSE4/AVX2, within 2^-21
+ * relative of vec4_normalize. Plain C builds compute it exactly.
+ * Vectors with a squared length below FLT_MIN are left as they are.
+ *
+ * @param {vec4} out the receiving vector
+ */
+GLM_API void vec4_normalizeFast(vec4 dst) {
+    float x = dst[0], y = dst[1], z = dst[2], w = dst[3];
+    float len = x*x + y*y + z*z + w*w;
+    if (len >= FLT_MIN) {
+        len = glm_rsqrt(len);
+        dst[0] = x * len;
+        dst[1] = y * len;
+        dst[2] = z * len;
+        dst[3] = w * len;
+    }
+}
+
+/**
+ * Normalizes an array of vec4's with the fast reciprocal square root,
+ * eg. a pose of quats after blending.
+ * Matches vec4_normalizeFast on every element within its error bound,
+ * the SIMD kernels may round differently.
+ *
+ * @param {vec4[]} dst the receiving array, may be the same array as src
+ * @param {vec4[]} src the vectors to normalize
+ * @param {Number} count number of vectors in src and dst
+ */
+GLM_API void vec4_normalizeFast_array(vec4 *dst, vec4 *src, size_t count) {
+    size_t i = 0;
+
+#if defined(GLM_AVX2)
+    i = glm_vec4_normalizeFast_array_avx2(dst[0], src[0], count);
+#elif defined(GLM_SSE4)
+    i = glm_vec4_normalizeFast_array_sse4(dst[0], src[0], count);
+#elif defined(GLM_DISPATCH)
+    if (glm_dispatch.vec4_normalizeFast_array) {
+        i = glm_dispatch.vec4_normalizeFast_array(dst[0], src[0], count);
+    }
+#endif
+
+    for (; i < count; i++) {
+        float x = src[i][0], y = src[i][1], z = src[i][2], w = src[i][3];
+        float len = x*x + y*y + z*z + w*w;
+        len = len >= FLT_MIN ? glm_rsqrt(len) : 1;
+        dst[i][0] = x * len;
+        dst[i][1] = y * len;
+        dst[i][2] = z * len;
+        dst[i][3] = w * len;
+    }
+}
+
 /**
  * Calculates the dot product of two vec4's
  *
@@ -293,7 +349,7 @@ void vec4_normalize(vec4 dst) {
  * @param {vec4} b the second operand
  * @returns {Number} dot product of a and b
  */
-float vec4_dot(vec4 a, vec4 b) {
+GLM_API float vec4_dot(vec4 a, vec4 b) {
     return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
 }
 
@@ -304,7 +360,7 @@ float vec4_dot(vec4 a, vec4 b) {
  * @param {vec4} b the second operand
  * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
  */
-void vec4_lerp(vec4 dst, vec4 b, float t) {
+GLM_API void vec4_lerp(vec4 dst, vec4 b, float t) {
     float ax = dst[0];
     float ay = dst[1];
     float az = dst[2];
@@ -321,7 +377,7 @@ void vec4_lerp(vec4 dst, vec4 b, float t) {
  * @param {vec4} out the receiving vector
  * @param {mat4} m matrix to transform with
  */
-void vec4_transformMat4(vec4 dst, mat4 m) {
+GLM_API void vec4_transformMat4(vec4 dst, mat4 m) {
     float x = dst[0], y = dst[1], z = dst[2], w = dst[3];
     dst[0] = m[0] * x + m[4] * y + m[8] * z + m[12] * w;
     dst[1] = m[1] * x + m[5] * y + m[9] * z + m[13] * w;
@@ -335,7 +391,7 @@ void vec4_transformMat4(vec4 dst, mat4 m) {
  * @param {vec4} out the receiving vector
  * @param {quat} q quaternion to transform with
  */
-void vec4_transformQuat(vec4 dst, quat q) {
+GLM_API void vec4_transformQuat(vec4 dst, quat q) {
     float x = dst[0], y = dst[1], z = dst[2];
     float qx = q[0], qy = q[1], qz = q[2], qw = q[3];
 
@@ -359,6 +415,302 @@ void vec4_transformQuat(vec4 dst, quat q) {
  * @param {vec4} b The second vector.
  * @returns {Boolean} True if the vectors are equal, false otherwise.
  */
-uint8_t vec4_equals(vec4 a, vec4 b) {
+GLM_API uint8_t vec4_equals(vec4 a, vec4 b) {
     return a[0] == b[0] && a[1] == b[1] && a[2] == b[2] && a[3] == b[3];
 }
+
+/**
+ * Adds two vec4's
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the first operand
+ * @param {vec4} b the second operand
+ */
+GLM_API void vec4_addTo(float *GLM_RESTRICT out, vec4 a, vec4 b) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    out[0] = a[0] + b[0];
+    out[1] = a[1] + b[1];
+    out[2] = a[2] + b[2];
+    out[3] = a[3] + b[3];
+}
+
+/**
+ * Subtracts vector b from vector a
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the first operand
+ * @param {vec4} b the second operand
+ */
+GLM_API void vec4_subtractTo(float *GLM_RESTRICT out, vec4 a, vec4 b) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    out[0] = a[0] - b[0];
+    out[1] = a[1] - b[1];
+    out[2] = a[2] - b[2];
+    out[3] = a[3] - b[3];
+}
+
+/**
+ * Multiplies two vec4's
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the first operand
+ * @param {vec4} b the second operand
+ */
+GLM_API void vec4_multiplyTo(float *GLM_RESTRICT out, vec4 a, vec4 b) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    out[0] = a[0] * b[0];
+    out[1] = a[1] * b[1];
+    out[2] = a[2] * b[2];
+    out[3] = a[3] * b[3];
+}
+
+/**
+ * Divides two vec4's
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the first operand
+ * @param {vec4} b the second operand
+ */
+GLM_API void vec4_divideTo(float *GLM_RESTRICT out, vec4 a, vec4 b) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    out[0] = a[0] / b[0];
+    out[1] = a[1] / b[1];
+    out[2] = a[2] / b[2];
+    out[3] = a[3] / b[3];
+}
+
+/**
+ * ceilf the components of a vec4
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a vector to ceil
+ */
+GLM_API void vec4_ceilTo(float *GLM_RESTRICT out, vec4 a) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    out[0] = ceilf(a[0]);
+    out[1] = ceilf(a[1]);
+    out[2] = ceilf(a[2]);
+    out[3] = ceilf(a[3]);
+}
+
+/**
+ * floorf the components of a vec4
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a vector to floor
+ */
+GLM_API void vec4_floorTo(float *GLM_RESTRICT out, vec4 a) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    out[0] = floorf(a[0]);
+    out[1] = floorf(a[1]);
+    out[2] = floorf(a[2]);
+    out[3] = floorf(a[3]);
+}
+
+/**
+ * Returns the minimum of two vec4's
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the first operand
+ * @param {vec4} b the second operand
+ */
+GLM_API void vec4_minTo(float *GLM_RESTRICT out, vec4 a, vec4 b) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    out[0] = fmin(a[0], b[0]);
+    out[1] = fmin(a[1], b[1]);
+    out[2] = fmin(a[2], b[2]);
+    out[3] = fmin(a[3], b[3]);
+}
+
+/**
+ * Returns the maximum of two vec4's
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the first operand
+ * @param {vec4} b the second operand
+ */
+GLM_API void vec4_maxTo(float *GLM_RESTRICT out, vec4 a, vec4 b) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    out[0] = fmax(a[0], b[0]);
+    out[1] = fmax(a[1], b[1]);
+    out[2] = fmax(a[2], b[2]);
+    out[3] = fmax(a[3], b[3]);
+}
+
+/**
+ * roundf the components of a vec4
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a vector to round
+ */
+GLM_API void vec4_roundTo(float *GLM_RESTRICT out, vec4 a) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    out[0] = roundf(a[0]);
+    out[1] = roundf(a[1]);
+    out[2] = roundf(a[2]);
+    out[3] = roundf(a[3]);
+}
+
+/**
+ * Scales a vec4 by a scalar number
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a the vector to scale
+ * @param {Number} b amount to scale the vector by
+ */
+GLM_API void vec4_scaleTo(float *GLM_RESTRICT out, vec4 a, float b) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    out[0] = a[0] * b;
+    out[1] = a[1] * b;
+    out[2] = a[2] * b;
+    out[3] = a[3] * b;
+}
+
+/**
+ * Adds two vec4's after scaling the second operand by a scalar value
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} b the second operand
+ * @param {Number} scale the amount to scale b by before adding
+ */
+GLM_API void vec4_scaleAndAddTo(float *GLM_RESTRICT out, vec4 a, vec4 b, float scale) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    out[0] = a[0] + (b[0] * scale);
+    out[1] = a[1] + (b[1] * scale);
+    out[2] = a[2] + (b[2] * scale);
+    out[3] = a[3] + (b[3] * scale);
+}
+
+/**
+ * Negates the components of a vec4
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a vector to negate
+ */
+GLM_API void vec4_negateTo(float *GLM_RESTRICT out, vec4 a) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    out[0] = -a[0];
+    out[1] = -a[1];
+    out[2] = -a[2];
+    out[3] = -a[3];
+}
+
+/**
+ * Returns the inverse of the components of a vec4
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a vector to invert
+ */
+GLM_API void vec4_inverseTo(float *GLM_RESTRICT out, vec4 a) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    out[0] = 1.0 / a[0];
+    out[1] = 1.0 / a[1];
+    out[2] = 1.0 / a[2];
+    out[3] = 1.0 / a[3];
+}
+
+/**
+ * Normalize a vec4
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} a vector to normalize
+ */
+GLM_API void vec4_normalizeTo(float *GLM_RESTRICT out, vec4 a) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    float x = a[0];
+    float y = a[1];
+    float z = a[2];
+    float w = a[3];
+    float len = x*x + y*y + z*z + w*w;
+    // A zero length vector is copied as is, like vec4_normalize leaves it
+    len = len > GLM_NORMALIZE_MIN ? glm_normalize_rsqrt(len) : 1;
+    out[0] = x * len;
+    out[1] = y * len;
+    out[2] = z * len;
+    out[3] = w * len;
+}
+
+/**
+ * Performs a linear interpolation between two vec4's
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {vec4} b the second operand
+ * @param {Number} t interpolation amount, in the range [0-1], between the two inputs
+ */
+GLM_API void vec4_lerpTo(float *GLM_RESTRICT out, vec4 a, vec4 b, float t) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, b, 4);
+    float ax = a[0];
+    float ay = a[1];
+    float az = a[2];
+    float aw = a[3];
+    out[0] = ax + t * (b[0] - ax);
+    out[1] = ay + t * (b[1] - ay);
+    out[2] = az + t * (b[2] - az);
+    out[3] = aw + t * (b[3] - aw);
+}
+
+/**
+ * Transforms the vec4 with a mat4.
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {mat4} m matrix to transform with
+ */
+GLM_API void vec4_transformMat4To(float *GLM_RESTRICT out, vec4 a, mat4 m) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, m, 16);
+    float x = a[0], y = a[1], z = a[2], w = a[3];
+    out[0] = m[0] * x + m[4] * y + m[8] * z + m[12] * w;
+    out[1] = m[1] * x + m[5] * y + m[9] * z + m[13] * w;
+    out[2] = m[2] * x + m[6] * y + m[10] * z + m[14] * w;
+    out[3] = m[3] * x + m[7] * y + m[11] * z + m[15] * w;
+}
+
+/**
+ * Transforms the vec4 with a quat
+ *
+ * @param {vec4} out the receiving vector, must not overlap the other arguments
+ * @param {vec4} a the source vector
+ * @param {quat} q quaternion to transform with
+ */
+GLM_API void vec4_transformQuatTo(float *GLM_RESTRICT out, vec4 a, quat q) {
+    GLM_ASSERT_NOALIAS(out, 4, a, 4);
+    GLM_ASSERT_NOALIAS(out, 4, q, 4);
+    float x = a[0], y = a[1], z = a[2];
+    float qx = q[0], qy = q[1], qz = q[2], qw = q[3];
+
+    // calculate quat * vec
+    float ix = qw * x + qy * z - qz * y;
+    float iy = qw * y + qz * x - qx * z;
+    float iz = qw * z + qx * y - qy * x;
+    float iw = -qx * x - qy * y - qz * z;
+
+    // calculate result * inverse quat
+    out[0] = ix * qw + iw * -qx + iy * -qz - iz * -qy;
+    out[1] = iy * qw + iw * -qy + iz * -qx - ix * -qz;
+    out[2] = iz * qw + iw * -qz + ix * -qy - iy * -qx;
+    out[3] = a[3];
+}